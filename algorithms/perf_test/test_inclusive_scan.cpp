@@ -173,9 +173,22 @@ constexpr std::size_t PROB_SIZE = 100'000'000;
 // FIXME: Add logic to pass min. warm-up time. Also, the value should be set
 // by the user. Say, via the environment variable BENCHMARK_MIN_WARMUP_TIME.
 
-BENCHMARK(BM_inclusive_scan<std::uint64_t>)->Arg(PROB_SIZE)->UseManualTime();
-BENCHMARK(BM_inclusive_scan<std::int64_t>)->Arg(PROB_SIZE)->UseManualTime();
-BENCHMARK(BM_inclusive_scan<double>)->Arg(PROB_SIZE)->UseManualTime();
+// The bandwidth is reported for reading the input and writing the output
+// once. Going from sizes that fit in cache to sizes that do not shows how
+// close the scan gets to that on the host backends, which scan large ranges
+// in a single pass over cache-sized chunks.
+BENCHMARK(BM_inclusive_scan<std::uint64_t>)
+    ->RangeMultiplier(10)
+    ->Range(100'000, PROB_SIZE)
+    ->UseManualTime();
+BENCHMARK(BM_inclusive_scan<std::int64_t>)
+    ->RangeMultiplier(10)
+    ->Range(100'000, PROB_SIZE)
+    ->UseManualTime();
+BENCHMARK(BM_inclusive_scan<double>)
+    ->RangeMultiplier(10)
+    ->Range(100'000, PROB_SIZE)
+    ->UseManualTime();
 BENCHMARK(BM_inclusive_scan<std::uint64_t, SumFunctor>)
     ->Arg(PROB_SIZE)
     ->UseManualTime();
@@ -30,11 +30,15 @@ export {
   using ::Kokkos::sort;
 
   namespace Experimental {
+  using ::Kokkos::Experimental::histogram;
+  using ::Kokkos::Experimental::PermutationPlan;
   using ::Kokkos::Experimental::sort_by_key;
   using ::Kokkos::Experimental::sort_by_key_team;
   using ::Kokkos::Experimental::sort_by_key_thread;
+  using ::Kokkos::Experimental::sort_segmented;
   using ::Kokkos::Experimental::sort_team;
   using ::Kokkos::Experimental::sort_thread;
+  using ::Kokkos::Experimental::stable_sort_by_key;
   }  // namespace Experimental
   }  // namespace Kokkos
 }
@@ -29,6 +29,7 @@ export {
   using ::Kokkos::Experimental::begin;
   using ::Kokkos::Experimental::cbegin;
   using ::Kokkos::Experimental::cend;
+  using ::Kokkos::Experimental::compact;
   using ::Kokkos::Experimental::copy;
   using ::Kokkos::Experimental::copy_backward;
   using ::Kokkos::Experimental::copy_if;
@@ -38,6 +39,7 @@ export {
   using ::Kokkos::Experimental::distance;
   using ::Kokkos::Experimental::end;
   using ::Kokkos::Experimental::equal;
+  using ::Kokkos::Experimental::equal_range;
   using ::Kokkos::Experimental::exclusive_scan;
   using ::Kokkos::Experimental::fill;
   using ::Kokkos::Experimental::fill_n;
@@ -50,19 +52,26 @@ export {
   using ::Kokkos::Experimental::for_each_n;
   using ::Kokkos::Experimental::generate;
   using ::Kokkos::Experimental::generate_n;
+  using ::Kokkos::Experimental::includes;
   using ::Kokkos::Experimental::inclusive_scan;
+  using ::Kokkos::Experimental::inplace_merge;
   using ::Kokkos::Experimental::is_partitioned;
   using ::Kokkos::Experimental::is_sorted;
   using ::Kokkos::Experimental::is_sorted_until;
   using ::Kokkos::Experimental::iter_swap;
   using ::Kokkos::Experimental::lexicographical_compare;
+  using ::Kokkos::Experimental::lower_bound;
+  using ::Kokkos::Experimental::lower_bound_batch;
   using ::Kokkos::Experimental::max_element;
+  using ::Kokkos::Experimental::merge;
   using ::Kokkos::Experimental::min_element;
   using ::Kokkos::Experimental::minmax_element;
   using ::Kokkos::Experimental::mismatch;
   using ::Kokkos::Experimental::move;
   using ::Kokkos::Experimental::move_backward;
   using ::Kokkos::Experimental::none_of;
+  using ::Kokkos::Experimental::nth_element;
+  using ::Kokkos::Experimental::partial_sort;
   using ::Kokkos::Experimental::partition_copy;
   using ::Kokkos::Experimental::partition_point;
   using ::Kokkos::Experimental::reduce;
@@ -80,8 +89,13 @@ export {
   using ::Kokkos::Experimental::rotate_copy;
   using ::Kokkos::Experimental::search;
   using ::Kokkos::Experimental::search_n;
+  using ::Kokkos::Experimental::set_difference;
+  using ::Kokkos::Experimental::set_intersection;
+  using ::Kokkos::Experimental::set_union;
   using ::Kokkos::Experimental::shift_left;
   using ::Kokkos::Experimental::shift_right;
+  using ::Kokkos::Experimental::sort;
+  using ::Kokkos::Experimental::stable_sort;
   using ::Kokkos::Experimental::swap_ranges;
   using ::Kokkos::Experimental::transform;
   using ::Kokkos::Experimental::transform_exclusive_scan;
@@ -89,5 +103,6 @@ export {
   using ::Kokkos::Experimental::transform_reduce;
   using ::Kokkos::Experimental::unique;
   using ::Kokkos::Experimental::unique_copy;
+  using ::Kokkos::Experimental::upper_bound;
   }  // namespace Kokkos::Experimental
 }
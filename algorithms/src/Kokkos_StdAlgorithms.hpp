@@ -68,6 +68,7 @@
 #include "std_algorithms/Kokkos_CopyN.hpp"
 #include "std_algorithms/Kokkos_CopyBackward.hpp"
 #include "std_algorithms/Kokkos_CopyIf.hpp"
+#include "std_algorithms/Kokkos_Compact.hpp"
 #include "std_algorithms/Kokkos_Transform.hpp"
 #include "std_algorithms/Kokkos_Generate.hpp"
 #include "std_algorithms/Kokkos_GenerateN.hpp"
@@ -90,6 +91,24 @@
 // sorting
 #include "std_algorithms/Kokkos_IsSortedUntil.hpp"
 #include "std_algorithms/Kokkos_IsSorted.hpp"
+#include "std_algorithms/Kokkos_Sort.hpp"
+#include "std_algorithms/Kokkos_StableSort.hpp"
+#include "std_algorithms/Kokkos_PartialSort.hpp"
+#include "std_algorithms/Kokkos_NthElement.hpp"
+
+// binary search
+#include "std_algorithms/Kokkos_LowerBound.hpp"
+#include "std_algorithms/Kokkos_LowerBoundBatch.hpp"
+#include "std_algorithms/Kokkos_UpperBound.hpp"
+#include "std_algorithms/Kokkos_EqualRange.hpp"
+
+// merge and set operations on sorted ranges
+#include "std_algorithms/Kokkos_Merge.hpp"
+#include "std_algorithms/Kokkos_InplaceMerge.hpp"
+#include "std_algorithms/Kokkos_Includes.hpp"
+#include "std_algorithms/Kokkos_SetDifference.hpp"
+#include "std_algorithms/Kokkos_SetIntersection.hpp"
+#include "std_algorithms/Kokkos_SetUnion.hpp"
 
 // min/max element
 #include "std_algorithms/Kokkos_MinElement.hpp"
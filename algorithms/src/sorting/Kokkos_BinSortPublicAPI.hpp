@@ -18,9 +18,13 @@
 #define KOKKOS_BIN_SORT_PUBLIC_API_HPP_
 
 #include "Kokkos_BinOpsPublicAPI.hpp"
+#include "Kokkos_PermutationPlanPublicAPI.hpp"
 #include "impl/Kokkos_CopyOpsForBinSortImpl.hpp"
+#include "impl/Kokkos_HostMergeSortImpl.hpp"
+#include "impl/Kokkos_NestedSortImpl.hpp"
 #include <Kokkos_Core.hpp>
 #include <algorithm>
+#include <limits>
 
 namespace Kokkos {
 
@@ -102,6 +106,10 @@ class BinSort {
   struct bin_binning_tag {};
   struct bin_sort_bins_tag {};
 
+  // On devices, bins with more elements than this are sorted by a whole team
+  // instead of a single thread.
+  static constexpr int max_thread_sorted_bin_size_on_device = 128;
+
  public:
   using size_type  = SizeType;
   using value_type = size_type;
@@ -143,6 +151,9 @@ class BinSort {
   int range_end;
   bool sort_within_bins;
 
+ private:
+  int max_thread_sorted_bin_size = std::numeric_limits<int>::max();
+
  public:
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
   KOKKOS_DEPRECATED BinSort() = default;
@@ -229,12 +240,15 @@ class BinSort {
         Kokkos::RangePolicy<ExecutionSpace, bin_binning_tag>(exec, 0, len),
         *this);
 
-    if (sort_within_bins)
+    if (sort_within_bins) {
+      max_thread_sorted_bin_size = get_max_thread_sorted_bin_size(exec);
       Kokkos::parallel_for(
           "Kokkos::Sort::BinSort",
           Kokkos::RangePolicy<ExecutionSpace, bin_sort_bins_tag>(
               exec, 0, bin_op.max_bins()),
           *this);
+      sort_large_bins(exec);
+    }
   }
 
   // Create the permutation vector, the bin_offset array and the bin_count
@@ -272,50 +286,13 @@ class BinSort {
       Kokkos::abort(
           "BinSort::sort: values range length != permutation vector length");
     }
-
-    using scratch_view_type =
-        Kokkos::View<typename ValuesViewType::data_type,
-                     typename ValuesViewType::device_type>;
-    scratch_view_type sorted_values(
-        view_alloc(exec, WithoutInitializing,
-                   "Kokkos::SortImpl::BinSortFunctor::sorted_values"),
-        values.rank_dynamic > 0 ? len : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 1 ? values.extent(1)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 2 ? values.extent(2)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 3 ? values.extent(3)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 4 ? values.extent(4)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 5 ? values.extent(5)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 6 ? values.extent(6)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 7 ? values.extent(7)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG);
-
-    {
-      copy_permute_functor<scratch_view_type /* DstViewType */
-                           ,
-                           offset_type /* PermuteViewType */
-                           ,
-                           ValuesViewType /* SrcViewType */
-                           >
-          functor(sorted_values, sort_order, values,
-                  values_range_begin - range_begin);
-
-      parallel_for("Kokkos::Sort::CopyPermute",
-                   Kokkos::RangePolicy<ExecutionSpace>(exec, 0, len), functor);
+    if (values.extent(0) < static_cast<size_t>(values_range_end)) {
+      Kokkos::abort("BinSort::sort: values range end exceeds values extent");
     }
 
-    {
-      copy_functor<ValuesViewType, scratch_view_type> functor(
-          values, range_begin, sorted_values);
-
-      parallel_for("Kokkos::Sort::Copy",
-                   Kokkos::RangePolicy<ExecutionSpace>(exec, 0, len), functor);
-    }
+    Experimental::PermutationPlan<offset_type>(
+        sort_order, values_range_begin - range_begin, range_begin)
+        .apply(exec, values);
   }
 
   // Sort a subset of a view with respect to the first dimension using the
@@ -351,6 +328,132 @@ class BinSort {
   KOKKOS_INLINE_FUNCTION
   bin_count_type get_bin_count() const { return bin_count_const; }
 
+  // Get the permutation as a plan that applies it to any number of views at
+  // once, the same way sort() does
+  Experimental::PermutationPlan<offset_type> get_permutation_plan() const {
+    return Experimental::PermutationPlan<offset_type>(sort_order, -range_begin,
+                                                      range_begin);
+  }
+
+ private:
+  struct bin_order_comparator {
+    BinSortOp bin_op;
+    const_rnd_key_view_type keys;
+
+    template <class IndexType>
+    KOKKOS_INLINE_FUNCTION bool operator()(IndexType p, IndexType q) const {
+      return bin_op(keys, p, q);
+    }
+  };
+
+  template <class LargeBinsViewType>
+  struct find_large_bins_functor {
+    using value_type = size_type;
+
+    bin_count_type bin_count;
+    LargeBinsViewType large_bins;
+    int max_bin_size;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int i, value_type& count) const {
+      if (bin_count(i) > max_bin_size) ++count;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int i, value_type& count, const bool final) const {
+      if (bin_count(i) <= max_bin_size) return;
+      if (final) large_bins(count) = i;
+      ++count;
+    }
+  };
+
+  template <class ExecutionSpace, class LargeBinsViewType>
+  struct sort_large_bins_functor {
+    using member_type =
+        typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+
+    LargeBinsViewType large_bins;
+    offset_type bin_offsets;
+    bin_count_type bin_count;
+    offset_type sort_order;
+    bin_order_comparator comp;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const member_type& team) const {
+      const int bin         = large_bins(team.league_rank());
+      const size_type lower = bin_offsets(bin);
+      const size_type upper = lower + bin_count(bin);
+      Kokkos::Experimental::Impl::sort_nested_impl(
+          team, Kokkos::subview(sort_order, Kokkos::make_pair(lower, upper)),
+          nullptr, comp, Kokkos::Experimental::Impl::NestedRange<true>());
+    }
+  };
+
+  template <class ExecutionSpace>
+  static int get_max_thread_sorted_bin_size(const ExecutionSpace& exec) {
+    if constexpr (std::is_same_v<typename ExecutionSpace::memory_space,
+                                 HostSpace>) {
+      return exec.concurrency() > 1
+                 ? 2 * int(Impl::host_merge_sort_min_chunk_size)
+                 : std::numeric_limits<int>::max();
+    } else {
+      return max_thread_sorted_bin_size_on_device;
+    }
+  }
+
+  // Bins too large for a single thread are sorted after all the others: by
+  // one team per bin on devices, and one at a time by all threads with the
+  // parallel merge sort on the host. This keeps a few huge bins from
+  // serializing the whole sort when the keys are skewed.
+  template <class ExecutionSpace>
+  void sort_large_bins(const ExecutionSpace& exec) const {
+    using large_bins_type = Kokkos::View<int*, Space>;
+    using functor_type    = find_large_bins_functor<large_bins_type>;
+
+    functor_type find_large_bins{bin_count_const, large_bins_type(),
+                                 max_thread_sorted_bin_size};
+    size_type num_large_bins = 0;
+    Kokkos::parallel_reduce(
+        "Kokkos::Sort::BinCountLarge",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, bin_op.max_bins()),
+        find_large_bins, num_large_bins);
+    if (num_large_bins == 0) return;
+
+    find_large_bins.large_bins = large_bins_type(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::SortImpl::BinSortFunctor::large_bins"),
+        num_large_bins);
+    Kokkos::parallel_scan(
+        "Kokkos::Sort::BinFindLarge",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, bin_op.max_bins()),
+        find_large_bins);
+
+    const bin_order_comparator comp{bin_op, keys_rnd};
+    if constexpr (std::is_same_v<typename ExecutionSpace::memory_space,
+                                 HostSpace>) {
+      exec.fence("Kokkos::BinSort::sort_large_bins: before sorting on host");
+      for (size_type k = 0; k < num_large_bins; ++k) {
+        const int bin         = find_large_bins.large_bins(k);
+        const size_type lower = bin_offsets(bin);
+        const size_type upper = lower + bin_count_const(bin);
+        Impl::host_merge_sort(
+            exec, Kokkos::subview(sort_order, Kokkos::make_pair(lower, upper)),
+            std::min<std::size_t>(
+                exec.concurrency(),
+                (upper - lower) / Impl::host_merge_sort_min_chunk_size),
+            comp);
+      }
+    } else {
+      Kokkos::parallel_for(
+          "Kokkos::Sort::BinSortLarge",
+          Kokkos::TeamPolicy<ExecutionSpace>(exec, num_large_bins,
+                                             Kokkos::AUTO),
+          sort_large_bins_functor<ExecutionSpace, large_bins_type>{
+              find_large_bins.large_bins, bin_offsets, bin_count_const,
+              sort_order, comp});
+    }
+  }
+
  public:
   KOKKOS_INLINE_FUNCTION
   void operator()(const bin_count_tag& /*tag*/, const int i) const {
@@ -379,7 +482,7 @@ class BinSort {
   KOKKOS_INLINE_FUNCTION
   void operator()(const bin_sort_bins_tag& /*tag*/, const int i) const {
     auto bin_size = bin_count_const(i);
-    if (bin_size <= 1) return;
+    if (bin_size <= 1 || bin_size > max_thread_sorted_bin_size) return;
     constexpr bool use_std_sort =
         std::is_same_v<typename exec_space::memory_space, HostSpace>;
     int lower_bound = bin_offsets(i);
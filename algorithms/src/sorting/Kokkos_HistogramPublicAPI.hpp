@@ -0,0 +1,151 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HISTOGRAM_PUBLIC_API_HPP_
+#define KOKKOS_HISTOGRAM_PUBLIC_API_HPP_
+
+#include "./impl/Kokkos_HistogramImpl.hpp"
+#include <Kokkos_Core.hpp>
+#include <type_traits>
+
+namespace Kokkos::Experimental {
+
+// ---------------------------------------------------------------
+// counts(b) is set to the number of keys in bin b, or to the sum of their
+// weights. The bins are either the keys themselves or given by a bin op
+// such as Kokkos::BinOp1D. Keys whose bin is not in [0, counts.extent(0))
+// are ignored.
+// ---------------------------------------------------------------
+
+template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
+          class CountsDataType, class... CountsProperties,
+          std::enable_if_t<Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void histogram(
+    const ExecutionSpace& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<CountsDataType, CountsProperties...>& counts) {
+  ::Kokkos::Impl::histogram_impl(exec, keys,
+                                 ::Kokkos::Impl::HistogramIdentityBinOp{},
+                                 ::Kokkos::Impl::HistogramUnitWeights{},
+                                 counts);
+}
+
+template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
+          class WeightsDataType, class... WeightsProperties,
+          class CountsDataType, class... CountsProperties,
+          std::enable_if_t<Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void histogram(
+    const ExecutionSpace& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<WeightsDataType, WeightsProperties...>& weights,
+    const Kokkos::View<CountsDataType, CountsProperties...>& counts) {
+  ::Kokkos::Impl::histogram_impl(
+      exec, keys, ::Kokkos::Impl::HistogramIdentityBinOp{}, weights, counts);
+}
+
+template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
+          class BinOp, class CountsDataType, class... CountsProperties,
+          std::enable_if_t<Kokkos::is_execution_space_v<ExecutionSpace> &&
+                               !Kokkos::is_view_v<BinOp>,
+                           int> = 0>
+void histogram(
+    const ExecutionSpace& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const BinOp& bin_op,
+    const Kokkos::View<CountsDataType, CountsProperties...>& counts) {
+  ::Kokkos::Impl::histogram_impl(
+      exec, keys, bin_op, ::Kokkos::Impl::HistogramUnitWeights{}, counts);
+}
+
+template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
+          class BinOp, class WeightsDataType, class... WeightsProperties,
+          class CountsDataType, class... CountsProperties,
+          std::enable_if_t<Kokkos::is_execution_space_v<ExecutionSpace> &&
+                               !Kokkos::is_view_v<BinOp>,
+                           int> = 0>
+void histogram(
+    const ExecutionSpace& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const BinOp& bin_op,
+    const Kokkos::View<WeightsDataType, WeightsProperties...>& weights,
+    const Kokkos::View<CountsDataType, CountsProperties...>& counts) {
+  ::Kokkos::Impl::histogram_impl(exec, keys, bin_op, weights, counts);
+}
+
+// ---------------------------------------------------------------
+// team-level variants, the counts are typically in team scratch memory
+// ---------------------------------------------------------------
+
+template <class TeamHandle, class KeysDataType, class... KeysProperties,
+          class CountsDataType, class... CountsProperties,
+          std::enable_if_t<Kokkos::is_team_handle_v<TeamHandle>, int> = 0>
+KOKKOS_FUNCTION void histogram(
+    const TeamHandle& team,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<CountsDataType, CountsProperties...>& counts) {
+  ::Kokkos::Impl::histogram_team_impl(team, keys,
+                                      ::Kokkos::Impl::HistogramIdentityBinOp{},
+                                      ::Kokkos::Impl::HistogramUnitWeights{},
+                                      counts);
+}
+
+template <class TeamHandle, class KeysDataType, class... KeysProperties,
+          class WeightsDataType, class... WeightsProperties,
+          class CountsDataType, class... CountsProperties,
+          std::enable_if_t<Kokkos::is_team_handle_v<TeamHandle>, int> = 0>
+KOKKOS_FUNCTION void histogram(
+    const TeamHandle& team,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<WeightsDataType, WeightsProperties...>& weights,
+    const Kokkos::View<CountsDataType, CountsProperties...>& counts) {
+  ::Kokkos::Impl::histogram_team_impl(
+      team, keys, ::Kokkos::Impl::HistogramIdentityBinOp{}, weights, counts);
+}
+
+template <class TeamHandle, class KeysDataType, class... KeysProperties,
+          class BinOp, class CountsDataType, class... CountsProperties,
+          std::enable_if_t<Kokkos::is_team_handle_v<TeamHandle> &&
+                               !Kokkos::is_view_v<BinOp>,
+                           int> = 0>
+KOKKOS_FUNCTION void histogram(
+    const TeamHandle& team,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const BinOp& bin_op,
+    const Kokkos::View<CountsDataType, CountsProperties...>& counts) {
+  ::Kokkos::Impl::histogram_team_impl(
+      team, keys, bin_op, ::Kokkos::Impl::HistogramUnitWeights{}, counts);
+}
+
+template <class TeamHandle, class KeysDataType, class... KeysProperties,
+          class BinOp, class WeightsDataType, class... WeightsProperties,
+          class CountsDataType, class... CountsProperties,
+          std::enable_if_t<Kokkos::is_team_handle_v<TeamHandle> &&
+                               !Kokkos::is_view_v<BinOp>,
+                           int> = 0>
+KOKKOS_FUNCTION void histogram(
+    const TeamHandle& team,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const BinOp& bin_op,
+    const Kokkos::View<WeightsDataType, WeightsProperties...>& weights,
+    const Kokkos::View<CountsDataType, CountsProperties...>& counts) {
+  ::Kokkos::Impl::histogram_team_impl(team, keys, bin_op, weights, counts);
+}
+
+}  // namespace Kokkos::Experimental
+
+#endif
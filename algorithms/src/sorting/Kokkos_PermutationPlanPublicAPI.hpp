@@ -0,0 +1,140 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_PERMUTATION_PLAN_PUBLIC_API_HPP_
+#define KOKKOS_PERMUTATION_PLAN_PUBLIC_API_HPP_
+
+#include "impl/Kokkos_PermutationPlanImpl.hpp"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Kokkos::Experimental {
+
+// A permutation that can be applied to any number of views, long after the
+// BinSort that computed it is gone. Row dst_offset + i of every view gets
+// row src_offset + permute(i); all views are gathered by a single kernel and
+// copied back by another one.
+template <class PermuteViewType>
+class PermutationPlan {
+ public:
+  using permute_view_type = PermuteViewType;
+
+  explicit PermutationPlan(const permute_view_type& permute,
+                           std::ptrdiff_t src_offset = 0,
+                           std::ptrdiff_t dst_offset = 0)
+      : m_permute(permute), m_src_offset(src_offset), m_dst_offset(dst_offset) {
+    static_assert(permute_view_type::rank == 1,
+                  "Kokkos::PermutationPlan: the permutation must be a rank-1 "
+                  "View");
+  }
+
+  template <class ExecutionSpace, class... ValuesViewTypes>
+  std::enable_if_t<Kokkos::is_execution_space_v<ExecutionSpace>> apply(
+      const ExecutionSpace& exec, const ValuesViewTypes&... values) const {
+    static_assert(
+        Kokkos::SpaceAccessibility<
+            ExecutionSpace,
+            typename permute_view_type::memory_space>::accessible,
+        "The provided execution space must be able to access the memory space "
+        "of the permutation!");
+    static_assert(
+        (Kokkos::SpaceAccessibility<
+             ExecutionSpace,
+             typename ValuesViewTypes::memory_space>::accessible &&
+         ...),
+        "The provided execution space must be able to access the memory space "
+        "of the View arguments!");
+
+    std::size_t const len = m_permute.extent(0);
+    if (len == 0 || sizeof...(ValuesViewTypes) == 0) return;
+    // Rows dst_offset + i are written and, for a permutation of [0, len), rows
+    // src_offset + permute(i) are read, so every view must cover both ranges.
+    std::ptrdiff_t const n = len;
+    std::size_t const required_extent =
+        std::max({n, m_src_offset + n, m_dst_offset + n});
+    (check_extent(values.extent(0), required_extent), ...);
+
+    auto const buffers = std::make_tuple(
+        ::Kokkos::Impl::make_permute_buffer(exec, values, len)...);
+    apply_impl(exec, len, buffers,
+               std::index_sequence_for<ValuesViewTypes...>{}, values...);
+  }
+
+  template <class... ValuesViewTypes>
+  std::enable_if_t<(Kokkos::is_view_v<ValuesViewTypes> && ...)> apply(
+      const ValuesViewTypes&... values) const {
+    Kokkos::fence("Kokkos::PermutationPlan::apply: before");
+    typename permute_view_type::execution_space exec;
+    apply(exec, values...);
+    exec.fence("Kokkos::PermutationPlan::apply: after");
+  }
+
+  permute_view_type get_permute_vector() const { return m_permute; }
+
+ private:
+  static void check_extent(std::size_t extent, std::size_t required_extent) {
+    if (extent < required_extent)
+      Kokkos::abort((std::string("Kokkos::PermutationPlan::apply: the View "
+                                 "extent is ") +
+                     std::to_string(extent) + ", but the permutation needs " +
+                     std::to_string(required_extent) + " rows.")
+                        .c_str());
+  }
+
+  template <class ExecutionSpace, class Buffers, std::size_t... Is,
+            class... ValuesViewTypes>
+  void apply_impl(const ExecutionSpace& exec, std::size_t len,
+                  const Buffers& buffers, std::index_sequence<Is...>,
+                  const ValuesViewTypes&... values) const {
+    namespace KI = ::Kokkos::Impl;
+    using gather_type = KI::FusedPermuteCopies<
+        KI::PermuteCopy<std::tuple_element_t<Is, Buffers>,
+                        typename ValuesViewTypes::const_type>...>;
+    using copy_back_type = KI::FusedPermuteCopies<
+        KI::PermuteCopy<ValuesViewTypes, std::tuple_element_t<Is, Buffers>>...>;
+    using policy_type = Kokkos::RangePolicy<ExecutionSpace>;
+
+    Kokkos::parallel_for(
+        "Kokkos::PermutationPlan::Gather", policy_type(exec, 0, len),
+        KI::FusedPermuteGatherFunctor<permute_view_type, gather_type>{
+            m_permute,
+            gather_type(KI::PermuteCopy<std::tuple_element_t<Is, Buffers>,
+                                        typename ValuesViewTypes::const_type>{
+                std::get<Is>(buffers), values}...),
+            m_src_offset});
+    Kokkos::parallel_for(
+        "Kokkos::PermutationPlan::CopyBack", policy_type(exec, 0, len),
+        KI::FusedPermuteCopyBackFunctor<copy_back_type>{
+            copy_back_type(
+                KI::PermuteCopy<ValuesViewTypes,
+                                std::tuple_element_t<Is, Buffers>>{
+                    values, std::get<Is>(buffers)}...),
+            m_dst_offset});
+  }
+
+  permute_view_type m_permute;
+  std::ptrdiff_t m_src_offset;
+  std::ptrdiff_t m_dst_offset;
+};
+
+}  // namespace Kokkos::Experimental
+
+#endif
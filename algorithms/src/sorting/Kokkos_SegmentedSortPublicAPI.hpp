@@ -0,0 +1,73 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SEGMENTED_SORT_PUBLIC_API_HPP_
+#define KOKKOS_SEGMENTED_SORT_PUBLIC_API_HPP_
+
+#include "./impl/Kokkos_SegmentedSortImpl.hpp"
+#include <Kokkos_Core.hpp>
+#include <type_traits>
+
+namespace Kokkos::Experimental {
+
+// ---------------------------------------------------------------
+// sorts values(offsets(i)), ..., values(offsets(i + 1) - 1) for every i
+// ---------------------------------------------------------------
+
+template <class ExecutionSpace, class ValuesDataType,
+          class... ValuesProperties, class OffsetsDataType,
+          class... OffsetsProperties>
+void sort_segmented(
+    const ExecutionSpace& exec,
+    const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
+    const Kokkos::View<OffsetsDataType, OffsetsProperties...>& offsets) {
+  ::Kokkos::Impl::sort_segmented_impl(exec, values, offsets);
+}
+
+template <class ExecutionSpace, class ValuesDataType,
+          class... ValuesProperties, class OffsetsDataType,
+          class... OffsetsProperties, class ComparatorType>
+void sort_segmented(
+    const ExecutionSpace& exec,
+    const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
+    const Kokkos::View<OffsetsDataType, OffsetsProperties...>& offsets,
+    const ComparatorType& comparator) {
+  ::Kokkos::Impl::sort_segmented_impl(exec, values, offsets, comparator);
+}
+
+// ---------------------------------------------------------------
+// sorts the entries of every row of a compressed row storage graph
+// ---------------------------------------------------------------
+
+template <class ExecutionSpace, class GraphType,
+          std::enable_if_t<::Kokkos::Impl::is_crs_graph_like_v<GraphType>,
+                           int> = 0>
+void sort_segmented(const ExecutionSpace& exec, const GraphType& graph) {
+  ::Kokkos::Impl::sort_segmented_impl(exec, graph.entries, graph.row_map);
+}
+
+template <class ExecutionSpace, class GraphType, class ComparatorType,
+          std::enable_if_t<::Kokkos::Impl::is_crs_graph_like_v<GraphType>,
+                           int> = 0>
+void sort_segmented(const ExecutionSpace& exec, const GraphType& graph,
+                    const ComparatorType& comparator) {
+  ::Kokkos::Impl::sort_segmented_impl(exec, graph.entries, graph.row_map,
+                                      comparator);
+}
+
+}  // namespace Kokkos::Experimental
+
+#endif
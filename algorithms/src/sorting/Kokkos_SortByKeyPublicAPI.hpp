@@ -33,31 +33,7 @@ void sort_by_key(
     const ExecutionSpace& exec,
     const Kokkos::View<KeysDataType, KeysProperties...>& keys,
     const Kokkos::View<ValuesDataType, ValuesProperties...>& values) {
-  // constraints
-  using KeysType   = Kokkos::View<KeysDataType, KeysProperties...>;
-  using ValuesType = Kokkos::View<ValuesDataType, ValuesProperties...>;
-  ::Kokkos::Impl::static_assert_is_admissible_to_kokkos_sort_by_key(keys);
-  ::Kokkos::Impl::static_assert_is_admissible_to_kokkos_sort_by_key(values);
-
-  static_assert(SpaceAccessibility<ExecutionSpace,
-                                   typename KeysType::memory_space>::accessible,
-                "Kokkos::sort: execution space instance is not able to access "
-                "the memory space of the keys View argument!");
-  static_assert(
-      SpaceAccessibility<ExecutionSpace,
-                         typename ValuesType::memory_space>::accessible,
-      "Kokkos::sort: execution space instance is not able to access "
-      "the memory space of the values View argument!");
-
-  static_assert(KeysType::static_extent(0) == 0 ||
-                ValuesType::static_extent(0) == 0 ||
-                KeysType::static_extent(0) == ValuesType::static_extent(0));
-  if (values.size() != keys.size())
-    Kokkos::abort((std::string("values and keys extents must be the same. The "
-                               "values extent is ") +
-                   std::to_string(values.size()) + ", and the keys extent is " +
-                   std::to_string(keys.size()) + ".")
-                      .c_str());
+  ::Kokkos::Impl::check_sort_by_key_arguments(exec, keys, values);
 
   if (keys.extent(0) <= 1) {
     return;
@@ -74,36 +50,12 @@ void sort_by_key(
 template <class ExecutionSpace, class ComparatorType, class KeysDataType,
           class... KeysProperties, class ValuesDataType,
           class... ValuesProperties>
-void sort_by_key(
+std::enable_if_t<!Kokkos::is_view_v<ComparatorType>> sort_by_key(
     const ExecutionSpace& exec,
     const Kokkos::View<KeysDataType, KeysProperties...>& keys,
     const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
     const ComparatorType& comparator) {
-  // constraints
-  using KeysType   = Kokkos::View<KeysDataType, KeysProperties...>;
-  using ValuesType = Kokkos::View<ValuesDataType, ValuesProperties...>;
-  ::Kokkos::Impl::static_assert_is_admissible_to_kokkos_sort_by_key(keys);
-  ::Kokkos::Impl::static_assert_is_admissible_to_kokkos_sort_by_key(values);
-
-  static_assert(SpaceAccessibility<ExecutionSpace,
-                                   typename KeysType::memory_space>::accessible,
-                "Kokkos::sort: execution space instance is not able to access "
-                "the memory space of the keys View argument!");
-  static_assert(
-      SpaceAccessibility<ExecutionSpace,
-                         typename ValuesType::memory_space>::accessible,
-      "Kokkos::sort: execution space instance is not able to access "
-      "the memory space of the values View argument!");
-
-  static_assert(KeysType::static_extent(0) == 0 ||
-                ValuesType::static_extent(0) == 0 ||
-                KeysType::static_extent(0) == ValuesType::static_extent(0));
-  if (values.size() != keys.size())
-    Kokkos::abort((std::string("values and keys extents must be the same. The "
-                               "values extent is ") +
-                   std::to_string(values.size()) + ", and the keys extent is " +
-                   std::to_string(keys.size()) + ".")
-                      .c_str());
+  ::Kokkos::Impl::check_sort_by_key_arguments(exec, keys, values);
 
   if (keys.extent(0) <= 1) {
     return;
@@ -113,5 +65,84 @@ void sort_by_key(
                                                           comparator);
 }
 
+// ---------------------------------------------------------------
+// overloads permuting several values views at once
+// ---------------------------------------------------------------
+
+template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
+          class ValuesType, class... MoreValuesTypes>
+std::enable_if_t<(sizeof...(MoreValuesTypes) > 0) &&
+                 (Kokkos::is_view_v<MoreValuesTypes> && ...)>
+sort_by_key(const ExecutionSpace& exec,
+            const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+            const ValuesType& values, const MoreValuesTypes&... more_values) {
+  ::Kokkos::Impl::check_sort_by_key_arguments(exec, keys, values);
+  (::Kokkos::Impl::check_sort_by_key_arguments(exec, keys, more_values), ...);
+
+  if (keys.extent(0) <= 1) {
+    return;
+  }
+
+  ::Kokkos::Impl::sort_by_key_multiple_values<false>(exec, keys, values,
+                                                     more_values...);
+}
+
+// ---------------------------------------------------------------
+// stable overloads: the relative order of values with equivalent
+// keys is preserved
+// ---------------------------------------------------------------
+
+template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
+          class ValuesDataType, class... ValuesProperties>
+void stable_sort_by_key(
+    const ExecutionSpace& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<ValuesDataType, ValuesProperties...>& values) {
+  ::Kokkos::Impl::check_sort_by_key_arguments(exec, keys, values);
+
+  if (keys.extent(0) <= 1) {
+    return;
+  }
+
+  ::Kokkos::Impl::stable_sort_by_key_device_view(exec, keys, values);
+}
+
+template <class ExecutionSpace, class ComparatorType, class KeysDataType,
+          class... KeysProperties, class ValuesDataType,
+          class... ValuesProperties>
+std::enable_if_t<!Kokkos::is_view_v<ComparatorType>> stable_sort_by_key(
+    const ExecutionSpace& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
+    const ComparatorType& comparator) {
+  ::Kokkos::Impl::check_sort_by_key_arguments(exec, keys, values);
+
+  if (keys.extent(0) <= 1) {
+    return;
+  }
+
+  ::Kokkos::Impl::stable_sort_by_key_device_view(exec, keys, values,
+                                                 comparator);
+}
+
+template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
+          class ValuesType, class... MoreValuesTypes>
+std::enable_if_t<(sizeof...(MoreValuesTypes) > 0) &&
+                 (Kokkos::is_view_v<MoreValuesTypes> && ...)>
+stable_sort_by_key(const ExecutionSpace& exec,
+                   const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+                   const ValuesType& values,
+                   const MoreValuesTypes&... more_values) {
+  ::Kokkos::Impl::check_sort_by_key_arguments(exec, keys, values);
+  (::Kokkos::Impl::check_sort_by_key_arguments(exec, keys, more_values), ...);
+
+  if (keys.extent(0) <= 1) {
+    return;
+  }
+
+  ::Kokkos::Impl::sort_by_key_multiple_values<true>(exec, keys, values,
+                                                    more_values...);
+}
+
 }  // namespace Kokkos::Experimental
 #endif
@@ -52,10 +52,7 @@ void sort(const ExecutionSpace& exec,
   }
 
   if constexpr (Impl::better_off_calling_std_sort_v<ExecutionSpace>) {
-    exec.fence("Kokkos::sort without comparator use std::sort");
-    auto first = ::Kokkos::Experimental::begin(view);
-    auto last  = ::Kokkos::Experimental::end(view);
-    std::sort(first, last);
+    Impl::sort_on_host(exec, view);
   } else {
     Impl::sort_device_view_without_comparator(exec, view);
   }
@@ -74,7 +71,7 @@ void sort(const Kokkos::View<DataType, Properties...>& view) {
   }
 
   typename ViewType::execution_space exec;
-  sort(exec, view);
+  Kokkos::sort(exec, view);
   exec.fence("Kokkos::sort: fence after sorting");
 }
 
@@ -106,10 +103,7 @@ void sort(const ExecutionSpace& exec,
   }
 
   if constexpr (Impl::better_off_calling_std_sort_v<ExecutionSpace>) {
-    exec.fence("Kokkos::sort with comparator use std::sort");
-    auto first = ::Kokkos::Experimental::begin(view);
-    auto last  = ::Kokkos::Experimental::end(view);
-    std::sort(first, last, comparator);
+    Impl::sort_on_host(exec, view, comparator);
   } else {
     Impl::sort_device_view_with_comparator(exec, view, comparator);
   }
@@ -134,7 +128,7 @@ void sort(const Kokkos::View<DataType, Properties...>& view,
   }
 
   typename ViewType::execution_space exec;
-  sort(exec, view, comparator);
+  Kokkos::sort(exec, view, comparator);
   exec.fence("Kokkos::sort with comparator: fence after sorting");
 }
 
@@ -188,7 +182,7 @@ void sort(ViewType view, size_t const begin, size_t const end) {
   }
 
   typename ViewType::execution_space exec;
-  sort(exec, view, begin, end);
+  Kokkos::sort(exec, view, begin, end);
   exec.fence("Kokkos::Sort: fence after sorting");
 }
 
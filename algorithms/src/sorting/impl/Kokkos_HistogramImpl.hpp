@@ -0,0 +1,335 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HISTOGRAM_IMPL_HPP_
+#define KOKKOS_HISTOGRAM_IMPL_HPP_
+
+#include "Kokkos_SortImpl.hpp"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+// The bins are counted
+// - in per-thread copies on the host, which are then summed bin by bin, as
+//   long as the copies are smaller than the part of the input each thread
+//   goes through,
+// - in team scratch memory on devices when they fit,
+// - with atomics on the counts otherwise.
+enum class HistogramStrategy { serial, private_bins, team_scratch, atomic };
+
+inline constexpr std::size_t histogram_min_chunk_size    = 4096;
+inline constexpr std::size_t histogram_max_private_bytes = 1 << 26;
+inline constexpr std::size_t histogram_reduce_block_size = 1024;
+
+// The bin op used when the keys are the bins.
+struct HistogramIdentityBinOp {
+  template <class ViewType>
+  KOKKOS_FUNCTION auto bin(ViewType& keys, std::size_t i) const {
+    return keys(i);
+  }
+};
+
+// The weights of an unweighted histogram.
+struct HistogramUnitWeights {
+  KOKKOS_FUNCTION int operator()(std::size_t) const { return 1; }
+};
+
+// Whether bin is in [0, num_bins), after which it may be cast to an index.
+template <class BinType>
+KOKKOS_FUNCTION bool histogram_is_valid_bin(BinType const bin,
+                                            std::size_t num_bins) {
+  if constexpr (std::is_floating_point_v<BinType>) {
+    // converting negative or too large values to an integer is undefined,
+    // NaN fails both comparisons
+    return bin >= BinType(0) && bin < static_cast<BinType>(num_bins);
+  } else {
+    // negative bins wrap around and are dropped like too large ones
+    return static_cast<std::size_t>(bin) < num_bins;
+  }
+}
+
+// Gives the chunk functor the interface of the private copies when there
+// is a single chunk which counts directly into the result.
+template <class CountsView>
+struct HistogramCountsAsPrivate {
+  CountsView m_counts;
+
+  KOKKOS_FUNCTION typename CountsView::reference_type operator()(
+      std::size_t, std::size_t b) const {
+    return m_counts(b);
+  }
+};
+
+template <class KeysView, class BinOp, class Weights, class PrivateView>
+struct HistogramChunkFunctor {
+  KeysView m_keys;
+  BinOp m_bin_op;
+  Weights m_weights;
+  PrivateView m_private;
+  RadixSortBlocks m_chunks;
+  std::size_t m_num_bins;
+
+  KOKKOS_FUNCTION void operator()(std::size_t chunk) const {
+    for (std::size_t b = 0; b < m_num_bins; ++b) m_private(chunk, b) = 0;
+    std::size_t const end = m_chunks.bound(chunk + 1);
+    for (std::size_t i = m_chunks.bound(chunk); i < end; ++i) {
+      auto const bin = m_bin_op.bin(m_keys, i);
+      if (histogram_is_valid_bin(bin, m_num_bins))
+        m_private(chunk, static_cast<std::size_t>(bin)) += m_weights(i);
+    }
+  }
+};
+
+// Sums the private copies into the counts. Each iteration handles a block of
+// bins so that the inner loops run over contiguous bins and vectorize.
+template <class PrivateView, class CountsView>
+struct HistogramReduceFunctor {
+  PrivateView m_private;
+  CountsView m_counts;
+
+  KOKKOS_FUNCTION void operator()(std::size_t block) const {
+    std::size_t const begin = block * histogram_reduce_block_size;
+    std::size_t const end =
+        std::min(begin + histogram_reduce_block_size, m_counts.extent(0));
+    for (std::size_t b = begin; b < end; ++b) m_counts(b) = m_private(0, b);
+    for (std::size_t chunk = 1; chunk < m_private.extent(0); ++chunk) {
+      for (std::size_t b = begin; b < end; ++b)
+        m_counts(b) += m_private(chunk, b);
+    }
+  }
+};
+
+template <class KeysView, class BinOp, class Weights, class CountsView>
+struct HistogramAtomicFunctor {
+  KeysView m_keys;
+  BinOp m_bin_op;
+  Weights m_weights;
+  CountsView m_counts;
+
+  KOKKOS_FUNCTION void operator()(std::size_t i) const {
+    auto const bin = m_bin_op.bin(m_keys, i);
+    if (histogram_is_valid_bin(bin, m_counts.extent(0)))
+      Kokkos::atomic_add(&m_counts(static_cast<std::size_t>(bin)),
+                         typename CountsView::value_type(m_weights(i)));
+  }
+};
+
+template <class ExecutionSpace, class KeysView, class BinOp, class Weights,
+          class CountsView>
+struct HistogramTeamScratchFunctor {
+  using count_type   = typename CountsView::non_const_value_type;
+  using scratch_view = Kokkos::View<
+      count_type*, typename ExecutionSpace::scratch_memory_space,
+      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  KeysView m_keys;
+  BinOp m_bin_op;
+  Weights m_weights;
+  CountsView m_counts;
+  RadixSortBlocks m_chunks;
+
+  template <class TeamMember>
+  KOKKOS_FUNCTION void operator()(TeamMember const& member) const {
+    std::size_t const num_bins = m_counts.extent(0);
+    scratch_view bins(member.team_scratch(0), num_bins);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, num_bins),
+                         [&](std::size_t b) { bins(b) = 0; });
+    member.team_barrier();
+
+    std::size_t const chunk = member.league_rank();
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, m_chunks.bound(chunk),
+                                m_chunks.bound(chunk + 1)),
+        [&](std::size_t i) {
+          auto const bin = m_bin_op.bin(m_keys, i);
+          if (histogram_is_valid_bin(bin, num_bins))
+            Kokkos::atomic_add(&bins(static_cast<std::size_t>(bin)),
+                               count_type(m_weights(i)));
+        });
+    member.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, num_bins),
+                         [&](std::size_t b) {
+                           if (bins(b) != count_type(0))
+                             Kokkos::atomic_add(&m_counts(b), bins(b));
+                         });
+  }
+};
+
+template <class ExecutionSpace, class CountType>
+HistogramStrategy histogram_strategy(ExecutionSpace const& exec,
+                                     std::size_t const n,
+                                     std::size_t const num_bins,
+                                     std::size_t& num_chunks) {
+  if constexpr (better_off_calling_std_sort_v<ExecutionSpace>) {
+    std::size_t const concurrency = exec.concurrency();
+    if (concurrency == 1 || n < 2 * histogram_min_chunk_size) {
+      num_chunks = 1;
+      return HistogramStrategy::serial;
+    }
+    // many bins compared to the keys see little contention and are left to
+    // atomics rather than to copies which would mostly stay empty
+    num_chunks = std::min({concurrency,
+                           n / std::max(num_bins, histogram_min_chunk_size),
+                           histogram_max_private_bytes /
+                               std::max<std::size_t>(
+                                   num_bins * sizeof(CountType), 1)});
+    return num_chunks >= 2 ? HistogramStrategy::private_bins
+                           : HistogramStrategy::atomic;
+  } else {
+    if (n >= num_bins &&
+        num_bins * sizeof(CountType) <=
+            Kokkos::TeamPolicy<ExecutionSpace>::scratch_size_max(0)) {
+      std::size_t const max_teams =
+          std::max<std::size_t>(exec.concurrency() / 128, 1);
+      num_chunks = std::clamp<std::size_t>(
+          n / std::max(num_bins, histogram_min_chunk_size), 1, max_teams);
+      return HistogramStrategy::team_scratch;
+    }
+    return HistogramStrategy::atomic;
+  }
+}
+
+template <class ExecutionSpace, class KeysView, class BinOp, class Weights,
+          class CountsView>
+void histogram_with_strategy(ExecutionSpace const& exec,
+                             HistogramStrategy const strategy,
+                             std::size_t const num_chunks,
+                             KeysView const& keys, BinOp const& bin_op,
+                             Weights const& weights, CountsView const& counts) {
+  using count_type  = typename CountsView::non_const_value_type;
+  using policy_type = Kokkos::RangePolicy<ExecutionSpace>;
+
+  std::size_t const n        = keys.extent(0);
+  std::size_t const num_bins = counts.extent(0);
+  RadixSortBlocks const chunks{n, num_chunks};
+
+  switch (strategy) {
+    case HistogramStrategy::serial: {
+      Kokkos::parallel_for(
+          "Kokkos::histogram::Serial", policy_type(exec, 0, 1),
+          HistogramChunkFunctor<KeysView, BinOp, Weights,
+                                HistogramCountsAsPrivate<CountsView>>{
+              keys, bin_op, weights, {counts}, chunks, num_bins});
+      break;
+    }
+    case HistogramStrategy::private_bins: {
+      using private_view =
+          Kokkos::View<count_type**, Kokkos::LayoutRight,
+                       typename ExecutionSpace::memory_space>;
+      private_view bins(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                           "Kokkos::histogram::private_bins"),
+                        num_chunks, num_bins);
+      Kokkos::parallel_for(
+          "Kokkos::histogram::Private", policy_type(exec, 0, num_chunks),
+          HistogramChunkFunctor<KeysView, BinOp, Weights, private_view>{
+              keys, bin_op, weights, bins, chunks, num_bins});
+      Kokkos::parallel_for(
+          "Kokkos::histogram::Reduce",
+          policy_type(exec, 0,
+                      (num_bins + histogram_reduce_block_size - 1) /
+                          histogram_reduce_block_size),
+          HistogramReduceFunctor<private_view, CountsView>{bins, counts});
+      break;
+    }
+    case HistogramStrategy::team_scratch: {
+      using functor_type = HistogramTeamScratchFunctor<ExecutionSpace, KeysView,
+                                                       BinOp, Weights,
+                                                       CountsView>;
+      Kokkos::deep_copy(exec, counts, count_type(0));
+      Kokkos::TeamPolicy<ExecutionSpace> policy(exec, num_chunks,
+                                                Kokkos::AUTO);
+      policy.set_scratch_size(
+          0, Kokkos::PerTeam(functor_type::scratch_view::shmem_size(num_bins)));
+      Kokkos::parallel_for(
+          "Kokkos::histogram::TeamScratch", policy,
+          functor_type{keys, bin_op, weights, counts, chunks});
+      break;
+    }
+    case HistogramStrategy::atomic: {
+      Kokkos::deep_copy(exec, counts, count_type(0));
+      Kokkos::parallel_for(
+          "Kokkos::histogram::Atomic", policy_type(exec, 0, n),
+          HistogramAtomicFunctor<KeysView, BinOp, Weights, CountsView>{
+              keys, bin_op, weights, counts});
+      break;
+    }
+  }
+}
+
+template <class ExecutionSpace, class KeysView, class BinOp, class Weights,
+          class CountsView>
+void histogram_impl(ExecutionSpace const& exec, KeysView const& keys,
+                    BinOp const& bin_op, Weights const& weights,
+                    CountsView const& counts) {
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename KeysView::memory_space>::accessible &&
+          SpaceAccessibility<ExecutionSpace,
+                             typename CountsView::memory_space>::accessible,
+      "Kokkos::Experimental::histogram: execution space instance is not able "
+      "to access the memory space of the View arguments!");
+  static_assert(CountsView::rank == 1,
+                "Kokkos::Experimental::histogram: the counts must be a rank-1 "
+                "View.");
+
+  using count_type = typename CountsView::non_const_value_type;
+
+  if (counts.extent(0) == 0) return;
+
+  std::size_t num_chunks = 1;
+  HistogramStrategy const strategy =
+      histogram_strategy<ExecutionSpace, count_type>(
+          exec, keys.extent(0), counts.extent(0), num_chunks);
+  histogram_with_strategy(exec, strategy, num_chunks, keys, bin_op, weights,
+                          counts);
+}
+
+template <class TeamHandle, class KeysView, class BinOp, class Weights,
+          class CountsView>
+KOKKOS_FUNCTION void histogram_team_impl(TeamHandle const& team,
+                                         KeysView const& keys,
+                                         BinOp const& bin_op,
+                                         Weights const& weights,
+                                         CountsView const& counts) {
+  using count_type = typename CountsView::non_const_value_type;
+
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, counts.extent(0)),
+                       [&](std::size_t b) { counts(b) = 0; });
+  team.team_barrier();
+
+  bool const single_thread = team.team_size() == 1;
+  Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(team, keys.extent(0)), [&](std::size_t i) {
+        auto const bin = bin_op.bin(keys, i);
+        if (!histogram_is_valid_bin(bin, counts.extent(0))) return;
+        std::size_t const b = static_cast<std::size_t>(bin);
+        if (single_thread)
+          counts(b) += weights(i);
+        else
+          Kokkos::atomic_add(&counts(b), count_type(weights(i)));
+      });
+  team.team_barrier();
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,241 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HOST_MERGE_SORT_IMPL_HPP_
+#define KOKKOS_HOST_MERGE_SORT_IMPL_HPP_
+
+#include "Kokkos_ZipIteratorImpl.hpp"
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+
+namespace Kokkos {
+namespace Impl {
+
+// Smallest number of elements handed to a single thread by the parallel host
+// merge sort. Below that, the merge rounds cost more than they save and we
+// are better off calling std::sort directly.
+inline constexpr std::size_t host_merge_sort_min_chunk_size = 4096;
+
+// Merge path co-rank: returns how many elements of the sorted range
+// [a, a + na) precede output position diag in the stable merge of
+// [a, a + na) with the sorted range [b, b + nb).
+template <class IteratorA, class IteratorB, class Comparator>
+std::ptrdiff_t merge_path_co_rank(IteratorA a, std::ptrdiff_t na, IteratorB b,
+                                  std::ptrdiff_t nb, std::ptrdiff_t diag,
+                                  const Comparator& comp) {
+  std::ptrdiff_t lo = diag > nb ? diag - nb : 0;
+  std::ptrdiff_t hi = diag < na ? diag : na;
+  while (lo < hi) {
+    std::ptrdiff_t const mid = lo + (hi - lo) / 2;
+    if (comp(b[diag - mid - 1], a[mid]))
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo;
+}
+
+// The input is cut into num_chunks contiguous chunks. Chunk boundaries are
+// shared by all merge rounds: every merged run starts and ends on a chunk
+// boundary, so chunk k of the output always belongs to exactly one pair of
+// runs and each round keeps all num_chunks threads busy.
+struct HostMergeSortChunks {
+  std::size_t m_size;
+  std::size_t m_num_chunks;
+
+  std::size_t bound(std::size_t k) const {
+    return m_size * std::min(k, m_num_chunks) / m_num_chunks;
+  }
+};
+
+template <class Iterator, class Comparator, bool Stable>
+struct HostMergeSortChunkFunctor {
+  HostMergeSortChunks m_chunks;
+  Iterator m_first;
+  Comparator m_comp;
+
+  void operator()(std::size_t k) const {
+    auto const first = m_first + m_chunks.bound(k);
+    auto const last  = m_first + m_chunks.bound(k + 1);
+    if constexpr (Stable)
+      std::stable_sort(first, last, m_comp);
+    else
+      std::sort(first, last, m_comp);
+  }
+};
+
+template <class SrcIterator, class DstIterator, class Comparator>
+struct HostMergeRoundFunctor {
+  HostMergeSortChunks m_chunks;
+  std::size_t m_width;
+  SrcIterator m_src;
+  DstIterator m_dst;
+  Comparator m_comp;
+
+  void operator()(std::size_t k) const {
+    std::size_t const pair   = k / (2 * m_width) * (2 * m_width);
+    std::size_t const first  = m_chunks.bound(pair);
+    std::size_t const middle = m_chunks.bound(pair + m_width);
+    std::size_t const last   = m_chunks.bound(pair + 2 * m_width);
+
+    auto const a = m_src + first;
+    auto const b = m_src + middle;
+    std::ptrdiff_t const na = middle - first;
+    std::ptrdiff_t const nb = last - middle;
+
+    std::ptrdiff_t const d0 = m_chunks.bound(k) - first;
+    std::ptrdiff_t const d1 = m_chunks.bound(k + 1) - first;
+    std::ptrdiff_t const i0 = merge_path_co_rank(a, na, b, nb, d0, m_comp);
+    std::ptrdiff_t const i1 = merge_path_co_rank(a, na, b, nb, d1, m_comp);
+
+    std::merge(a + i0, a + i1, b + (d0 - i0), b + (d1 - i1),
+               m_dst + m_chunks.bound(k), m_comp);
+  }
+};
+
+template <class SrcIterator, class DstIterator>
+struct HostMergeCopyFunctor {
+  HostMergeSortChunks m_chunks;
+  SrcIterator m_src;
+  DstIterator m_dst;
+
+  void operator()(std::size_t k) const {
+    std::copy(m_src + m_chunks.bound(k), m_src + m_chunks.bound(k + 1),
+              m_dst + m_chunks.bound(k));
+  }
+};
+
+// Parallel merge sort for host execution spaces: every chunk is sorted
+// independently, then the sorted runs are merged pairwise, ping-ponging
+// between the input and a scratch buffer of the same length. Each merge is
+// split among the threads along its merge path so that all rounds are fully
+// parallel. The buffer is only touched if there is more than one chunk.
+template <bool Stable, class ExecutionSpace, class Iterator,
+          class BufferIterator, class Comparator>
+void host_merge_sort_rounds(const ExecutionSpace& exec, Iterator first,
+                            BufferIterator buffer_first,
+                            HostMergeSortChunks chunks,
+                            const Comparator& comp) {
+  using policy_type = Kokkos::RangePolicy<ExecutionSpace>;
+
+  Kokkos::parallel_for(
+      "Kokkos::Sort::HostMergeSort::SortChunks",
+      policy_type(exec, 0, chunks.m_num_chunks),
+      HostMergeSortChunkFunctor<Iterator, Comparator, Stable>{chunks, first,
+                                                              comp});
+
+  bool in_buffer = false;
+  for (std::size_t width = 1; width < chunks.m_num_chunks; width *= 2) {
+    if (in_buffer) {
+      Kokkos::parallel_for(
+          "Kokkos::Sort::HostMergeSort::MergeRound",
+          policy_type(exec, 0, chunks.m_num_chunks),
+          HostMergeRoundFunctor<BufferIterator, Iterator, Comparator>{
+              chunks, width, buffer_first, first, comp});
+    } else {
+      Kokkos::parallel_for(
+          "Kokkos::Sort::HostMergeSort::MergeRound",
+          policy_type(exec, 0, chunks.m_num_chunks),
+          HostMergeRoundFunctor<Iterator, BufferIterator, Comparator>{
+              chunks, width, first, buffer_first, comp});
+    }
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) {
+    Kokkos::parallel_for(
+        "Kokkos::Sort::HostMergeSort::CopyBack",
+        policy_type(exec, 0, chunks.m_num_chunks),
+        HostMergeCopyFunctor<BufferIterator, Iterator>{chunks, buffer_first,
+                                                       first});
+  }
+}
+
+template <class ViewType, class ExecutionSpace>
+auto make_host_merge_sort_buffer(const ExecutionSpace& exec,
+                                 const ViewType& view, std::size_t n) {
+  return Kokkos::View<typename ViewType::non_const_value_type*,
+                      typename ViewType::memory_space>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                         "Kokkos::Sort::HostMergeSort::buffer_" + view.label()),
+      n);
+}
+
+template <bool Stable = false, class ExecutionSpace, class DataType,
+          class... Properties, class Comparator>
+void host_merge_sort(const ExecutionSpace& exec,
+                     const Kokkos::View<DataType, Properties...>& view,
+                     std::size_t num_chunks, const Comparator& comp) {
+  namespace KE = ::Kokkos::Experimental;
+
+  using ViewType = Kokkos::View<DataType, Properties...>;
+  static_assert(ViewType::rank == 1,
+                "Kokkos::sort: currently only supports rank-1 Views.");
+  static_assert(SpaceAccessibility<HostSpace,
+                                   typename ViewType::memory_space>::accessible,
+                "Kokkos::Impl::host_merge_sort: the View must be accessible "
+                "from the host");
+
+  std::size_t const n = view.extent(0);
+  if (n <= 1) return;
+  HostMergeSortChunks const chunks{
+      n, std::clamp<std::size_t>(num_chunks, 1, n)};
+
+  auto buffer = make_host_merge_sort_buffer(exec, view,
+                                            chunks.m_num_chunks > 1 ? n : 0);
+  host_merge_sort_rounds<Stable>(exec, KE::begin(view), KE::begin(buffer),
+                                 chunks, comp);
+}
+
+// Sorts keys and any number of values views together. The views are zipped so
+// that every chunk sort and merge moves keys and values at once, without
+// going through a permutation.
+template <bool Stable = false, class ExecutionSpace, class Comparator,
+          class KeysView, class... ValuesViews>
+void host_merge_sort_by_key(const ExecutionSpace& exec,
+                            std::size_t num_chunks, const Comparator& comp,
+                            const KeysView& keys,
+                            const ValuesViews&... values) {
+  namespace KE = ::Kokkos::Experimental;
+
+  std::size_t const n = keys.extent(0);
+  if (n <= 1) return;
+  HostMergeSortChunks const chunks{
+      n, std::clamp<std::size_t>(num_chunks, 1, n)};
+  std::size_t const buffer_size = chunks.m_num_chunks > 1 ? n : 0;
+
+  auto keys_buffer = make_host_merge_sort_buffer(exec, keys, buffer_size);
+  auto values_buffers = std::make_tuple(
+      make_host_merge_sort_buffer(exec, values, buffer_size)...);
+
+  ZipIterator first(KE::begin(keys), KE::begin(values)...);
+  auto buffer_first = std::apply(
+      [&](const auto&... buffers) {
+        return ZipIterator(KE::begin(keys_buffer), KE::begin(buffers)...);
+      },
+      values_buffers);
+  host_merge_sort_rounds<Stable>(exec, first, buffer_first, chunks,
+                                 ZipKeyComparator<Comparator>{comp});
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
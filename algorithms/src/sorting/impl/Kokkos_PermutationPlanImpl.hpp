@@ -0,0 +1,108 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_PERMUTATION_PLAN_IMPL_HPP_
+#define KOKKOS_PERMUTATION_PLAN_IMPL_HPP_
+
+#include "Kokkos_CopyOpsForBinSortImpl.hpp"
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+// Contiguous scratch view with the same extents as values, except for the
+// first one which is len.
+template <class ExecutionSpace, class ValuesViewType>
+auto make_permute_buffer(const ExecutionSpace& exec,
+                         const ValuesViewType& values, std::size_t len) {
+  using buffer_type = Kokkos::View<typename ValuesViewType::data_type,
+                                   typename ValuesViewType::device_type>;
+  return buffer_type(
+      view_alloc(exec, WithoutInitializing,
+                 "Kokkos::SortImpl::BinSortFunctor::sorted_values"),
+      values.rank_dynamic > 0 ? len : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 1 ? values.extent(1) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 2 ? values.extent(2) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 3 ? values.extent(3) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 4 ? values.extent(4) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 5 ? values.extent(5) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 6 ? values.extent(6) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 7 ? values.extent(7)
+                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG);
+}
+
+template <class DstViewType, class SrcViewType>
+struct PermuteCopy {
+  using copy_op = CopyOp<DstViewType, SrcViewType>;
+
+  DstViewType m_dst;
+  SrcViewType m_src;
+
+  KOKKOS_INLINE_FUNCTION
+  void copy(std::size_t i_dst, std::size_t i_src) const {
+    copy_op::copy(m_dst, i_dst, m_src, i_src);
+  }
+};
+
+// Any number of copies done by the same kernel, one row of each at a time.
+template <class... PermuteCopies>
+struct FusedPermuteCopies {
+  KOKKOS_INLINE_FUNCTION
+  void copy(std::size_t, std::size_t) const {}
+};
+
+template <class PermuteCopy, class... PermuteCopies>
+struct FusedPermuteCopies<PermuteCopy, PermuteCopies...> {
+  PermuteCopy m_head;
+  FusedPermuteCopies<PermuteCopies...> m_tail;
+
+  FusedPermuteCopies(const PermuteCopy& head, const PermuteCopies&... tail)
+      : m_head(head), m_tail(tail...) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void copy(std::size_t i_dst, std::size_t i_src) const {
+    m_head.copy(i_dst, i_src);
+    m_tail.copy(i_dst, i_src);
+  }
+};
+
+template <class PermuteViewType, class Copies>
+struct FusedPermuteGatherFunctor {
+  typename PermuteViewType::const_type m_permute;
+  Copies m_copies;
+  std::ptrdiff_t m_src_offset;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(std::size_t i) const {
+    m_copies.copy(i, m_src_offset + m_permute(i));
+  }
+};
+
+template <class Copies>
+struct FusedPermuteCopyBackFunctor {
+  Copies m_copies;
+  std::ptrdiff_t m_dst_offset;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(std::size_t i) const { m_copies.copy(m_dst_offset + i, i); }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
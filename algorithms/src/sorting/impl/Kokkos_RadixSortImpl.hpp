@@ -0,0 +1,315 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_RADIX_SORT_IMPL_HPP_
+#define KOKKOS_RADIX_SORT_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+// Maps keys to unsigned integers whose natural order matches the order of
+// the keys: the sign bit of signed integers is flipped, and for IEEE floats
+// all bits of negative numbers are flipped while positive numbers only get
+// their sign bit set.
+template <class T, class Enable = void>
+struct RadixSortKeyTraits {
+  static constexpr bool is_sortable = false;
+};
+
+template <class T>
+struct RadixSortKeyTraits<
+    T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>> {
+  static constexpr bool is_sortable = true;
+  using bits_type                   = std::make_unsigned_t<T>;
+
+  KOKKOS_FUNCTION static bits_type to_bits(T key) {
+    if constexpr (std::is_signed_v<T>) {
+      constexpr bits_type sign_bit = bits_type(1) << (sizeof(T) * CHAR_BIT - 1);
+      return static_cast<bits_type>(static_cast<bits_type>(key) ^ sign_bit);
+    } else {
+      return key;
+    }
+  }
+};
+
+template <class T>
+struct RadixSortKeyTraits<
+    T, std::enable_if_t<std::is_floating_point_v<T> &&
+                        std::numeric_limits<T>::is_iec559 &&
+                        (sizeof(T) == 4 || sizeof(T) == 8)>> {
+  static constexpr bool is_sortable = true;
+  using bits_type =
+      std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+  KOKKOS_FUNCTION static bits_type to_bits(T key) {
+    constexpr bits_type sign_bit = bits_type(1) << (sizeof(T) * CHAR_BIT - 1);
+    auto const bits              = Kokkos::bit_cast<bits_type>(key);
+    return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+  }
+};
+
+template <class T>
+inline constexpr bool is_radix_sortable_v =
+    RadixSortKeyTraits<std::remove_cv_t<T>>::is_sortable;
+
+// Number of bits sorted per pass, i.e. 256 buckets.
+inline constexpr int radix_sort_digit_bits = 8;
+inline constexpr int radix_sort_num_buckets = 1 << radix_sort_digit_bits;
+
+// Smallest number of elements processed by a block. Each block owns one
+// column of the bucket counts, so this bounds the size of the counts array
+// relative to the number of keys.
+inline constexpr std::size_t radix_sort_min_block_size = 1024;
+
+// A rank-1 view together with a contiguous scratch buffer of the same
+// extent. Radix sort passes alternate between the two.
+template <class ViewType>
+struct RadixSortPingPong {
+  using value_type = typename ViewType::non_const_value_type;
+  using buffer_type =
+      Kokkos::View<value_type*, typename ViewType::memory_space>;
+
+  ViewType m_view;
+  buffer_type m_buffer;
+
+  template <class ExecutionSpace>
+  RadixSortPingPong(const ExecutionSpace& exec, const ViewType& view)
+      : m_view(view),
+        m_buffer(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                    "Kokkos::RadixSort::buffer_" +
+                                        view.label()),
+                 view.extent(0)) {}
+
+  KOKKOS_FUNCTION value_type read(bool from_buffer, std::size_t i) const {
+    return from_buffer ? m_buffer(i) : m_view(i);
+  }
+
+  KOKKOS_FUNCTION void move(bool from_buffer, std::size_t i,
+                            std::size_t j) const {
+    if (from_buffer)
+      m_view(j) = m_buffer(i);
+    else
+      m_buffer(j) = m_view(i);
+  }
+};
+
+// The values views that travel along with the keys.
+template <class... ViewTypes>
+struct RadixSortValues {
+  template <class ExecutionSpace>
+  RadixSortValues(const ExecutionSpace&, const ViewTypes&...) {}
+
+  KOKKOS_FUNCTION void move(bool, std::size_t, std::size_t) const {}
+};
+
+template <class ViewType, class... ViewTypes>
+struct RadixSortValues<ViewType, ViewTypes...> {
+  RadixSortPingPong<ViewType> m_head;
+  RadixSortValues<ViewTypes...> m_tail;
+
+  template <class ExecutionSpace>
+  RadixSortValues(const ExecutionSpace& exec, const ViewType& view,
+                  const ViewTypes&... views)
+      : m_head(exec, view), m_tail(exec, views...) {}
+
+  KOKKOS_FUNCTION void move(bool from_buffer, std::size_t i,
+                            std::size_t j) const {
+    m_head.move(from_buffer, i, j);
+    m_tail.move(from_buffer, i, j);
+  }
+};
+
+template <class KeysView>
+struct RadixSortVaryingBitsFunctor {
+  using key_traits =
+      RadixSortKeyTraits<typename KeysView::non_const_value_type>;
+  using bits_type = typename key_traits::bits_type;
+
+  KeysView m_keys;
+
+  KOKKOS_FUNCTION void operator()(std::size_t i, bits_type& varying) const {
+    varying |= key_traits::to_bits(m_keys(i)) ^ key_traits::to_bits(m_keys(0));
+  }
+};
+
+struct RadixSortBlocks {
+  std::size_t m_size;
+  std::size_t m_num_blocks;
+
+  KOKKOS_FUNCTION std::size_t bound(std::size_t b) const {
+    return m_size * b / m_num_blocks;
+  }
+};
+
+template <class KeysPingPong, class CountsView>
+struct RadixSortHistogramFunctor {
+  using key_traits = RadixSortKeyTraits<typename KeysPingPong::value_type>;
+
+  KeysPingPong m_keys;
+  CountsView m_counts;
+  RadixSortBlocks m_blocks;
+  int m_shift;
+  bool m_from_buffer;
+
+  KOKKOS_FUNCTION void operator()(std::size_t block) const {
+    std::size_t counts[radix_sort_num_buckets] = {};
+    for (std::size_t i = m_blocks.bound(block), e = m_blocks.bound(block + 1);
+         i < e; ++i) {
+      auto const bits = key_traits::to_bits(m_keys.read(m_from_buffer, i));
+      ++counts[(bits >> m_shift) & (radix_sort_num_buckets - 1)];
+    }
+    for (int d = 0; d < radix_sort_num_buckets; ++d) {
+      m_counts(d * m_blocks.m_num_blocks + block) = counts[d];
+    }
+  }
+};
+
+template <class CountsView>
+struct RadixSortOffsetsFunctor {
+  CountsView m_counts;
+
+  KOKKOS_FUNCTION void operator()(std::size_t i, std::size_t& update,
+                                  const bool final) const {
+    auto const count = m_counts(i);
+    if (final) m_counts(i) = update;
+    update += count;
+  }
+};
+
+template <class KeysPingPong, class Values, class CountsView>
+struct RadixSortScatterFunctor {
+  using key_traits = RadixSortKeyTraits<typename KeysPingPong::value_type>;
+
+  KeysPingPong m_keys;
+  Values m_values;
+  CountsView m_offsets;
+  RadixSortBlocks m_blocks;
+  int m_shift;
+  bool m_from_buffer;
+
+  KOKKOS_FUNCTION void operator()(std::size_t block) const {
+    std::size_t offsets[radix_sort_num_buckets];
+    for (int d = 0; d < radix_sort_num_buckets; ++d) {
+      offsets[d] = m_offsets(d * m_blocks.m_num_blocks + block);
+    }
+    for (std::size_t i = m_blocks.bound(block), e = m_blocks.bound(block + 1);
+         i < e; ++i) {
+      auto const bits = key_traits::to_bits(m_keys.read(m_from_buffer, i));
+      std::size_t const j =
+          offsets[(bits >> m_shift) & (radix_sort_num_buckets - 1)]++;
+      m_keys.move(m_from_buffer, i, j);
+      m_values.move(m_from_buffer, i, j);
+    }
+  }
+};
+
+template <class KeysPingPong, class Values>
+struct RadixSortCopyBackFunctor {
+  KeysPingPong m_keys;
+  Values m_values;
+
+  KOKKOS_FUNCTION void operator()(std::size_t i) const {
+    m_keys.move(true, i, i);
+    m_values.move(true, i, i);
+  }
+};
+
+// Stable LSD radix sort of keys, permuting any number of values views along
+// with them. Each pass splits the range into blocks, counts the digits of
+// every block, scans the counts in (digit, block) order and lets every block
+// scatter its elements in order. Digits that are the same for all keys are
+// skipped.
+//
+// A block is processed by a single thread with its digit counts in a local
+// array, one block per thread of the execution space. That suits the host
+// backends, which are the only ones that use it; the device backends keep
+// their vendor sorts or BinSort.
+template <class ExecutionSpace, class KeysView, class... ValuesViews>
+void radix_sort(const ExecutionSpace& exec, const KeysView& keys,
+                const ValuesViews&... values) {
+  using key_type = typename KeysView::non_const_value_type;
+  static_assert(is_radix_sortable_v<key_type>,
+                "Kokkos::Impl::radix_sort: keys must be integers or IEEE "
+                "floating point numbers");
+  using bits_type   = typename RadixSortKeyTraits<key_type>::bits_type;
+  using policy_type = Kokkos::RangePolicy<ExecutionSpace>;
+
+  std::size_t const n = keys.extent(0);
+  if (n <= 1) return;
+
+  bits_type varying = 0;
+  Kokkos::parallel_reduce("Kokkos::RadixSort::VaryingBits",
+                          policy_type(exec, 0, n),
+                          RadixSortVaryingBitsFunctor<KeysView>{keys},
+                          Kokkos::BOr<bits_type>(varying));
+  if (varying == 0) return;
+
+  RadixSortPingPong<KeysView> keys_pp(exec, keys);
+  RadixSortValues<ValuesViews...> values_pp(exec, values...);
+
+  RadixSortBlocks const blocks{
+      n, std::clamp<std::size_t>(
+             std::min<std::size_t>(exec.concurrency(),
+                                   n / radix_sort_min_block_size),
+             1, n)};
+  using counts_type =
+      Kokkos::View<std::size_t*, typename ExecutionSpace::memory_space>;
+  counts_type counts(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                        "Kokkos::RadixSort::counts"),
+                     radix_sort_num_buckets * blocks.m_num_blocks);
+
+  bool from_buffer = false;
+  for (int shift = 0; shift < int(sizeof(bits_type) * CHAR_BIT);
+       shift += radix_sort_digit_bits) {
+    if (((varying >> shift) & (radix_sort_num_buckets - 1)) == 0) continue;
+
+    Kokkos::parallel_for(
+        "Kokkos::RadixSort::Histogram",
+        policy_type(exec, 0, blocks.m_num_blocks),
+        RadixSortHistogramFunctor<decltype(keys_pp), counts_type>{
+            keys_pp, counts, blocks, shift, from_buffer});
+    Kokkos::parallel_scan("Kokkos::RadixSort::Offsets",
+                          policy_type(exec, 0, counts.extent(0)),
+                          RadixSortOffsetsFunctor<counts_type>{counts});
+    Kokkos::parallel_for(
+        "Kokkos::RadixSort::Scatter",
+        policy_type(exec, 0, blocks.m_num_blocks),
+        RadixSortScatterFunctor<decltype(keys_pp), decltype(values_pp),
+                                counts_type>{keys_pp, values_pp, counts,
+                                             blocks, shift, from_buffer});
+    from_buffer = !from_buffer;
+  }
+
+  if (from_buffer) {
+    Kokkos::parallel_for(
+        "Kokkos::RadixSort::CopyBack", policy_type(exec, 0, n),
+        RadixSortCopyBackFunctor<decltype(keys_pp), decltype(values_pp)>{
+            keys_pp, values_pp});
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,390 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SEGMENTED_SORT_IMPL_HPP_
+#define KOKKOS_SEGMENTED_SORT_IMPL_HPP_
+
+#include "../Kokkos_SortPublicAPI.hpp"
+#include "Kokkos_HostMergeSortImpl.hpp"
+#include "Kokkos_NestedSortImpl.hpp"
+#include "../Kokkos_BinOpsPublicAPI.hpp"
+#include "../Kokkos_BinSortPublicAPI.hpp"
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/impl/Kokkos_HelperPredicates.hpp>
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace Kokkos {
+namespace Impl {
+
+// Segments are bucketed by length on devices:
+// - bucket 0 holds the segments with at most one element, which are skipped,
+// - bucket 1 the segments of at most 2^segmented_sort_insertion_log2
+//   elements, sorted by insertion sort with one thread per segment,
+// - bucket 2 + k - segmented_sort_insertion_log2 - 1 the segments of length
+//   in (2^(k-1), 2^k], sorted by a team in scratch memory with a bitonic
+//   network, up to 2^segmented_sort_max_team_log2 elements,
+// - the last bucket the remaining long segments, each sorted by a call to
+//   Kokkos::sort.
+inline constexpr int segmented_sort_insertion_log2 = 5;
+inline constexpr int segmented_sort_max_team_log2  = 12;
+inline constexpr int segmented_sort_num_buckets =
+    segmented_sort_max_team_log2 - segmented_sort_insertion_log2 + 3;
+
+KOKKOS_INLINE_FUNCTION std::uint8_t segmented_sort_bucket(std::size_t len,
+                                                          int max_team_log2) {
+  if (len <= 1) return 0;
+  int log2 = segmented_sort_insertion_log2;
+  if (len <= (std::size_t(1) << log2)) return 1;
+  while ((std::size_t(1) << log2) < len) ++log2;
+  return log2 <= max_team_log2
+             ? std::uint8_t(log2 - segmented_sort_insertion_log2 + 1)
+             : std::uint8_t(segmented_sort_num_buckets - 1);
+}
+
+// Longest segments that fit in the level 0 team scratch memory.
+template <class ExecutionSpace, class ValueType>
+int segmented_sort_max_team_log2_for() {
+  std::size_t const max_bytes =
+      Kokkos::TeamPolicy<ExecutionSpace>::scratch_size_max(0);
+  int log2 = segmented_sort_max_team_log2;
+  while (log2 > segmented_sort_insertion_log2 &&
+         (std::size_t(1) << log2) * sizeof(ValueType) > max_bytes)
+    --log2;
+  return log2;
+}
+
+// The comparator used by the kernels, defaulting to operator<.
+template <class ValueType, class... MaybeComparator>
+struct SegmentedSortComparator {
+  using type =
+      Kokkos::Experimental::Impl::StdAlgoLessThanBinaryPredicate<ValueType>;
+};
+
+template <class ValueType, class Comparator>
+struct SegmentedSortComparator<ValueType, Comparator> {
+  using type = std::decay_t<Comparator>;
+};
+
+template <class OffsetsView, class BucketsView, class IdsView>
+struct SegmentedSortClassifyFunctor {
+  OffsetsView m_offsets;
+  BucketsView m_buckets;
+  IdsView m_ids;
+  int m_max_team_log2;
+
+  KOKKOS_FUNCTION void operator()(std::size_t i) const {
+    std::size_t const len = m_offsets(i + 1) - m_offsets(i);
+    m_buckets(i)          = segmented_sort_bucket(len, m_max_team_log2);
+    m_ids(i)              = i;
+  }
+};
+
+// Finds where each bucket starts in the segments sorted by bucket. Empty
+// buckets start where the next non-empty one does.
+template <class BucketsView, class BeginView>
+struct SegmentedSortBucketBeginFunctor {
+  BucketsView m_buckets;
+  BeginView m_begin;
+
+  KOKKOS_FUNCTION void operator()(std::size_t i) const {
+    std::size_t const n = m_buckets.extent(0);
+    int const prev      = i == 0 ? -1 : int(m_buckets(i - 1));
+    int const next      = i == n ? segmented_sort_num_buckets : m_buckets(i);
+    for (int b = prev + 1; b <= next; ++b) m_begin(b) = i;
+  }
+};
+
+template <class ValuesView, class OffsetsView, class IdsView, class Comparator>
+struct SegmentedSortInsertionFunctor {
+  ValuesView m_values;
+  OffsetsView m_offsets;
+  IdsView m_ids;
+  Comparator m_comp;
+
+  KOKKOS_FUNCTION void operator()(std::size_t k) const {
+    auto const segment      = m_ids(k);
+    std::size_t const first = m_offsets(segment);
+    std::size_t const last  = m_offsets(segment + 1);
+    for (std::size_t i = first + 1; i < last; ++i) {
+      auto const value = m_values(i);
+      std::size_t j    = i;
+      for (; j > first && m_comp(value, m_values(j - 1)); --j) {
+        m_values(j) = m_values(j - 1);
+      }
+      m_values(j) = value;
+    }
+  }
+};
+
+template <class ExecutionSpace, class ValuesView, class OffsetsView,
+          class IdsView, class Comparator>
+struct SegmentedSortTeamFunctor {
+  using member_type = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+  using scratch_view_type =
+      Kokkos::View<typename ValuesView::non_const_value_type*,
+                   typename ExecutionSpace::scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  ValuesView m_values;
+  OffsetsView m_offsets;
+  IdsView m_ids;
+  std::size_t m_first;
+  Comparator m_comp;
+
+  KOKKOS_FUNCTION void operator()(const member_type& team) const {
+    auto const segment      = m_ids(m_first + team.league_rank());
+    std::size_t const first = m_offsets(segment);
+    std::size_t const len   = m_offsets(segment + 1) - first;
+
+    scratch_view_type scratch(team.team_scratch(0), len);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, len),
+                         [&](std::size_t i) {
+                           scratch(i) = m_values(first + i);
+                         });
+    team.team_barrier();
+    Kokkos::Experimental::Impl::sort_nested_impl(
+        team, scratch, nullptr, m_comp,
+        Kokkos::Experimental::Impl::NestedRange<true>());
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, len),
+                         [&](std::size_t i) {
+                           m_values(first + i) = scratch(i);
+                         });
+  }
+};
+
+template <class OffsetsView, class IdsView, class RangesView>
+struct SegmentedSortGatherRangesFunctor {
+  OffsetsView m_offsets;
+  IdsView m_ids;
+  std::size_t m_first;
+  RangesView m_ranges;
+
+  KOKKOS_FUNCTION void operator()(std::size_t k) const {
+    auto const segment = m_ids(m_first + k);
+    m_ranges(k)        = Kokkos::make_pair(std::size_t(m_offsets(segment)),
+                                           std::size_t(m_offsets(segment + 1)));
+  }
+};
+
+// On the host, every thread sorts whole segments with std::sort. Segments
+// long enough to keep several threads busy are left out and counted, they
+// are sorted afterwards one at a time with the parallel Kokkos::sort.
+template <class ValuesView, class OffsetsView, class Comparator>
+struct SegmentedSortHostFunctor {
+  ValuesView m_values;
+  OffsetsView m_offsets;
+  Comparator m_comp;
+  std::size_t m_max_len;
+
+  void operator()(std::size_t i, std::size_t& num_long) const {
+    namespace KE            = ::Kokkos::Experimental;
+    std::size_t const first = m_offsets(i);
+    std::size_t const last  = m_offsets(i + 1);
+    if (last - first > m_max_len) {
+      ++num_long;
+      return;
+    }
+    std::sort(KE::begin(m_values) + first, KE::begin(m_values) + last, m_comp);
+  }
+};
+
+template <class ExecutionSpace, class ValuesView, class OffsetsView,
+          class... MaybeComparator>
+void sort_segmented_on_host(const ExecutionSpace& exec,
+                            const ValuesView& values,
+                            const OffsetsView& offsets,
+                            MaybeComparator&&... maybeComparator) {
+  using value_type      = typename ValuesView::non_const_value_type;
+  using comparator_type =
+      typename SegmentedSortComparator<value_type, MaybeComparator...>::type;
+
+  std::size_t const num_segments = offsets.extent(0) - 1;
+  std::size_t const max_len =
+      exec.concurrency() > 1 ? 2 * host_merge_sort_min_chunk_size
+                             : std::numeric_limits<std::size_t>::max();
+
+  std::size_t num_long = 0;
+  Kokkos::parallel_reduce(
+      "Kokkos::SortSegmented::SortOnHost",
+      Kokkos::RangePolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>>(
+          exec, 0, num_segments),
+      SegmentedSortHostFunctor<ValuesView, OffsetsView, comparator_type>{
+          values, offsets, comparator_type{maybeComparator...}, max_len},
+      num_long);
+
+  for (std::size_t i = 0; num_long > 0 && i < num_segments; ++i) {
+    std::size_t const first = offsets(i);
+    std::size_t const last  = offsets(i + 1);
+    if (last - first <= max_len) continue;
+    Kokkos::sort(exec, Kokkos::subview(values, Kokkos::make_pair(first, last)),
+                 maybeComparator...);
+    --num_long;
+  }
+}
+
+// Sorts the segments bucket by bucket, picking for every bucket the kernel
+// suited to the length of its segments. The segments are grouped by bucket
+// with a BinSort over their bucket index.
+template <class ExecutionSpace, class ValuesView, class OffsetsView,
+          class... MaybeComparator>
+void sort_segmented_on_device(const ExecutionSpace& exec,
+                              const ValuesView& values,
+                              const OffsetsView& offsets,
+                              MaybeComparator&&... maybeComparator) {
+  using value_type      = typename ValuesView::non_const_value_type;
+  using comparator_type =
+      typename SegmentedSortComparator<value_type, MaybeComparator...>::type;
+  using memory_space = typename ExecutionSpace::memory_space;
+  using buckets_type = Kokkos::View<std::uint8_t*, memory_space>;
+  using ids_type     = Kokkos::View<std::size_t*, memory_space>;
+  using begin_type   = Kokkos::View<std::size_t*, memory_space>;
+  using policy_type  = Kokkos::RangePolicy<ExecutionSpace>;
+
+  std::size_t const num_segments = offsets.extent(0) - 1;
+  int const max_team_log2 =
+      segmented_sort_max_team_log2_for<ExecutionSpace, value_type>();
+  comparator_type const comp{maybeComparator...};
+
+  buckets_type buckets(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                          "Kokkos::SortSegmented::buckets"),
+                       num_segments);
+  ids_type ids(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                  "Kokkos::SortSegmented::ids"),
+               num_segments);
+  Kokkos::parallel_for(
+      "Kokkos::SortSegmented::Classify", policy_type(exec, 0, num_segments),
+      SegmentedSortClassifyFunctor<OffsetsView, buckets_type, ids_type>{
+          offsets, buckets, ids, max_team_log2});
+  {
+    using bin_op_type = BinOp1D<buckets_type>;
+    BinSort<buckets_type, bin_op_type> sorter(
+        exec, buckets,
+        bin_op_type(segmented_sort_num_buckets, 0,
+                    segmented_sort_num_buckets - 1));
+    sorter.create_permute_vector(exec);
+    sorter.get_permutation_plan().apply(exec, buckets, ids);
+  }
+
+  begin_type begin(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                      "Kokkos::SortSegmented::bucket_begin"),
+                   segmented_sort_num_buckets + 1);
+  Kokkos::parallel_for(
+      "Kokkos::SortSegmented::BucketBegin",
+      policy_type(exec, 0, num_segments + 1),
+      SegmentedSortBucketBeginFunctor<buckets_type, begin_type>{buckets,
+                                                                begin});
+  auto const begin_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, begin);
+
+  if (begin_h(2) > begin_h(1)) {
+    Kokkos::parallel_for(
+        "Kokkos::SortSegmented::InsertionSort",
+        policy_type(exec, begin_h(1), begin_h(2)),
+        SegmentedSortInsertionFunctor<ValuesView, OffsetsView, ids_type,
+                                      comparator_type>{values, offsets, ids,
+                                                       comp});
+  }
+
+  using team_functor_type =
+      SegmentedSortTeamFunctor<ExecutionSpace, ValuesView, OffsetsView,
+                               ids_type, comparator_type>;
+  for (int log2 = segmented_sort_insertion_log2 + 1; log2 <= max_team_log2;
+       ++log2) {
+    int const b = log2 - segmented_sort_insertion_log2 + 1;
+    if (begin_h(b + 1) == begin_h(b)) continue;
+    std::size_t const scratch_size =
+        team_functor_type::scratch_view_type::shmem_size(std::size_t(1)
+                                                         << log2);
+    Kokkos::TeamPolicy<ExecutionSpace> policy(
+        exec, begin_h(b + 1) - begin_h(b), Kokkos::AUTO);
+    policy.set_scratch_size(0, Kokkos::PerTeam(scratch_size));
+    Kokkos::parallel_for(
+        "Kokkos::SortSegmented::TeamSort", policy,
+        team_functor_type{values, offsets, ids, begin_h(b), comp});
+  }
+
+  std::size_t const first_long = begin_h(segmented_sort_num_buckets - 1);
+  std::size_t const num_long   = num_segments - first_long;
+  if (num_long == 0) return;
+
+  using ranges_type =
+      Kokkos::View<Kokkos::pair<std::size_t, std::size_t>*, memory_space>;
+  ranges_type ranges(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                        "Kokkos::SortSegmented::long_ranges"),
+                     num_long);
+  Kokkos::parallel_for(
+      "Kokkos::SortSegmented::GatherLongRanges", policy_type(exec, 0, num_long),
+      SegmentedSortGatherRangesFunctor<OffsetsView, ids_type, ranges_type>{
+          offsets, ids, first_long, ranges});
+  auto const ranges_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, ranges);
+  for (std::size_t k = 0; k < num_long; ++k) {
+    Kokkos::sort(exec, Kokkos::subview(values, ranges_h(k)),
+                 maybeComparator...);
+  }
+}
+
+template <class ExecutionSpace, class ValuesView, class OffsetsView,
+          class... MaybeComparator>
+void sort_segmented_impl(const ExecutionSpace& exec, const ValuesView& values,
+                         const OffsetsView& offsets,
+                         MaybeComparator&&... maybeComparator) {
+  static_assert(ValuesView::rank == 1 && OffsetsView::rank == 1,
+                "Kokkos::sort_segmented: values and offsets must be rank-1 "
+                "Views.");
+  static_assert(std::is_integral_v<typename OffsetsView::value_type>,
+                "Kokkos::sort_segmented: offsets must be integers.");
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename ValuesView::memory_space>::accessible &&
+          SpaceAccessibility<ExecutionSpace,
+                             typename OffsetsView::memory_space>::accessible,
+      "Kokkos::sort_segmented: execution space instance is not able to "
+      "access the memory space of the View arguments!");
+
+  if (offsets.extent(0) <= 1) return;
+
+  if constexpr (better_off_calling_std_sort_v<ExecutionSpace>) {
+    sort_segmented_on_host(exec, values, offsets, maybeComparator...);
+  } else {
+    sort_segmented_on_device(exec, values, offsets, maybeComparator...);
+  }
+}
+
+// Matches compressed row storage graphs, Kokkos::StaticCrsGraph and
+// Kokkos::Crs among others, without depending on their headers.
+template <class T, class Enable = void>
+struct is_crs_graph_like : std::false_type {};
+
+template <class T>
+struct is_crs_graph_like<T, std::void_t<decltype(std::declval<T>().row_map),
+                                        decltype(std::declval<T>().entries)>>
+    : std::bool_constant<Kokkos::is_view_v<decltype(T::row_map)> &&
+                         Kokkos::is_view_v<decltype(T::entries)>> {};
+
+template <class T>
+inline constexpr bool is_crs_graph_like_v = is_crs_graph_like<T>::value;
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -17,6 +17,9 @@
 #ifndef KOKKOS_SORT_BY_KEY_FREE_FUNCS_IMPL_HPP_
 #define KOKKOS_SORT_BY_KEY_FREE_FUNCS_IMPL_HPP_
 
+#include "../Kokkos_SortPublicAPI.hpp"
+#include "Kokkos_HostMergeSortImpl.hpp"
+#include "Kokkos_RadixSortImpl.hpp"
 #include <Kokkos_Core.hpp>
 
 #if defined(KOKKOS_ENABLE_CUDA)
@@ -108,6 +111,34 @@ static_assert_is_admissible_to_kokkos_sort_by_key(const ViewType& /* view */) {
                 "LayoutRight, LayoutLeft or LayoutStride.");
 }
 
+template <class ExecutionSpace, class KeysType, class ValuesType>
+void check_sort_by_key_arguments(const ExecutionSpace& /* exec */,
+                                 const KeysType& keys,
+                                 const ValuesType& values) {
+  static_assert_is_admissible_to_kokkos_sort_by_key(keys);
+  static_assert_is_admissible_to_kokkos_sort_by_key(values);
+
+  static_assert(SpaceAccessibility<ExecutionSpace,
+                                   typename KeysType::memory_space>::accessible,
+                "Kokkos::sort: execution space instance is not able to access "
+                "the memory space of the keys View argument!");
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename ValuesType::memory_space>::accessible,
+      "Kokkos::sort: execution space instance is not able to access "
+      "the memory space of the values View argument!");
+
+  static_assert(KeysType::static_extent(0) == 0 ||
+                ValuesType::static_extent(0) == 0 ||
+                KeysType::static_extent(0) == ValuesType::static_extent(0));
+  if (values.size() != keys.size())
+    Kokkos::abort((std::string("values and keys extents must be the same. The "
+                               "values extent is ") +
+                   std::to_string(values.size()) + ", and the keys extent is " +
+                   std::to_string(keys.size()) + ".")
+                      .c_str());
+}
+
 // For the fallback implementation for sort_by_key using Kokkos::sort, we need
 // to consider if Kokkos::sort defers to the fallback implementation that copies
 // the array to the host and uses std::sort, see
@@ -136,6 +167,22 @@ void sort_by_key_cudathrust(
   thrust::sort_by_key(policy, keys_first, keys_last, values_first,
                       std::forward<MaybeComparator>(maybeComparator)...);
 }
+
+template <class KeysDataType, class... KeysProperties, class ValuesDataType,
+          class... ValuesProperties, class... MaybeComparator>
+void stable_sort_by_key_cudathrust(
+    const Kokkos::Cuda& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
+    MaybeComparator&&... maybeComparator) {
+  const auto policy = thrust::cuda::par.on(exec.cuda_stream());
+  auto keys_first   = ::Kokkos::Experimental::begin(keys);
+  auto keys_last    = ::Kokkos::Experimental::end(keys);
+  auto values_first = ::Kokkos::Experimental::begin(values);
+  thrust::stable_sort_by_key(
+      policy, keys_first, keys_last, values_first,
+      std::forward<MaybeComparator>(maybeComparator)...);
+}
 #endif
 
 #if defined(KOKKOS_ENABLE_ROCTHRUST)
@@ -156,6 +203,22 @@ void sort_by_key_rocthrust(
   thrust::sort_by_key(policy, keys_first, keys_last, values_first,
                       std::forward<MaybeComparator>(maybeComparator)...);
 }
+
+template <class KeysDataType, class... KeysProperties, class ValuesDataType,
+          class... ValuesProperties, class... MaybeComparator>
+void stable_sort_by_key_rocthrust(
+    const Kokkos::HIP& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
+    MaybeComparator&&... maybeComparator) {
+  const auto policy = thrust::hip::par.on(exec.hip_stream());
+  auto keys_first   = ::Kokkos::Experimental::begin(keys);
+  auto keys_last    = ::Kokkos::Experimental::end(keys);
+  auto values_first = ::Kokkos::Experimental::begin(values);
+  thrust::stable_sort_by_key(
+      policy, keys_first, keys_last, values_first,
+      std::forward<MaybeComparator>(maybeComparator)...);
+}
 #endif
 
 #if defined(KOKKOS_ENABLE_ONEDPL)
@@ -259,9 +322,27 @@ struct KeyComparisonFunctor {
   }
 };
 
-template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
-          class ValuesDataType, class... ValuesProperties,
-          class... MaybeComparator>
+// Breaks ties between equivalent keys by their original position, which makes
+// sorting the permutation stable.
+template <typename IndexComparator>
+struct StableIndexComparisonFunctor {
+  IndexComparator m_comparator;
+  KOKKOS_FUNCTION bool operator()(int i, int j) const {
+    return m_comparator(i, j) || (!m_comparator(j, i) && i < j);
+  }
+};
+
+template <bool Stable, typename IndexComparator>
+auto make_index_comparator(const IndexComparator& comparator) {
+  if constexpr (Stable)
+    return StableIndexComparisonFunctor<IndexComparator>{comparator};
+  else
+    return comparator;
+}
+
+template <bool Stable = false, class ExecutionSpace, class KeysDataType,
+          class... KeysProperties, class ValuesDataType,
+          class... ValuesProperties, class... MaybeComparator>
 void sort_by_key_via_sort(
     const ExecutionSpace& exec,
     const Kokkos::View<KeysDataType, KeysProperties...>& keys,
@@ -298,14 +379,17 @@ void sort_by_key_via_sort(
 
     if constexpr (sizeof...(MaybeComparator) == 0) {
       Kokkos::sort(host_exec, host_permute,
-                   LessFunctor<decltype(host_keys)>{host_keys});
+                   make_index_comparator<Stable>(
+                       LessFunctor<decltype(host_keys)>{host_keys}));
     } else {
       auto keys_comparator =
           std::get<0>(std::tuple<MaybeComparator...>(maybeComparator...));
       Kokkos::sort(
           host_exec, host_permute,
-          KeyComparisonFunctor<decltype(host_keys), decltype(keys_comparator)>{
-              host_keys, keys_comparator});
+          make_index_comparator<Stable>(
+              KeyComparisonFunctor<decltype(host_keys),
+                                   decltype(keys_comparator)>{
+                  host_keys, keys_comparator}));
     }
     host_exec.fence("Kokkos::Impl::sort_by_key_via_sort: after host sort");
     Kokkos::deep_copy(exec, permute, host_permute);
@@ -315,30 +399,33 @@ void sort_by_key_via_sort(
     auto* raw_keys_in_comparator = keys.data();
     auto stride                  = keys.stride(0);
     if constexpr (sizeof...(MaybeComparator) == 0) {
-      Kokkos::sort(
-          exec, permute, KOKKOS_LAMBDA(int i, int j) {
-            return raw_keys_in_comparator[i * stride] <
-                   raw_keys_in_comparator[j * stride];
-          });
+      Kokkos::sort(exec, permute,
+                   make_index_comparator<Stable>(KOKKOS_LAMBDA(int i, int j) {
+                     return raw_keys_in_comparator[i * stride] <
+                            raw_keys_in_comparator[j * stride];
+                   }));
     } else {
       auto keys_comparator =
           std::get<0>(std::tuple<MaybeComparator...>(maybeComparator...));
-      Kokkos::sort(
-          exec, permute, KOKKOS_LAMBDA(int i, int j) {
-            return keys_comparator(raw_keys_in_comparator[i * stride],
-                                   raw_keys_in_comparator[j * stride]);
-          });
+      Kokkos::sort(exec, permute,
+                   make_index_comparator<Stable>(KOKKOS_LAMBDA(int i, int j) {
+                     return keys_comparator(raw_keys_in_comparator[i * stride],
+                                            raw_keys_in_comparator[j * stride]);
+                   }));
     }
 #else
     if constexpr (sizeof...(MaybeComparator) == 0) {
-      Kokkos::sort(exec, permute, LessFunctor<decltype(keys)>{keys});
+      Kokkos::sort(
+          exec, permute,
+          make_index_comparator<Stable>(LessFunctor<decltype(keys)>{keys}));
     } else {
       auto keys_comparator =
           std::get<0>(std::tuple<MaybeComparator...>(maybeComparator...));
       Kokkos::sort(
           exec, permute,
-          KeyComparisonFunctor<decltype(keys), decltype(keys_comparator)>{
-              keys, keys_comparator});
+          make_index_comparator<Stable>(
+              KeyComparisonFunctor<decltype(keys), decltype(keys_comparator)>{
+                  keys, keys_comparator}));
     }
 #endif
   }
@@ -347,6 +434,34 @@ void sort_by_key_via_sort(
   applyPermutation(exec, permute, values);
 }
 
+// Host execution spaces sort the keys and values directly instead of going
+// through a permutation: integer and floating point keys without a
+// comparator are radix sorted, anything else is merge sorted with all the
+// views zipped together. Both are stable.
+template <class ExecutionSpace, class ComparatorType, class KeysView,
+          class... ValuesViews>
+void sort_by_key_on_host_with_comparator(const ExecutionSpace& exec,
+                                         const ComparatorType& comparator,
+                                         const KeysView& keys,
+                                         const ValuesViews&... values) {
+  std::size_t const num_chunks =
+      std::min<std::size_t>(exec.concurrency(),
+                            keys.extent(0) / host_merge_sort_min_chunk_size);
+  host_merge_sort_by_key<true>(exec, num_chunks, comparator, keys, values...);
+}
+
+template <class ExecutionSpace, class KeysView, class... ValuesViews>
+void sort_by_key_on_host(const ExecutionSpace& exec, const KeysView& keys,
+                         const ValuesViews&... values) {
+  if constexpr (is_radix_sortable_v<typename KeysView::non_const_value_type>) {
+    if (keys.extent(0) >= radix_sort_min_block_size) {
+      radix_sort(exec, keys, values...);
+      return;
+    }
+  }
+  sort_by_key_on_host_with_comparator(exec, std::less<>{}, keys, values...);
+}
+
 // ------------------------------------------------------
 //
 // specialize cases for sorting by key without comparator
@@ -405,7 +520,11 @@ sort_by_key_device_view_without_comparator(
     const ExecutionSpace& exec,
     const Kokkos::View<KeysDataType, KeysProperties...>& keys,
     const Kokkos::View<ValuesDataType, ValuesProperties...>& values) {
-  sort_by_key_via_sort(exec, keys, values);
+  if constexpr (better_off_calling_std_sort_v<ExecutionSpace>) {
+    sort_by_key_on_host(exec, keys, values);
+  } else {
+    sort_by_key_via_sort(exec, keys, values);
+  }
 }
 
 // ---------------------------------------------------
@@ -471,7 +590,94 @@ sort_by_key_device_view_with_comparator(
     const Kokkos::View<KeysDataType, KeysProperties...>& keys,
     const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
     const ComparatorType& comparator) {
-  sort_by_key_via_sort(exec, keys, values, comparator);
+  if constexpr (better_off_calling_std_sort_v<ExecutionSpace>) {
+    sort_by_key_on_host_with_comparator(exec, comparator, keys, values);
+  } else {
+    sort_by_key_via_sort(exec, keys, values, comparator);
+  }
+}
+
+// ----------------------------------------------------------
+//
+// specialize cases for stable sorting by key
+//
+// ----------------------------------------------------------
+
+#if defined(KOKKOS_ENABLE_CUDA)
+template <class KeysDataType, class... KeysProperties, class ValuesDataType,
+          class... ValuesProperties, class... MaybeComparator>
+void stable_sort_by_key_device_view(
+    const Kokkos::Cuda& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
+    const MaybeComparator&... maybeComparator) {
+  stable_sort_by_key_cudathrust(exec, keys, values, maybeComparator...);
+}
+#endif
+
+#if defined(KOKKOS_ENABLE_ROCTHRUST)
+template <class KeysDataType, class... KeysProperties, class ValuesDataType,
+          class... ValuesProperties, class... MaybeComparator>
+void stable_sort_by_key_device_view(
+    const Kokkos::HIP& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
+    const MaybeComparator&... maybeComparator) {
+  stable_sort_by_key_rocthrust(exec, keys, values, maybeComparator...);
+}
+#endif
+
+// fallback case
+template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
+          class ValuesDataType, class... ValuesProperties,
+          class... MaybeComparator>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value>
+stable_sort_by_key_device_view(
+    const ExecutionSpace& exec,
+    const Kokkos::View<KeysDataType, KeysProperties...>& keys,
+    const Kokkos::View<ValuesDataType, ValuesProperties...>& values,
+    const MaybeComparator&... maybeComparator) {
+  static_assert(sizeof...(MaybeComparator) <= 1);
+  if constexpr (sizeof...(MaybeComparator) == 1) {
+    if constexpr (better_off_calling_std_sort_v<ExecutionSpace>) {
+      sort_by_key_on_host_with_comparator(exec, maybeComparator..., keys,
+                                          values);
+    } else {
+      sort_by_key_via_sort<true>(exec, keys, values, maybeComparator...);
+    }
+  } else if constexpr (better_off_calling_std_sort_v<ExecutionSpace>) {
+    sort_by_key_on_host(exec, keys, values);
+  } else {
+    sort_by_key_via_sort<true>(exec, keys, values);
+  }
+}
+
+// Sorts the keys together with several values views. Host execution spaces
+// move all the views at once. Otherwise the keys are sorted along with a
+// permutation that is then applied to every values view.
+template <bool Stable, class ExecutionSpace, class KeysView,
+          class... ValuesViews>
+void sort_by_key_multiple_values(const ExecutionSpace& exec,
+                                 const KeysView& keys,
+                                 const ValuesViews&... values) {
+  if constexpr (better_off_calling_std_sort_v<ExecutionSpace>) {
+    sort_by_key_on_host(exec, keys, values...);
+  } else {
+    Kokkos::View<unsigned int*, ExecutionSpace> permute(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                           "Kokkos::sort_by_key_multiple_values::permute"),
+        keys.extent(0));
+    Kokkos::parallel_for(
+        "Kokkos::sort_by_key_multiple_values::iota",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, keys.extent(0)),
+        IotaFunctor<decltype(permute)>{permute});
+    if constexpr (Stable) {
+      stable_sort_by_key_device_view(exec, keys, permute);
+    } else {
+      sort_by_key_device_view_without_comparator(exec, keys, permute);
+    }
+    (applyPermutation(exec, permute, values), ...);
+  }
 }
 
 #undef KOKKOS_IMPL_ONEDPL_HAS_SORT_BY_KEY
@@ -19,6 +19,8 @@
 
 #include "../Kokkos_BinOpsPublicAPI.hpp"
 #include "../Kokkos_BinSortPublicAPI.hpp"
+#include "Kokkos_HostMergeSortImpl.hpp"
+#include "Kokkos_RadixSortImpl.hpp"
 #include <std_algorithms/Kokkos_BeginEnd.hpp>
 #include <std_algorithms/Kokkos_Copy.hpp>
 #include <Kokkos_Core.hpp>
@@ -199,6 +201,43 @@ void sort_via_binsort(const ExecutionSpace& exec,
   bin_sort.sort(exec, view);
 }
 
+// Entry point used by Kokkos::sort for host execution spaces. Integer and
+// floating point keys without a comparator are radix sorted. Otherwise we
+// fall back to std::sort unless the view is large enough to give every thread
+// at least host_merge_sort_min_chunk_size elements.
+template <class ExecutionSpace, class DataType, class... Properties,
+          class... MaybeComparator>
+void sort_on_host(const ExecutionSpace& exec,
+                  const Kokkos::View<DataType, Properties...>& view,
+                  MaybeComparator&&... maybeComparator) {
+  static_assert(sizeof...(MaybeComparator) <= 1);
+  using value_type =
+      typename Kokkos::View<DataType, Properties...>::non_const_value_type;
+
+  if constexpr (sizeof...(MaybeComparator) == 0 &&
+                is_radix_sortable_v<value_type>) {
+    if (view.extent(0) >= radix_sort_min_block_size) {
+      radix_sort(exec, view);
+      return;
+    }
+  }
+
+  std::size_t const num_chunks =
+      std::min<std::size_t>(exec.concurrency(),
+                            view.extent(0) / host_merge_sort_min_chunk_size);
+
+  if (num_chunks < 2) {
+    exec.fence("Kokkos::sort: before calling std::sort");
+    auto first = ::Kokkos::Experimental::begin(view);
+    auto last  = ::Kokkos::Experimental::end(view);
+    std::sort(first, last, std::forward<MaybeComparator>(maybeComparator)...);
+  } else if constexpr (sizeof...(MaybeComparator) == 0) {
+    host_merge_sort(exec, view, num_chunks, std::less<>{});
+  } else {
+    host_merge_sort(exec, view, num_chunks, maybeComparator...);
+  }
+}
+
 #if defined(KOKKOS_ENABLE_CUDA)
 template <class DataType, class... Properties, class... MaybeComparator>
 void sort_cudathrust(const Cuda& space,
@@ -0,0 +1,162 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_ZIP_ITERATOR_IMPL_HPP_
+#define KOKKOS_ZIP_ITERATOR_IMPL_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+namespace Kokkos {
+namespace Impl {
+
+// Proxy reference of ZipIterator. Assigning to it assigns through to all the
+// zipped elements, so that the standard algorithms move whole tuples around.
+template <class... ValueTypes>
+class ZipReference {
+ public:
+  using value_type = std::tuple<ValueTypes...>;
+
+  explicit ZipReference(ValueTypes&... refs) : m_refs(refs...) {}
+
+  ZipReference(const ZipReference&) = default;
+
+  const ZipReference& operator=(const ZipReference& other) const {
+    assign(other.m_refs, std::index_sequence_for<ValueTypes...>{});
+    return *this;
+  }
+
+  const ZipReference& operator=(const value_type& other) const {
+    assign(other, std::index_sequence_for<ValueTypes...>{});
+    return *this;
+  }
+
+  operator value_type() const { return value_type(m_refs); }
+
+  friend void swap(ZipReference a, ZipReference b) {
+    value_type tmp = a;
+    a              = b;
+    b              = tmp;
+  }
+
+  // The key is always the first zipped element.
+  const auto& key() const { return std::get<0>(m_refs); }
+
+ private:
+  template <class Tuple, std::size_t... Is>
+  void assign(const Tuple& other, std::index_sequence<Is...>) const {
+    ((std::get<Is>(m_refs) = std::get<Is>(other)), ...);
+  }
+
+  std::tuple<ValueTypes&...> m_refs;
+};
+
+// Random access iterator over several ranges of the same length that
+// dereferences to a tuple of their elements. Only meant for sorting on the
+// host, where it lets the merge sort permute keys and values in one pass.
+template <class... Iterators>
+class ZipIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type =
+      std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+  using difference_type = std::ptrdiff_t;
+  using reference =
+      ZipReference<typename std::iterator_traits<Iterators>::value_type...>;
+  using pointer = void;
+
+  ZipIterator() = default;
+  explicit ZipIterator(Iterators... its) : m_its(its...) {}
+
+  reference operator*() const { return (*this)[0]; }
+
+  reference operator[](difference_type n) const {
+    return std::apply([n](auto... its) { return reference(its[n]...); },
+                      m_its);
+  }
+
+  ZipIterator& operator+=(difference_type n) {
+    std::apply([n](auto&... its) { ((its += n), ...); }, m_its);
+    return *this;
+  }
+  ZipIterator& operator-=(difference_type n) { return *this += -n; }
+  ZipIterator& operator++() { return *this += 1; }
+  ZipIterator& operator--() { return *this -= 1; }
+  ZipIterator operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  ZipIterator operator--(int) {
+    auto tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  ZipIterator operator+(difference_type n) const {
+    auto it = *this;
+    return it += n;
+  }
+  friend ZipIterator operator+(difference_type n, ZipIterator it) {
+    return it += n;
+  }
+  ZipIterator operator-(difference_type n) const {
+    auto it = *this;
+    return it -= n;
+  }
+  difference_type operator-(const ZipIterator& other) const {
+    return std::get<0>(m_its) - std::get<0>(other.m_its);
+  }
+
+  bool operator==(const ZipIterator& other) const {
+    return std::get<0>(m_its) == std::get<0>(other.m_its);
+  }
+  bool operator!=(const ZipIterator& other) const { return !(*this == other); }
+  bool operator<(const ZipIterator& other) const { return *this - other < 0; }
+  bool operator>(const ZipIterator& other) const { return other < *this; }
+  bool operator<=(const ZipIterator& other) const { return !(other < *this); }
+  bool operator>=(const ZipIterator& other) const { return !(*this < other); }
+
+ private:
+  std::tuple<Iterators...> m_its;
+};
+
+// Compares zipped elements, be it proxies or values, by their keys only.
+template <class Comparator>
+struct ZipKeyComparator {
+  Comparator m_comp;
+
+  template <class... Ts>
+  static const auto& key(const ZipReference<Ts...>& ref) {
+    return ref.key();
+  }
+  template <class... Ts>
+  static const auto& key(const std::tuple<Ts...>& value) {
+    return std::get<0>(value);
+  }
+
+  template <class A, class B>
+  bool operator()(const A& a, const B& b) const {
+    return m_comp(key(a), key(b));
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
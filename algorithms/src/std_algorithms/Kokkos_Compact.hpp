@@ -0,0 +1,173 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_COMPACT_HPP
+#define KOKKOS_STD_ALGORITHMS_COMPACT_HPP
+
+#include "impl/Kokkos_Compact.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+//
+// compact copies every element of [first, last) to one of the outputs
+// d_firsts..., keeping the order of the elements, in a single pass.
+// If the selector returns a bool, true picks the first output and false
+// the second one (if any). Otherwise it returns the index of the output,
+// and elements with an index out of range are dropped.
+// The number of elements written to each output is returned, or, to avoid
+// waiting for the result on the host, written to a counts view.
+//
+
+//
+// overload set accepting execution space
+//
+template <typename ExecutionSpace, typename InputIteratorType,
+          typename SelectorType, typename... OutputIteratorTypes,
+          std::enable_if_t<
+              Impl::are_iterators_v<InputIteratorType,
+                                    OutputIteratorTypes...> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+::Kokkos::Array<std::size_t, sizeof...(OutputIteratorTypes)> compact(
+    const ExecutionSpace& ex, InputIteratorType first, InputIteratorType last,
+    SelectorType selector, OutputIteratorTypes... d_firsts) {
+  return Impl::compact_exespace_impl("Kokkos::compact_iterator_api_default",
+                                     ex, first, last, std::move(selector),
+                                     d_firsts...);
+}
+
+template <typename ExecutionSpace, typename InputIteratorType,
+          typename SelectorType, typename... OutputIteratorTypes,
+          std::enable_if_t<
+              Impl::are_iterators_v<InputIteratorType,
+                                    OutputIteratorTypes...> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+::Kokkos::Array<std::size_t, sizeof...(OutputIteratorTypes)> compact(
+    const std::string& label, const ExecutionSpace& ex, InputIteratorType first,
+    InputIteratorType last, SelectorType selector,
+    OutputIteratorTypes... d_firsts) {
+  return Impl::compact_exespace_impl(label, ex, first, last,
+                                     std::move(selector), d_firsts...);
+}
+
+template <typename ExecutionSpace, typename InputIteratorType,
+          typename SelectorType, typename CountsDataType,
+          typename... CountsProperties, typename... OutputIteratorTypes,
+          std::enable_if_t<
+              Impl::are_iterators_v<InputIteratorType,
+                                    OutputIteratorTypes...> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+void compact(const ExecutionSpace& ex, InputIteratorType first,
+             InputIteratorType last, SelectorType selector,
+             const ::Kokkos::View<CountsDataType, CountsProperties...>& counts,
+             OutputIteratorTypes... d_firsts) {
+  Impl::compact_counts_view_exespace_impl(
+      "Kokkos::compact_iterator_api_default", ex, first, last,
+      std::move(selector), counts, d_firsts...);
+}
+
+template <typename ExecutionSpace, typename InputIteratorType,
+          typename SelectorType, typename CountsDataType,
+          typename... CountsProperties, typename... OutputIteratorTypes,
+          std::enable_if_t<
+              Impl::are_iterators_v<InputIteratorType,
+                                    OutputIteratorTypes...> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+void compact(const std::string& label, const ExecutionSpace& ex,
+             InputIteratorType first, InputIteratorType last,
+             SelectorType selector,
+             const ::Kokkos::View<CountsDataType, CountsProperties...>& counts,
+             OutputIteratorTypes... d_firsts) {
+  Impl::compact_counts_view_exespace_impl(label, ex, first, last,
+                                          std::move(selector), counts,
+                                          d_firsts...);
+}
+
+template <typename ExecutionSpace, typename DataType, typename... Properties,
+          typename SelectorType, typename... DestViewTypes,
+          std::enable_if_t<(::Kokkos::is_view_v<DestViewTypes> && ...) &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+::Kokkos::Array<std::size_t, sizeof...(DestViewTypes)> compact(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType, Properties...>& source,
+    SelectorType selector, const DestViewTypes&... dests) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  (Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dests), ...);
+  return Impl::compact_exespace_impl("Kokkos::compact_view_api_default", ex,
+                                     cbegin(source), cend(source),
+                                     std::move(selector), begin(dests)...);
+}
+
+template <typename ExecutionSpace, typename DataType, typename... Properties,
+          typename SelectorType, typename... DestViewTypes,
+          std::enable_if_t<(::Kokkos::is_view_v<DestViewTypes> && ...) &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+::Kokkos::Array<std::size_t, sizeof...(DestViewTypes)> compact(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType, Properties...>& source,
+    SelectorType selector, const DestViewTypes&... dests) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  (Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dests), ...);
+  return Impl::compact_exespace_impl(label, ex, cbegin(source), cend(source),
+                                     std::move(selector), begin(dests)...);
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename InputIteratorType,
+          typename SelectorType, typename... OutputIteratorTypes,
+          std::enable_if_t<
+              Impl::are_iterators_v<InputIteratorType,
+                                    OutputIteratorTypes...> &&
+                  ::Kokkos::is_team_handle_v<TeamHandleType>,
+              int> = 0>
+KOKKOS_FUNCTION ::Kokkos::Array<std::size_t, sizeof...(OutputIteratorTypes)>
+compact(const TeamHandleType& teamHandle, InputIteratorType first,
+        InputIteratorType last, SelectorType selector,
+        OutputIteratorTypes... d_firsts) {
+  return Impl::compact_team_impl(teamHandle, first, last, std::move(selector),
+                                 d_firsts...);
+}
+
+template <typename TeamHandleType, typename DataType, typename... Properties,
+          typename SelectorType, typename... DestViewTypes,
+          std::enable_if_t<(::Kokkos::is_view_v<DestViewTypes> && ...) &&
+                               ::Kokkos::is_team_handle_v<TeamHandleType>,
+                           int> = 0>
+KOKKOS_FUNCTION ::Kokkos::Array<std::size_t, sizeof...(DestViewTypes)>
+compact(const TeamHandleType& teamHandle,
+        const ::Kokkos::View<DataType, Properties...>& source,
+        SelectorType selector, const DestViewTypes&... dests) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  (Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dests), ...);
+  return Impl::compact_team_impl(teamHandle, cbegin(source), cend(source),
+                                 std::move(selector), begin(dests)...);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
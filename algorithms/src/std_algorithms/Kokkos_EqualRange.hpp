@@ -0,0 +1,178 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_EQUAL_RANGE_HPP
+#define KOKKOS_STD_ALGORITHMS_EQUAL_RANGE_HPP
+
+#include "impl/Kokkos_BinarySearch.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+//
+// overload set accepting execution space
+//
+template <typename ExecutionSpace, typename IteratorType, typename ValueType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const ExecutionSpace& ex, IteratorType first, IteratorType last,
+    const ValueType& value) {
+  return Impl::equal_range_exespace_impl(
+      "Kokkos::equal_range_iterator_api_default", ex, first, last, value);
+}
+
+template <typename ExecutionSpace, typename IteratorType, typename ValueType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, const ValueType& value) {
+  return Impl::equal_range_exespace_impl(label, ex, first, last, value);
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ValueType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto equal_range(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  return Impl::equal_range_exespace_impl("Kokkos::equal_range_view_api_default",
+                                         ex, begin(view), end(view), value);
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ValueType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto equal_range(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  return Impl::equal_range_exespace_impl(label, ex, begin(view), end(view),
+                                         value);
+}
+
+template <typename ExecutionSpace, typename IteratorType, typename ValueType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const ExecutionSpace& ex, IteratorType first, IteratorType last,
+    const ValueType& value, ComparatorType comp) {
+  return Impl::equal_range_exespace_impl(
+      "Kokkos::equal_range_iterator_api_default", ex, first, last, value,
+      std::move(comp));
+}
+
+template <typename ExecutionSpace, typename IteratorType, typename ValueType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, const ValueType& value, ComparatorType comp) {
+  return Impl::equal_range_exespace_impl(label, ex, first, last, value,
+                                         std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ValueType, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto equal_range(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  return Impl::equal_range_exespace_impl("Kokkos::equal_range_view_api_default",
+                                         ex, begin(view), end(view), value,
+                                         std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ValueType, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto equal_range(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  return Impl::equal_range_exespace_impl(label, ex, begin(view), end(view),
+                                         value, std::move(comp));
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename IteratorType, typename ValueType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_team_handle_v<TeamHandleType>,
+                           int> = 0>
+KOKKOS_FUNCTION ::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    const ValueType& value) {
+  return Impl::equal_range_team_impl(teamHandle, first, last, value);
+}
+
+template <typename TeamHandleType, typename DataType, typename... Properties,
+          typename ValueType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto equal_range(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  return Impl::equal_range_team_impl(teamHandle, begin(view), end(view),
+                                     value);
+}
+
+template <typename TeamHandleType, typename IteratorType, typename ValueType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_team_handle_v<TeamHandleType>,
+                           int> = 0>
+KOKKOS_FUNCTION ::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    const ValueType& value, ComparatorType comp) {
+  return Impl::equal_range_team_impl(teamHandle, first, last, value,
+                                     std::move(comp));
+}
+
+template <typename TeamHandleType, typename DataType, typename... Properties,
+          typename ValueType, typename ComparatorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto equal_range(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  return Impl::equal_range_team_impl(teamHandle, begin(view), end(view),
+                                     value, std::move(comp));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,253 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_LOWER_BOUND_BATCH_HPP
+#define KOKKOS_STD_ALGORITHMS_LOWER_BOUND_BATCH_HPP
+
+#include "impl/Kokkos_LowerBoundBatch.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+//
+// lower_bound_batch looks up every query of [q_first, q_last) in the sorted
+// range [first, last) and writes to d_first the position of its lower bound,
+// i.e. the same as lower_bound(first, last, query) - first.
+// Large tables are searched through a cache-friendly (Eytzinger) copy.
+//
+
+//
+// overload set accepting execution space
+//
+template <typename ExecutionSpace, typename IteratorType,
+          typename QueryIteratorType, typename OutputIteratorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType,
+                                                 QueryIteratorType,
+                                                 OutputIteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+OutputIteratorType lower_bound_batch(const ExecutionSpace& ex,
+                                     IteratorType first, IteratorType last,
+                                     QueryIteratorType q_first,
+                                     QueryIteratorType q_last,
+                                     OutputIteratorType d_first) {
+  return Impl::lower_bound_batch_exespace_impl(
+      "Kokkos::lower_bound_batch_iterator_api_default", ex, first, last,
+      q_first, q_last, d_first);
+}
+
+template <typename ExecutionSpace, typename IteratorType,
+          typename QueryIteratorType, typename OutputIteratorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType,
+                                                 QueryIteratorType,
+                                                 OutputIteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+OutputIteratorType lower_bound_batch(const std::string& label,
+                                     const ExecutionSpace& ex,
+                                     IteratorType first, IteratorType last,
+                                     QueryIteratorType q_first,
+                                     QueryIteratorType q_last,
+                                     OutputIteratorType d_first) {
+  return Impl::lower_bound_batch_exespace_impl(label, ex, first, last, q_first,
+                                               q_last, d_first);
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto lower_bound_batch(const ExecutionSpace& ex,
+                       const ::Kokkos::View<DataType1, Properties1...>& view,
+                       const ::Kokkos::View<DataType2, Properties2...>& queries,
+                       const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(queries);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  return Impl::lower_bound_batch_exespace_impl(
+      "Kokkos::lower_bound_batch_view_api_default", ex, begin(view), end(view),
+      begin(queries), end(queries), begin(dest));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto lower_bound_batch(const std::string& label, const ExecutionSpace& ex,
+                       const ::Kokkos::View<DataType1, Properties1...>& view,
+                       const ::Kokkos::View<DataType2, Properties2...>& queries,
+                       const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(queries);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  return Impl::lower_bound_batch_exespace_impl(label, ex, begin(view),
+                                               end(view), begin(queries),
+                                               end(queries), begin(dest));
+}
+
+template <typename ExecutionSpace, typename IteratorType,
+          typename QueryIteratorType, typename OutputIteratorType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType,
+                                                 QueryIteratorType,
+                                                 OutputIteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+OutputIteratorType lower_bound_batch(const ExecutionSpace& ex,
+                                     IteratorType first, IteratorType last,
+                                     QueryIteratorType q_first,
+                                     QueryIteratorType q_last,
+                                     OutputIteratorType d_first,
+                                     ComparatorType comp) {
+  return Impl::lower_bound_batch_exespace_impl(
+      "Kokkos::lower_bound_batch_iterator_api_default", ex, first, last,
+      q_first, q_last, d_first, std::move(comp));
+}
+
+template <typename ExecutionSpace, typename IteratorType,
+          typename QueryIteratorType, typename OutputIteratorType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType,
+                                                 QueryIteratorType,
+                                                 OutputIteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+OutputIteratorType lower_bound_batch(const std::string& label,
+                                     const ExecutionSpace& ex,
+                                     IteratorType first, IteratorType last,
+                                     QueryIteratorType q_first,
+                                     QueryIteratorType q_last,
+                                     OutputIteratorType d_first,
+                                     ComparatorType comp) {
+  return Impl::lower_bound_batch_exespace_impl(label, ex, first, last, q_first,
+                                               q_last, d_first,
+                                               std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto lower_bound_batch(const ExecutionSpace& ex,
+                       const ::Kokkos::View<DataType1, Properties1...>& view,
+                       const ::Kokkos::View<DataType2, Properties2...>& queries,
+                       const ::Kokkos::View<DataType3, Properties3...>& dest,
+                       ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(queries);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  return Impl::lower_bound_batch_exespace_impl(
+      "Kokkos::lower_bound_batch_view_api_default", ex, begin(view), end(view),
+      begin(queries), end(queries), begin(dest), std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto lower_bound_batch(const std::string& label, const ExecutionSpace& ex,
+                       const ::Kokkos::View<DataType1, Properties1...>& view,
+                       const ::Kokkos::View<DataType2, Properties2...>& queries,
+                       const ::Kokkos::View<DataType3, Properties3...>& dest,
+                       ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(queries);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  return Impl::lower_bound_batch_exespace_impl(
+      label, ex, begin(view), end(view), begin(queries), end(queries),
+      begin(dest), std::move(comp));
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename IteratorType,
+          typename QueryIteratorType, typename OutputIteratorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType,
+                                                 QueryIteratorType,
+                                                 OutputIteratorType> &&
+                               ::Kokkos::is_team_handle_v<TeamHandleType>,
+                           int> = 0>
+KOKKOS_FUNCTION OutputIteratorType lower_bound_batch(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    QueryIteratorType q_first, QueryIteratorType q_last,
+    OutputIteratorType d_first) {
+  return Impl::lower_bound_batch_team_impl(teamHandle, first, last, q_first,
+                                           q_last, d_first);
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename DataType3,
+          typename... Properties3,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto lower_bound_batch(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& queries,
+    const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(queries);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  return Impl::lower_bound_batch_team_impl(teamHandle, begin(view), end(view),
+                                           begin(queries), end(queries),
+                                           begin(dest));
+}
+
+template <typename TeamHandleType, typename IteratorType,
+          typename QueryIteratorType, typename OutputIteratorType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType,
+                                                 QueryIteratorType,
+                                                 OutputIteratorType> &&
+                               ::Kokkos::is_team_handle_v<TeamHandleType>,
+                           int> = 0>
+KOKKOS_FUNCTION OutputIteratorType lower_bound_batch(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    QueryIteratorType q_first, QueryIteratorType q_last,
+    OutputIteratorType d_first, ComparatorType comp) {
+  return Impl::lower_bound_batch_team_impl(teamHandle, first, last, q_first,
+                                           q_last, d_first, std::move(comp));
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename DataType3,
+          typename... Properties3, typename ComparatorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto lower_bound_batch(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& queries,
+    const ::Kokkos::View<DataType3, Properties3...>& dest,
+    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(queries);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  return Impl::lower_bound_batch_team_impl(
+      teamHandle, begin(view), end(view), begin(queries), end(queries),
+      begin(dest), std::move(comp));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
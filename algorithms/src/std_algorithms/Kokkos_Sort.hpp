@@ -0,0 +1,156 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_SORT_HPP
+#define KOKKOS_STD_ALGORITHMS_SORT_HPP
+
+#include "impl/Kokkos_Sort.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+//
+// overload set accepting execution space
+//
+template <typename ExecutionSpace, typename IteratorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void sort(const ExecutionSpace& ex, IteratorType first, IteratorType last) {
+  Impl::sort_exespace_impl("Kokkos::sort_iterator_api_default", ex, first,
+                           last);
+}
+
+template <typename ExecutionSpace, typename IteratorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void sort(const std::string& label, const ExecutionSpace& ex,
+          IteratorType first, IteratorType last) {
+  Impl::sort_exespace_impl(label, ex, first, last);
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void sort(const ExecutionSpace& ex,
+          const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::sort_exespace_impl("Kokkos::sort_view_api_default", ex, begin(view),
+                           end(view));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void sort(const std::string& label, const ExecutionSpace& ex,
+          const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::sort_exespace_impl(label, ex, begin(view), end(view));
+}
+
+template <typename ExecutionSpace, typename IteratorType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void sort(const ExecutionSpace& ex, IteratorType first, IteratorType last,
+          ComparatorType comp) {
+  Impl::sort_exespace_impl("Kokkos::sort_iterator_api_default", ex, first,
+                           last, std::move(comp));
+}
+
+template <typename ExecutionSpace, typename IteratorType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void sort(const std::string& label, const ExecutionSpace& ex,
+          IteratorType first, IteratorType last, ComparatorType comp) {
+  Impl::sort_exespace_impl(label, ex, first, last, std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void sort(const ExecutionSpace& ex,
+          const ::Kokkos::View<DataType, Properties...>& view,
+          ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::sort_exespace_impl("Kokkos::sort_view_api_default", ex, begin(view),
+                           end(view), std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void sort(const std::string& label, const ExecutionSpace& ex,
+          const ::Kokkos::View<DataType, Properties...>& view,
+          ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::sort_exespace_impl(label, ex, begin(view), end(view), std::move(comp));
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename IteratorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_team_handle_v<TeamHandleType>,
+                           int> = 0>
+KOKKOS_FUNCTION void sort(const TeamHandleType& teamHandle,
+                          IteratorType first, IteratorType last) {
+  Impl::sort_team_impl(teamHandle, first, last);
+}
+
+template <typename TeamHandleType, typename DataType, typename... Properties,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION void sort(const TeamHandleType& teamHandle,
+                          const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::sort_team_impl(teamHandle, begin(view), end(view));
+}
+
+template <typename TeamHandleType, typename IteratorType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_team_handle_v<TeamHandleType>,
+                           int> = 0>
+KOKKOS_FUNCTION void sort(const TeamHandleType& teamHandle,
+                          IteratorType first, IteratorType last,
+                          ComparatorType comp) {
+  Impl::sort_team_impl(teamHandle, first, last, comp);
+}
+
+template <typename TeamHandleType, typename DataType, typename... Properties,
+          typename ComparatorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION void sort(const TeamHandleType& teamHandle,
+                          const ::Kokkos::View<DataType, Properties...>& view,
+                          ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::sort_team_impl(teamHandle, begin(view), end(view), comp);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
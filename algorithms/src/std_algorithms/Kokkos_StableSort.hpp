@@ -0,0 +1,120 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_STABLE_SORT_HPP
+#define KOKKOS_STD_ALGORITHMS_STABLE_SORT_HPP
+
+#include "impl/Kokkos_Sort.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+//
+// overload set accepting execution space
+//
+template <typename ExecutionSpace, typename IteratorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void stable_sort(const ExecutionSpace& ex, IteratorType first,
+                 IteratorType last) {
+  Impl::stable_sort_exespace_impl("Kokkos::stable_sort_iterator_api_default",
+                                  ex, first, last);
+}
+
+template <typename ExecutionSpace, typename IteratorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void stable_sort(const std::string& label, const ExecutionSpace& ex,
+                 IteratorType first, IteratorType last) {
+  Impl::stable_sort_exespace_impl(label, ex, first, last);
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void stable_sort(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::stable_sort_exespace_impl("Kokkos::stable_sort_view_api_default", ex,
+                                  begin(view), end(view));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void stable_sort(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::stable_sort_exespace_impl(label, ex, begin(view), end(view));
+}
+
+template <typename ExecutionSpace, typename IteratorType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void stable_sort(const ExecutionSpace& ex, IteratorType first,
+                 IteratorType last, ComparatorType comp) {
+  Impl::stable_sort_exespace_impl("Kokkos::stable_sort_iterator_api_default",
+                                  ex, first, last, std::move(comp));
+}
+
+template <typename ExecutionSpace, typename IteratorType,
+          typename ComparatorType,
+          std::enable_if_t<Impl::are_iterators_v<IteratorType> &&
+                               ::Kokkos::is_execution_space_v<ExecutionSpace>,
+                           int> = 0>
+void stable_sort(const std::string& label, const ExecutionSpace& ex,
+                 IteratorType first, IteratorType last, ComparatorType comp) {
+  Impl::stable_sort_exespace_impl(label, ex, first, last, std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void stable_sort(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::stable_sort_exespace_impl("Kokkos::stable_sort_view_api_default", ex,
+                                  begin(view), end(view), std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void stable_sort(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::stable_sort_exespace_impl(label, ex, begin(view), end(view),
+                                  std::move(comp));
+}
+
+//
+// stable_sort has no overloads accepting a team handle: keeping equivalent
+// elements in order needs a scratch buffer of the size of the range.
+//
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,336 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_BINARY_SEARCH_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_BINARY_SEARCH_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+//
+// sequential searches, used by a single thread on a small subrange
+//
+template <class IteratorType, class PredicateType>
+KOKKOS_FUNCTION typename IteratorType::difference_type
+partition_point_sequential(IteratorType first,
+                           typename IteratorType::difference_type count,
+                           const PredicateType& pred) {
+  typename IteratorType::difference_type lo = 0;
+  while (count > 0) {
+    const auto step = count / 2;
+    if (pred(first[lo + step])) {
+      lo += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return lo;
+}
+
+template <class ValueType, class ComparatorType>
+struct StdLowerBoundPredicate {
+  ValueType m_value;
+  ComparatorType m_comp;
+
+  template <class T>
+  KOKKOS_FUNCTION bool operator()(const T& element) const {
+    return m_comp(element, m_value);
+  }
+};
+
+template <class ValueType, class ComparatorType>
+struct StdUpperBoundPredicate {
+  ValueType m_value;
+  ComparatorType m_comp;
+
+  template <class T>
+  KOKKOS_FUNCTION bool operator()(const T& element) const {
+    return !m_comp(m_value, element);
+  }
+};
+
+template <class IteratorType, class ValueType, class ComparatorType>
+KOKKOS_FUNCTION typename IteratorType::difference_type lower_bound_sequential(
+    IteratorType first, typename IteratorType::difference_type count,
+    const ValueType& value, const ComparatorType& comp) {
+  return partition_point_sequential(
+      first, count,
+      StdLowerBoundPredicate<ValueType, ComparatorType>{value, comp});
+}
+
+template <class IteratorType, class ValueType, class ComparatorType>
+KOKKOS_FUNCTION typename IteratorType::difference_type upper_bound_sequential(
+    IteratorType first, typename IteratorType::difference_type count,
+    const ValueType& value, const ComparatorType& comp) {
+  return partition_point_sequential(
+      first, count,
+      StdUpperBoundPredicate<ValueType, ComparatorType>{value, comp});
+}
+
+//
+// The range is cut into as many chunks as there are threads. Since it is
+// partitioned with respect to the predicate, every chunk but one is either
+// entirely before or entirely after the partition point and only that one
+// needs to be searched. Summing what each chunk contributes gives the
+// partition point in a single parallel reduction.
+//
+template <class IteratorType, class PredicateType>
+struct StdBinarySearchFunctor {
+  using index_type = typename IteratorType::difference_type;
+
+  IteratorType m_first;
+  index_type m_num_elements;
+  index_type m_num_chunks;
+  PredicateType m_pred;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type chunk, index_type& update) const {
+    const index_type begin = chunk * m_num_elements / m_num_chunks;
+    const index_type end   = (chunk + 1) * m_num_elements / m_num_chunks;
+    if (begin == end || !m_pred(m_first[begin])) {
+      return;
+    }
+    if (m_pred(m_first[end - 1])) {
+      update += end - begin;
+      return;
+    }
+    // the partition point is in [begin + 1, end - 1]
+    update += 1 + partition_point_sequential(m_first + begin + 1,
+                                             end - begin - 2, m_pred);
+  }
+
+  KOKKOS_FUNCTION
+  StdBinarySearchFunctor(IteratorType first, index_type num_elements,
+                         index_type num_chunks, PredicateType pred)
+      : m_first(std::move(first)),
+        m_num_elements(num_elements),
+        m_num_chunks(num_chunks),
+        m_pred(std::move(pred)) {}
+};
+
+template <class ExecutionSpace, class IteratorType, class PredicateType>
+IteratorType binary_search_exespace_impl(const std::string& label,
+                                         const ExecutionSpace& ex,
+                                         IteratorType first, IteratorType last,
+                                         PredicateType pred) {
+  using index_type        = typename IteratorType::difference_type;
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  if (num_elements == 0) {
+    return first;
+  }
+
+  const index_type num_chunks =
+      Kokkos::clamp<index_type>(ex.concurrency(), 1, num_elements);
+  index_type count = 0;
+  ::Kokkos::parallel_reduce(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_chunks),
+      // use CTAD
+      StdBinarySearchFunctor(first, num_elements, num_chunks, std::move(pred)),
+      count);
+
+  // fence not needed because reducing into scalar
+  return first + count;
+}
+
+template <class TeamHandleType, class IteratorType, class PredicateType>
+KOKKOS_FUNCTION IteratorType
+binary_search_team_impl(const TeamHandleType& teamHandle, IteratorType first,
+                        IteratorType last, PredicateType pred) {
+  using index_type        = typename IteratorType::difference_type;
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  if (num_elements == 0) {
+    return first;
+  }
+
+  const index_type num_chunks =
+      Kokkos::clamp<index_type>(teamHandle.team_size(), 1, num_elements);
+  index_type count = 0;
+  ::Kokkos::parallel_reduce(
+      TeamThreadRange(teamHandle, 0, num_chunks),
+      // use CTAD
+      StdBinarySearchFunctor(first, num_elements, num_chunks, std::move(pred)),
+      count);
+
+  // no barrier needed since reducing into scalar
+  return first + count;
+}
+
+//
+// lower_bound
+//
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+IteratorType lower_bound_exespace_impl(const std::string& label,
+                                       const ExecutionSpace& ex,
+                                       IteratorType first, IteratorType last,
+                                       const ValueType& value,
+                                       ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+
+  return binary_search_exespace_impl(
+      label, ex, first, last,
+      StdLowerBoundPredicate<ValueType, ComparatorType>{value,
+                                                        std::move(comp)});
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType>
+IteratorType lower_bound_exespace_impl(const std::string& label,
+                                       const ExecutionSpace& ex,
+                                       IteratorType first, IteratorType last,
+                                       const ValueType& value) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = StdAlgoLessThanBinaryPredicate<value_type, ValueType>;
+  return lower_bound_exespace_impl(label, ex, first, last, value, pred_t());
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType,
+          class ComparatorType>
+KOKKOS_FUNCTION IteratorType lower_bound_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    const ValueType& value, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  return binary_search_team_impl(
+      teamHandle, first, last,
+      StdLowerBoundPredicate<ValueType, ComparatorType>{value,
+                                                        std::move(comp)});
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType>
+KOKKOS_FUNCTION IteratorType lower_bound_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    const ValueType& value) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = StdAlgoLessThanBinaryPredicate<value_type, ValueType>;
+  return lower_bound_team_impl(teamHandle, first, last, value, pred_t());
+}
+
+//
+// upper_bound
+//
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+IteratorType upper_bound_exespace_impl(const std::string& label,
+                                       const ExecutionSpace& ex,
+                                       IteratorType first, IteratorType last,
+                                       const ValueType& value,
+                                       ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+
+  return binary_search_exespace_impl(
+      label, ex, first, last,
+      StdUpperBoundPredicate<ValueType, ComparatorType>{value,
+                                                        std::move(comp)});
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType>
+IteratorType upper_bound_exespace_impl(const std::string& label,
+                                       const ExecutionSpace& ex,
+                                       IteratorType first, IteratorType last,
+                                       const ValueType& value) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = StdAlgoLessThanBinaryPredicate<ValueType, value_type>;
+  return upper_bound_exespace_impl(label, ex, first, last, value, pred_t());
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType,
+          class ComparatorType>
+KOKKOS_FUNCTION IteratorType upper_bound_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    const ValueType& value, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  return binary_search_team_impl(
+      teamHandle, first, last,
+      StdUpperBoundPredicate<ValueType, ComparatorType>{value,
+                                                        std::move(comp)});
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType>
+KOKKOS_FUNCTION IteratorType upper_bound_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    const ValueType& value) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = StdAlgoLessThanBinaryPredicate<ValueType, value_type>;
+  return upper_bound_team_impl(teamHandle, first, last, value, pred_t());
+}
+
+//
+// equal_range
+//
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+::Kokkos::pair<IteratorType, IteratorType> equal_range_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, const ValueType& value, ComparatorType comp) {
+  // the upper bound can only be after the lower bound
+  auto lower = lower_bound_exespace_impl(label, ex, first, last, value, comp);
+  auto upper = upper_bound_exespace_impl(label, ex, lower, last, value,
+                                         std::move(comp));
+  return {lower, upper};
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType>
+::Kokkos::pair<IteratorType, IteratorType> equal_range_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, const ValueType& value) {
+  auto lower = lower_bound_exespace_impl(label, ex, first, last, value);
+  auto upper = upper_bound_exespace_impl(label, ex, lower, last, value);
+  return {lower, upper};
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType,
+          class ComparatorType>
+KOKKOS_FUNCTION ::Kokkos::pair<IteratorType, IteratorType>
+equal_range_team_impl(const TeamHandleType& teamHandle, IteratorType first,
+                      IteratorType last, const ValueType& value,
+                      ComparatorType comp) {
+  auto lower = lower_bound_team_impl(teamHandle, first, last, value, comp);
+  auto upper =
+      upper_bound_team_impl(teamHandle, lower, last, value, std::move(comp));
+  return {lower, upper};
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType>
+KOKKOS_FUNCTION ::Kokkos::pair<IteratorType, IteratorType>
+equal_range_team_impl(const TeamHandleType& teamHandle, IteratorType first,
+                      IteratorType last, const ValueType& value) {
+  auto lower = lower_bound_team_impl(teamHandle, first, last, value);
+  auto upper = upper_bound_team_impl(teamHandle, lower, last, value);
+  return {lower, upper};
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
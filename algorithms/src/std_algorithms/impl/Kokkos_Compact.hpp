@@ -0,0 +1,278 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_COMPACT_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_COMPACT_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// a selector returning a bool picks the first output for true and the
+// second one for false, any other selector returns the index of the output
+template <class SelectorResultType>
+KOKKOS_INLINE_FUNCTION std::size_t compact_output_index(
+    const SelectorResultType& result) {
+  if constexpr (std::is_same_v<SelectorResultType, bool>) {
+    return result ? 0 : 1;
+  } else {
+    // negative indices wrap around and are dropped like too large ones
+    return static_cast<std::size_t>(result);
+  }
+}
+
+// holds the output iterators, which can all have different types
+template <class... IteratorTypes>
+struct StdCompactOutputs {
+  KOKKOS_DEFAULTED_FUNCTION StdCompactOutputs() = default;
+
+  template <class ValueType>
+  KOKKOS_FUNCTION void write(std::size_t, const std::size_t*,
+                             const ValueType&) const {}
+};
+
+template <class HeadType, class... TailTypes>
+struct StdCompactOutputs<HeadType, TailTypes...> {
+  HeadType m_head;
+  StdCompactOutputs<TailTypes...> m_tail;
+
+  KOKKOS_FUNCTION
+  StdCompactOutputs(HeadType head, TailTypes... tail)
+      : m_head(std::move(head)), m_tail(std::move(tail)...) {}
+
+  // writes value at position counts[k] of the k-th output
+  template <class ValueType>
+  KOKKOS_FUNCTION void write(std::size_t k, const std::size_t* counts,
+                             const ValueType& value) const {
+    if (k == 0) {
+      m_head[static_cast<typename HeadType::difference_type>(counts[0])] =
+          value;
+    } else {
+      m_tail.write(k - 1, counts + 1, value);
+    }
+  }
+};
+
+// used in place of a view when the counts are returned to the host
+struct StdCompactNoCountsView {};
+
+template <class FirstFrom, class SelectorType, class CountsViewType,
+          class... FirstDests>
+struct StdCompactFunctor {
+  static constexpr std::size_t num_outputs = sizeof...(FirstDests);
+
+  using index_type = typename FirstFrom::difference_type;
+  using value_type = ::Kokkos::Array<std::size_t, num_outputs>;
+
+  FirstFrom m_first_from;
+  index_type m_num_elements;
+  SelectorType m_selector;
+  CountsViewType m_counts;
+  StdCompactOutputs<FirstDests...> m_dests;
+
+  KOKKOS_FUNCTION
+  StdCompactFunctor(FirstFrom first_from, index_type num_elements,
+                    SelectorType selector, CountsViewType counts,
+                    FirstDests... first_dests)
+      : m_first_from(std::move(first_from)),
+        m_num_elements(num_elements),
+        m_selector(std::move(selector)),
+        m_counts(std::move(counts)),
+        m_dests(std::move(first_dests)...) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type i, value_type& update,
+                  const bool final_pass) const {
+    const auto& myval   = m_first_from[i];
+    const std::size_t k = compact_output_index(m_selector(myval));
+
+    // the output is picked by its index rather than by testing the
+    // selector once per output, so the cost does not grow with their number
+    if (k < num_outputs) {
+      if (final_pass) {
+        m_dests.write(k, update.data(), myval);
+      }
+      update[k] += 1;
+    }
+
+    if constexpr (::Kokkos::is_view_v<CountsViewType>) {
+      if (final_pass && i == m_num_elements - 1) {
+        for (std::size_t j = 0; j < num_outputs; ++j) {
+          m_counts(j) = update[j];
+        }
+      }
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void init(value_type& update) const {
+    for (std::size_t j = 0; j < num_outputs; ++j) {
+      update[j] = 0;
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void join(value_type& update, const value_type& input) const {
+    for (std::size_t j = 0; j < num_outputs; ++j) {
+      update[j] += input[j];
+    }
+  }
+};
+
+template <class ExecutionSpace, class InputIterator, class SelectorType,
+          class... OutputIterators>
+::Kokkos::Array<std::size_t, sizeof...(OutputIterators)> compact_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, InputIterator first,
+    InputIterator last, SelectorType selector, OutputIterators... d_firsts) {
+  /*
+    This generalizes copy_if and partition_copy: a single scan carries one
+    count per output, and during the final pass the count of the output an
+    element goes to is the position it is written at.
+    For instance, splitting
+
+    | 1 | 4 | 6 | 3 | 8 | 5 |
+
+    into the even and the odd entries yields the exclusive counts
+
+    | (0, 0) | (0, 1) | (1, 1) | (2, 1) | (2, 2) | (3, 2) |
+
+    so that 4 is written at position 0 of the first output and 5 at
+    position 2 of the second one.
+   */
+
+  // checks
+  static_assert(sizeof...(OutputIterators) > 0,
+                "Kokkos::Experimental::compact: at least one output required");
+  Impl::static_assert_random_access_and_accessible(ex, first, d_firsts...);
+  Impl::expect_valid_range(first, last);
+
+  ::Kokkos::Array<std::size_t, sizeof...(OutputIterators)> counts{};
+  if (first == last) {
+    return counts;
+  }
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_scan(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+      // use CTAD
+      StdCompactFunctor(first, num_elements, std::move(selector),
+                        StdCompactNoCountsView{}, d_firsts...),
+      counts);
+
+  // fence not needed because of the scan accumulating into counts
+  return counts;
+}
+
+template <class ExecutionSpace, class InputIterator, class SelectorType,
+          class CountsViewType, class... OutputIterators>
+void compact_counts_view_exespace_impl(const std::string& label,
+                                       const ExecutionSpace& ex,
+                                       InputIterator first, InputIterator last,
+                                       SelectorType selector,
+                                       const CountsViewType& counts,
+                                       OutputIterators... d_firsts) {
+  // checks
+  static_assert(sizeof...(OutputIterators) > 0,
+                "Kokkos::Experimental::compact: at least one output required");
+  static_assert(CountsViewType::rank() == 1 &&
+                    std::is_integral_v<typename CountsViewType::value_type> &&
+                    !std::is_const_v<typename CountsViewType::value_type>,
+                "Kokkos::Experimental::compact: the counts must be a rank-1 "
+                "view of a non-const integral type");
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename CountsViewType::memory_space>::accessible,
+      "Kokkos::Experimental::compact: the counts must be accessible from "
+      "the execution space");
+  Impl::static_assert_random_access_and_accessible(ex, first, d_firsts...);
+  Impl::expect_valid_range(first, last);
+  KOKKOS_EXPECTS(counts.extent(0) >= sizeof...(OutputIterators));
+
+  if (first == last) {
+    ::Kokkos::deep_copy(
+        ex,
+        ::Kokkos::subview(counts, ::Kokkos::pair<std::size_t, std::size_t>(
+                                      0, sizeof...(OutputIterators))),
+        0);
+    return;
+  }
+
+  // run
+  // the counts are written by the last iteration of the final pass, so
+  // that they do not need to be brought back to the host
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_scan(label,
+                          RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                          // use CTAD
+                          StdCompactFunctor(first, num_elements,
+                                            std::move(selector), counts,
+                                            d_firsts...));
+}
+
+template <class TeamHandleType, class InputIterator, class SelectorType,
+          class... OutputIterators>
+KOKKOS_FUNCTION ::Kokkos::Array<std::size_t, sizeof...(OutputIterators)>
+compact_team_impl(const TeamHandleType& teamHandle, InputIterator first,
+                  InputIterator last, SelectorType selector,
+                  OutputIterators... d_firsts) {
+  // checks
+  static_assert(sizeof...(OutputIterators) > 0,
+                "Kokkos::Experimental::compact: at least one output required");
+  Impl::static_assert_random_access_and_accessible(teamHandle, first,
+                                                   d_firsts...);
+  Impl::expect_valid_range(first, last);
+
+  using counts_t = ::Kokkos::Array<std::size_t, sizeof...(OutputIterators)>;
+  counts_t counts{};
+  if (first == last) {
+    return counts;
+  }
+
+  const std::size_t num_elements = Kokkos::Experimental::distance(first, last);
+
+  // FIXME: there is no parallel_scan overload that accepts TeamThreadRange and
+  // return_value, so temporarily serial implementation is used
+  const StdCompactOutputs<OutputIterators...> dests(d_firsts...);
+  Kokkos::single(
+      Kokkos::PerTeam(teamHandle),
+      [=](counts_t& lcounts) {
+        lcounts = {};
+        for (std::size_t i = 0; i < num_elements; ++i) {
+          const auto& myval   = first[i];
+          const std::size_t k = compact_output_index(selector(myval));
+          if (k < sizeof...(OutputIterators)) {
+            dests.write(k, lcounts.data(), myval);
+            lcounts[k] += 1;
+          }
+        }
+      },
+      counts);
+  // no barrier needed since single above broadcasts to all members
+
+  return counts;
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
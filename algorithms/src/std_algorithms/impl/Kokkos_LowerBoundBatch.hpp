@@ -0,0 +1,317 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_LOWER_BOUND_BATCH_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_LOWER_BOUND_BATCH_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_BitManipulation.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// Below this many elements the table stays in cache anyway and the
+// branchless search on the sorted table is as fast as the Eytzinger one.
+inline constexpr std::size_t lower_bound_batch_eytzinger_min_size = 65536;
+
+// The Eytzinger copy of the table is only worth building if there are
+// enough queries to amortize it, i.e. at least one per this many elements.
+inline constexpr std::size_t lower_bound_batch_queries_per_element = 16;
+
+//
+// branchless binary search on the sorted table: the loop runs a fixed
+// number of iterations for a given size and the comparison only selects
+// the next base, which compiles to a conditional move
+//
+template <class IteratorType, class ValueType, class ComparatorType>
+KOKKOS_FUNCTION typename IteratorType::difference_type lower_bound_branchless(
+    IteratorType first, typename IteratorType::difference_type count,
+    const ValueType& value, const ComparatorType& comp) {
+  using index_type = typename IteratorType::difference_type;
+  if (count == 0) {
+    return 0;
+  }
+  index_type base = 0;
+  while (count > 1) {
+    const index_type half = count / 2;
+    base  = comp(first[base + half], value) ? base + half : base;
+    count = count - half;
+  }
+  return base + static_cast<index_type>(comp(first[base], value));
+}
+
+//
+// Eytzinger layout: the table is stored as an implicit binary search tree
+// in breadth-first order, node k has children 2k and 2k+1 (the root is 1).
+// The top levels of the tree are shared by all searches and stay in cache,
+// and the descendants of a node a few levels down are contiguous so they
+// can be prefetched while the current level is compared.
+//
+
+// position in the sorted table of node k of a tree with size nodes
+KOKKOS_INLINE_FUNCTION
+std::size_t eytzinger_to_sorted_index(std::size_t k, std::size_t size) {
+  using Kokkos::Experimental::bit_width_builtin;
+  // position of k if the deepest level of the tree was complete
+  const std::size_t height = bit_width_builtin(size);
+  const std::size_t level  = bit_width_builtin(k) - 1;
+  const std::size_t index =
+      ((2 * (k - (std::size_t(1) << level)) + 1) << (height - 1 - level)) - 1;
+  // the deepest level only has its leftmost nodes, which take the even
+  // positions of the complete tree, remove the missing ones before k
+  const std::size_t num_leaves =
+      size - ((std::size_t(1) << (height - 1)) - 1);
+  const std::size_t num_leaf_positions = (index + 1) / 2;
+  return index - (num_leaf_positions > num_leaves
+                      ? num_leaf_positions - num_leaves
+                      : 0);
+}
+
+template <class ValueType>
+KOKKOS_INLINE_FUNCTION void eytzinger_prefetch(
+    [[maybe_unused]] const ValueType* ptr) {
+#if defined(KOKKOS_COMPILER_GNU) || defined(KOKKOS_COMPILER_CLANG)
+  KOKKOS_IF_ON_HOST((__builtin_prefetch(ptr);))
+#endif
+}
+
+template <class ValueType, class QueryType, class ComparatorType>
+KOKKOS_FUNCTION std::size_t eytzinger_lower_bound(const ValueType* tree,
+                                                  std::size_t size,
+                                                  const QueryType& value,
+                                                  const ComparatorType& comp) {
+  // the descendants of node k that many levels down fill a cache line
+  constexpr std::size_t prefetch_stride =
+      sizeof(ValueType) < 64 ? 64 / sizeof(ValueType) : 1;
+
+  std::size_t k = 1;
+  while (k <= size) {
+    if (k * prefetch_stride <= size) {
+      eytzinger_prefetch(tree + k * prefetch_stride);
+    }
+    k = 2 * k + static_cast<std::size_t>(comp(tree[k], value));
+  }
+  // the answer is the last node where the search went left: drop the
+  // trailing right turns and that left turn, 0 means it never went left
+  k >>= Kokkos::Experimental::countr_one_builtin(k) + 1;
+  return (k == 0) ? size : eytzinger_to_sorted_index(k, size);
+}
+
+template <class IteratorType, class TreeViewType>
+struct StdEytzingerBuildFunctor {
+  IteratorType m_first;
+  TreeViewType m_tree;
+  std::size_t m_size;
+
+  KOKKOS_FUNCTION
+  void operator()(std::size_t k) const {
+    m_tree(k) = m_first[eytzinger_to_sorted_index(k, m_size)];
+  }
+
+  KOKKOS_FUNCTION
+  StdEytzingerBuildFunctor(IteratorType first, TreeViewType tree,
+                           std::size_t size)
+      : m_first(std::move(first)), m_tree(std::move(tree)), m_size(size) {}
+};
+
+template <class TreeViewType, class QueryIteratorType, class OutputIteratorType,
+          class ComparatorType>
+struct StdEytzingerLowerBoundFunctor {
+  using index_type = typename QueryIteratorType::difference_type;
+  using value_type = typename OutputIteratorType::value_type;
+
+  TreeViewType m_tree;
+  std::size_t m_size;
+  QueryIteratorType m_q_first;
+  OutputIteratorType m_d_first;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(index_type i) const {
+    m_d_first[i] = static_cast<value_type>(
+        eytzinger_lower_bound(m_tree.data(), m_size, m_q_first[i], m_comp));
+  }
+
+  KOKKOS_FUNCTION
+  StdEytzingerLowerBoundFunctor(TreeViewType tree, std::size_t size,
+                                QueryIteratorType q_first,
+                                OutputIteratorType d_first,
+                                ComparatorType comp)
+      : m_tree(std::move(tree)),
+        m_size(size),
+        m_q_first(std::move(q_first)),
+        m_d_first(std::move(d_first)),
+        m_comp(std::move(comp)) {}
+};
+
+template <class IteratorType, class QueryIteratorType,
+          class OutputIteratorType, class ComparatorType>
+struct StdLowerBoundBatchFunctor {
+  using index_type = typename QueryIteratorType::difference_type;
+  using value_type = typename OutputIteratorType::value_type;
+
+  IteratorType m_first;
+  typename IteratorType::difference_type m_size;
+  QueryIteratorType m_q_first;
+  OutputIteratorType m_d_first;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(index_type i) const {
+    m_d_first[i] = static_cast<value_type>(
+        lower_bound_branchless(m_first, m_size, m_q_first[i], m_comp));
+  }
+
+  KOKKOS_FUNCTION
+  StdLowerBoundBatchFunctor(IteratorType first,
+                            typename IteratorType::difference_type size,
+                            QueryIteratorType q_first,
+                            OutputIteratorType d_first, ComparatorType comp)
+      : m_first(std::move(first)),
+        m_size(size),
+        m_q_first(std::move(q_first)),
+        m_d_first(std::move(d_first)),
+        m_comp(std::move(comp)) {}
+};
+
+template <class ExecutionSpace, class IteratorType, class QueryIteratorType,
+          class OutputIteratorType, class ComparatorType>
+OutputIteratorType lower_bound_batch_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, QueryIteratorType q_first, QueryIteratorType q_last,
+    OutputIteratorType d_first, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first, q_first,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(q_first,
+                                                              d_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(q_first, q_last);
+  static_assert(
+      std::is_integral_v<typename OutputIteratorType::value_type>,
+      "Kokkos: lower_bound_batch writes the positions of the lower bounds, "
+      "the destination must have an integral value type.");
+
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  const auto num_queries  = Kokkos::Experimental::distance(q_first, q_last);
+  if (num_queries == 0) {
+    return d_first;
+  }
+
+  const std::size_t size = num_elements;
+  if (size < lower_bound_batch_eytzinger_min_size ||
+      std::size_t(num_queries) * lower_bound_batch_queries_per_element <
+          size) {
+    ::Kokkos::parallel_for(
+        label, RangePolicy<ExecutionSpace>(ex, 0, num_queries),
+        // use CTAD
+        StdLowerBoundBatchFunctor(first, num_elements, q_first, d_first,
+                                  std::move(comp)));
+    ex.fence("Kokkos::lower_bound_batch: fence after operation");
+    return d_first + num_queries;
+  }
+
+  // build the Eytzinger copy of the table, node 0 is not used
+  using value_type  = std::remove_const_t<typename IteratorType::value_type>;
+  using tree_view_t = Kokkos::View<value_type*, ExecutionSpace>;
+  tree_view_t tree(Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                                      "Kokkos::lower_bound_batch_tree"),
+                   size + 1);
+  ::Kokkos::parallel_for(
+      label + " - build tree",
+      RangePolicy<ExecutionSpace, IndexType<std::size_t>>(ex, 1, size + 1),
+      // use CTAD
+      StdEytzingerBuildFunctor(first, tree, size));
+
+  ::Kokkos::parallel_for(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_queries),
+      // use CTAD
+      StdEytzingerLowerBoundFunctor(tree, size, q_first, d_first,
+                                    std::move(comp)));
+  ex.fence("Kokkos::lower_bound_batch: fence after operation");
+  return d_first + num_queries;
+}
+
+template <class ExecutionSpace, class IteratorType, class QueryIteratorType,
+          class OutputIteratorType>
+OutputIteratorType lower_bound_batch_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, QueryIteratorType q_first, QueryIteratorType q_last,
+    OutputIteratorType d_first) {
+  using value_type = typename IteratorType::value_type;
+  using query_type = typename QueryIteratorType::value_type;
+  using pred_t     = StdAlgoLessThanBinaryPredicate<value_type, query_type>;
+  return lower_bound_batch_exespace_impl(label, ex, first, last, q_first,
+                                         q_last, d_first, pred_t());
+}
+
+//
+// team-level impl: there is no scratch space to build the Eytzinger copy,
+// each member searches the sorted table for its queries
+//
+template <class TeamHandleType, class IteratorType, class QueryIteratorType,
+          class OutputIteratorType, class ComparatorType>
+KOKKOS_FUNCTION OutputIteratorType lower_bound_batch_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    QueryIteratorType q_first, QueryIteratorType q_last,
+    OutputIteratorType d_first, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, q_first,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(q_first,
+                                                              d_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(q_first, q_last);
+  static_assert(
+      std::is_integral_v<typename OutputIteratorType::value_type>,
+      "Kokkos: lower_bound_batch writes the positions of the lower bounds, "
+      "the destination must have an integral value type.");
+
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  const auto num_queries  = Kokkos::Experimental::distance(q_first, q_last);
+  ::Kokkos::parallel_for(
+      TeamThreadRange(teamHandle, 0, num_queries),
+      // use CTAD
+      StdLowerBoundBatchFunctor(first, num_elements, q_first, d_first,
+                                std::move(comp)));
+  teamHandle.team_barrier();
+  return d_first + num_queries;
+}
+
+template <class TeamHandleType, class IteratorType, class QueryIteratorType,
+          class OutputIteratorType>
+KOKKOS_FUNCTION OutputIteratorType lower_bound_batch_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    QueryIteratorType q_first, QueryIteratorType q_last,
+    OutputIteratorType d_first) {
+  using value_type = typename IteratorType::value_type;
+  using query_type = typename QueryIteratorType::value_type;
+  using pred_t     = StdAlgoLessThanBinaryPredicate<value_type, query_type>;
+  return lower_bound_batch_team_impl(teamHandle, first, last, q_first, q_last,
+                                     d_first, pred_t());
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
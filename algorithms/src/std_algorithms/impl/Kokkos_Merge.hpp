@@ -0,0 +1,231 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_MERGE_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_MERGE_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_CopyCopyN.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_MergePath.hpp"
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+//
+// Each index handles a chunk of the output: it finds where the chunk starts
+// on the merge path and then merges sequentially.
+//
+template <class InputIterator1, class InputIterator2, class OutputIterator,
+          class ComparatorType>
+struct StdMergeFunctor {
+  using index_type = typename InputIterator1::difference_type;
+
+  InputIterator1 m_first1;
+  index_type m_num_elements1;
+  InputIterator2 m_first2;
+  index_type m_num_elements2;
+  OutputIterator m_d_first;
+  index_type m_chunk_size;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type chunk) const {
+    const index_type diag_begin = chunk * m_chunk_size;
+    const index_type diag_end   = Kokkos::min(
+        diag_begin + m_chunk_size, m_num_elements1 + m_num_elements2);
+    index_type i = merge_path_search(m_first1, m_num_elements1, m_first2,
+                                     m_num_elements2, diag_begin, m_comp);
+    index_type j = diag_begin - i;
+    for (index_type k = diag_begin; k < diag_end; ++k) {
+      if (j >= m_num_elements2 ||
+          (i < m_num_elements1 && !m_comp(m_first2[j], m_first1[i]))) {
+        m_d_first[k] = m_first1[i++];
+      } else {
+        m_d_first[k] = m_first2[j++];
+      }
+    }
+  }
+
+  KOKKOS_FUNCTION
+  StdMergeFunctor(InputIterator1 first1, index_type num_elements1,
+                  InputIterator2 first2, index_type num_elements2,
+                  OutputIterator d_first, index_type chunk_size,
+                  ComparatorType comp)
+      : m_first1(std::move(first1)),
+        m_num_elements1(num_elements1),
+        m_first2(std::move(first2)),
+        m_num_elements2(num_elements2),
+        m_d_first(std::move(d_first)),
+        m_chunk_size(chunk_size),
+        m_comp(std::move(comp)) {}
+};
+
+//
+// exespace impl
+//
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator merge_exespace_impl(const std::string& label,
+                                   const ExecutionSpace& ex,
+                                   InputIterator1 first1, InputIterator1 last1,
+                                   InputIterator2 first2, InputIterator2 last2,
+                                   OutputIterator d_first,
+                                   ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first1, first2, d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // run
+  const auto num_elements1 = Kokkos::Experimental::distance(first1, last1);
+  const auto num_elements2 = Kokkos::Experimental::distance(first2, last2);
+  const auto num_chunks    = merge_path_num_chunks<decltype(num_elements1)>(
+      num_elements1 + num_elements2, merge_path_chunk_size);
+  ::Kokkos::parallel_for(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_chunks),
+      // use CTAD
+      StdMergeFunctor(first1, num_elements1, first2, num_elements2, d_first,
+                      decltype(num_elements1)(merge_path_chunk_size), comp));
+  ex.fence("Kokkos::merge: fence after operation");
+
+  // return
+  return d_first + num_elements1 + num_elements2;
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator merge_exespace_impl(const std::string& label,
+                                   const ExecutionSpace& ex,
+                                   InputIterator1 first1, InputIterator1 last1,
+                                   InputIterator2 first2, InputIterator2 last2,
+                                   OutputIterator d_first) {
+  using value_type1 = typename InputIterator1::value_type;
+  using value_type2 = typename InputIterator2::value_type;
+  using pred_t = Impl::StdAlgoLessThanBinaryPredicate<value_type2, value_type1>;
+  return merge_exespace_impl(label, ex, first1, last1, first2, last2, d_first,
+                             pred_t());
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void inplace_merge_exespace_impl(const std::string& label,
+                                 const ExecutionSpace& ex, IteratorType first,
+                                 IteratorType middle, IteratorType last,
+                                 ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, middle);
+  Impl::expect_valid_range(middle, last);
+
+  if (first == middle || middle == last) {
+    return;
+  }
+
+  // the merge reads both halves from a copy and writes back into the range
+  using value_type         = typename IteratorType::value_type;
+  using tmp_view_type      = Kokkos::View<value_type*, ExecutionSpace>;
+  const auto num_elements1 = Kokkos::Experimental::distance(first, middle);
+  const auto num_elements  = Kokkos::Experimental::distance(first, last);
+  tmp_view_type tmp_view(Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                                            "std_inplace_merge_tmp_view"),
+                         num_elements);
+  auto tmp_first = ::Kokkos::Experimental::begin(tmp_view);
+  ::Kokkos::parallel_for(label + " copy",
+                         RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                         StdCopyFunctor(first, tmp_first));
+
+  ::Kokkos::parallel_for(
+      label,
+      RangePolicy<ExecutionSpace>(
+          ex, 0,
+          merge_path_num_chunks<decltype(num_elements)>(num_elements,
+                                                        merge_path_chunk_size)),
+      // use CTAD
+      StdMergeFunctor(tmp_first, num_elements1, tmp_first + num_elements1,
+                      num_elements - num_elements1, first,
+                      decltype(num_elements)(merge_path_chunk_size), comp));
+  ex.fence("Kokkos::inplace_merge: fence after operation");
+}
+
+template <class ExecutionSpace, class IteratorType>
+void inplace_merge_exespace_impl(const std::string& label,
+                                 const ExecutionSpace& ex, IteratorType first,
+                                 IteratorType middle, IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  inplace_merge_exespace_impl(label, ex, first, middle, last, pred_t());
+}
+
+//
+// team impl
+//
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+KOKKOS_FUNCTION OutputIterator
+merge_team_impl(const TeamHandleType& teamHandle, InputIterator1 first1,
+                InputIterator1 last1, InputIterator2 first2,
+                InputIterator2 last2, OutputIterator d_first,
+                ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // run
+  const auto num_elements1 = Kokkos::Experimental::distance(first1, last1);
+  const auto num_elements2 = Kokkos::Experimental::distance(first2, last2);
+  const auto num_chunks    = merge_path_num_chunks<decltype(num_elements1)>(
+      num_elements1 + num_elements2, merge_path_team_chunk_size);
+  ::Kokkos::parallel_for(
+      TeamThreadRange(teamHandle, 0, num_chunks),
+      // use CTAD
+      StdMergeFunctor(first1, num_elements1, first2, num_elements2, d_first,
+                      decltype(num_elements1)(merge_path_team_chunk_size),
+                      comp));
+  teamHandle.team_barrier();
+
+  // return
+  return d_first + num_elements1 + num_elements2;
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+KOKKOS_FUNCTION OutputIterator
+merge_team_impl(const TeamHandleType& teamHandle, InputIterator1 first1,
+                InputIterator1 last1, InputIterator2 first2,
+                InputIterator2 last2, OutputIterator d_first) {
+  using value_type1 = typename InputIterator1::value_type;
+  using value_type2 = typename InputIterator2::value_type;
+  using pred_t = Impl::StdAlgoLessThanBinaryPredicate<value_type2, value_type1>;
+  return merge_team_impl(teamHandle, first1, last1, first2, last2, d_first,
+                         pred_t());
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,130 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_MERGE_PATH_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_MERGE_PATH_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_BinarySearch.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// Number of merge path steps walked sequentially by each thread between two
+// searches, for execution spaces and for teams respectively.
+inline constexpr std::ptrdiff_t merge_path_chunk_size      = 1024;
+inline constexpr std::ptrdiff_t merge_path_team_chunk_size = 32;
+
+template <class IndexType>
+struct MergePathPoint {
+  IndexType m_first;
+  IndexType m_second;
+};
+
+template <class IndexType>
+KOKKOS_FUNCTION IndexType merge_path_num_chunks(IndexType num_elements,
+                                                IndexType chunk_size) {
+  return (num_elements + chunk_size - 1) / chunk_size;
+}
+
+//
+// Returns how many of the first diag elements of the merge of
+// [first1, first1 + n1) and [first2, first2 + n2) come from the first range.
+// Equivalent elements are taken from the first range first, which is what
+// makes merge stable.
+//
+template <class IteratorType1, class IteratorType2, class ComparatorType>
+KOKKOS_FUNCTION typename IteratorType1::difference_type merge_path_search(
+    IteratorType1 first1, typename IteratorType1::difference_type n1,
+    IteratorType2 first2, typename IteratorType1::difference_type n2,
+    typename IteratorType1::difference_type diag, const ComparatorType& comp) {
+  auto lo = diag > n2 ? diag - n2 : 0;
+  auto hi = diag < n1 ? diag : n1;
+  while (lo < hi) {
+    const auto mid = lo + (hi - lo) / 2;
+    if (comp(first2[diag - 1 - mid], first1[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+//
+// Set operations pair the k-th occurrence of a value in the first range with
+// its k-th occurrence in the second one, so a plain merge path point may split
+// such a pair across two threads. snap_to_balanced_path moves the point
+// (i, j) of the merge path, whose next merged element is key, to the nearest
+// point that the sequential set algorithms go through: equivalent elements
+// are consumed in pairs and only then the surplus of the longer run.
+//
+template <class IteratorType1, class IteratorType2, class ValueType,
+          class ComparatorType>
+KOKKOS_FUNCTION MergePathPoint<typename IteratorType1::difference_type>
+snap_to_balanced_path(IteratorType1 first1,
+                      typename IteratorType1::difference_type n1,
+                      IteratorType2 first2,
+                      typename IteratorType1::difference_type n2,
+                      typename IteratorType1::difference_type i,
+                      typename IteratorType1::difference_type j,
+                      const ValueType& key, const ComparatorType& comp) {
+  const auto run_begin1 = lower_bound_sequential(first1, i, key, comp);
+  const auto run_begin2 = lower_bound_sequential(first2, j, key, comp);
+  const auto consumed   = (i - run_begin1) + (j - run_begin2);
+  if (consumed == 0) {
+    return {i, j};
+  }
+  const auto run_size1 =
+      i + upper_bound_sequential(first1 + i, n1 - i, key, comp) - run_begin1;
+  const auto run_size2 =
+      j + upper_bound_sequential(first2 + j, n2 - j, key, comp) - run_begin2;
+  const auto num_pairs = Kokkos::min(run_size1, run_size2);
+  if (consumed <= 2 * num_pairs) {
+    return {run_begin1 + consumed / 2, run_begin2 + consumed / 2};
+  }
+  if (run_size1 > run_size2) {
+    return {run_begin1 + consumed - run_size2, run_begin2 + run_size2};
+  }
+  return {run_begin1 + run_size1, run_begin2 + consumed - run_size1};
+}
+
+template <class IteratorType1, class IteratorType2, class ComparatorType>
+KOKKOS_FUNCTION MergePathPoint<typename IteratorType1::difference_type>
+balanced_path_search(IteratorType1 first1,
+                     typename IteratorType1::difference_type n1,
+                     IteratorType2 first2,
+                     typename IteratorType1::difference_type n2,
+                     typename IteratorType1::difference_type diag,
+                     const ComparatorType& comp) {
+  if (diag >= n1 + n2) {
+    return {n1, n2};
+  }
+  const auto i = merge_path_search(first1, n1, first2, n2, diag, comp);
+  const auto j = diag - i;
+  if (j >= n2 || (i < n1 && !comp(first2[j], first1[i]))) {
+    return snap_to_balanced_path(first1, n1, first2, n2, i, j, first1[i],
+                                 comp);
+  }
+  return snap_to_balanced_path(first1, n1, first2, n2, i, j, first2[j], comp);
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
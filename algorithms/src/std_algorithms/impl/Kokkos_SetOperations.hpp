@@ -0,0 +1,547 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_SET_OPERATIONS_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_SET_OPERATIONS_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_MergePath.hpp"
+#include "Kokkos_MustUseKokkosSingleInTeam.hpp"
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// which elements a set operation keeps: those only in the first range, those
+// only in the second one and those in both (taken from the first range)
+template <bool KeepFirst, bool KeepSecond, bool KeepCommon>
+struct StdSetOperationTag {
+  static constexpr bool keep_first  = KeepFirst;
+  static constexpr bool keep_second = KeepSecond;
+  static constexpr bool keep_common = KeepCommon;
+};
+
+using StdSetUnionTag        = StdSetOperationTag<true, true, true>;
+using StdSetIntersectionTag = StdSetOperationTag<false, false, true>;
+using StdSetDifferenceTag   = StdSetOperationTag<true, false, false>;
+
+template <class IteratorType1, class IteratorType2>
+using std_set_operation_default_comparator_t =
+    StdAlgoLessThanBinaryPredicate<std::common_type_t<
+        typename IteratorType1::value_type,
+        typename IteratorType2::value_type>>;
+
+//
+// The sequential set operation on [first1 + i, first1 + i_end) and
+// [first2 + j, first2 + j_end). Returns the number of elements it outputs and
+// only writes them to d_first when Write is true.
+//
+template <class Tag, bool Write, class IteratorType1, class IteratorType2,
+          class OutputIterator, class ComparatorType>
+KOKKOS_FUNCTION typename IteratorType1::difference_type
+set_operation_sequential(
+    IteratorType1 first1, typename IteratorType1::difference_type i,
+    typename IteratorType1::difference_type i_end, IteratorType2 first2,
+    typename IteratorType1::difference_type j,
+    typename IteratorType1::difference_type j_end,
+    [[maybe_unused]] OutputIterator d_first, const ComparatorType& comp) {
+  typename IteratorType1::difference_type count = 0;
+  while (i < i_end && j < j_end) {
+    if (comp(first1[i], first2[j])) {
+      if constexpr (Tag::keep_first) {
+        if constexpr (Write) d_first[count] = first1[i];
+        ++count;
+      }
+      ++i;
+    } else if (comp(first2[j], first1[i])) {
+      if constexpr (Tag::keep_second) {
+        if constexpr (Write) d_first[count] = first2[j];
+        ++count;
+      }
+      ++j;
+    } else {
+      if constexpr (Tag::keep_common) {
+        if constexpr (Write) d_first[count] = first1[i];
+        ++count;
+      }
+      ++i;
+      ++j;
+    }
+  }
+  if constexpr (Tag::keep_first) {
+    for (; i < i_end; ++i, ++count) {
+      if constexpr (Write) d_first[count] = first1[i];
+    }
+  }
+  if constexpr (Tag::keep_second) {
+    for (; j < j_end; ++j, ++count) {
+      if constexpr (Write) d_first[count] = first2[j];
+    }
+  }
+  return count;
+}
+
+//
+// Each index handles the part of both ranges between two points of the
+// balanced path, so the scan over the chunks gives where every chunk writes
+// its output.
+//
+template <class Tag, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+struct StdSetOperationFunctor {
+  using index_type = typename InputIterator1::difference_type;
+
+  InputIterator1 m_first1;
+  index_type m_num_elements1;
+  InputIterator2 m_first2;
+  index_type m_num_elements2;
+  OutputIterator m_d_first;
+  index_type m_chunk_size;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type chunk, index_type& update,
+                  const bool final_pass) const {
+    const auto begin =
+        balanced_path_search(m_first1, m_num_elements1, m_first2,
+                             m_num_elements2, chunk * m_chunk_size, m_comp);
+    const auto end = balanced_path_search(m_first1, m_num_elements1, m_first2,
+                                          m_num_elements2,
+                                          (chunk + 1) * m_chunk_size, m_comp);
+    if (final_pass) {
+      update += set_operation_sequential<Tag, true>(
+          m_first1, begin.m_first, end.m_first, m_first2, begin.m_second,
+          end.m_second, m_d_first + update, m_comp);
+    } else {
+      update += set_operation_sequential<Tag, false>(
+          m_first1, begin.m_first, end.m_first, m_first2, begin.m_second,
+          end.m_second, m_d_first, m_comp);
+    }
+  }
+
+  KOKKOS_FUNCTION
+  StdSetOperationFunctor(InputIterator1 first1, index_type num_elements1,
+                         InputIterator2 first2, index_type num_elements2,
+                         OutputIterator d_first, index_type chunk_size,
+                         ComparatorType comp)
+      : m_first1(std::move(first1)),
+        m_num_elements1(num_elements1),
+        m_first2(std::move(first2)),
+        m_num_elements2(num_elements2),
+        m_d_first(std::move(d_first)),
+        m_chunk_size(chunk_size),
+        m_comp(std::move(comp)) {}
+};
+
+// counts the elements of the second range missing from the first one
+template <class InputIterator1, class InputIterator2, class ComparatorType>
+struct StdIncludesFunctor {
+  using index_type = typename InputIterator1::difference_type;
+
+  InputIterator1 m_first1;
+  index_type m_num_elements1;
+  InputIterator2 m_first2;
+  index_type m_num_elements2;
+  index_type m_chunk_size;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type chunk, index_type& update) const {
+    const auto begin =
+        balanced_path_search(m_first2, m_num_elements2, m_first1,
+                             m_num_elements1, chunk * m_chunk_size, m_comp);
+    const auto end = balanced_path_search(m_first2, m_num_elements2, m_first1,
+                                          m_num_elements1,
+                                          (chunk + 1) * m_chunk_size, m_comp);
+    update += set_operation_sequential<StdSetDifferenceTag, false>(
+        m_first2, begin.m_first, end.m_first, m_first1, begin.m_second,
+        end.m_second, m_first2, m_comp);
+  }
+
+  KOKKOS_FUNCTION
+  StdIncludesFunctor(InputIterator1 first1, index_type num_elements1,
+                     InputIterator2 first2, index_type num_elements2,
+                     index_type chunk_size, ComparatorType comp)
+      : m_first1(std::move(first1)),
+        m_num_elements1(num_elements1),
+        m_first2(std::move(first2)),
+        m_num_elements2(num_elements2),
+        m_chunk_size(chunk_size),
+        m_comp(std::move(comp)) {}
+};
+
+//
+// exespace impl
+//
+template <class Tag, class ExecutionSpace, class InputIterator1,
+          class InputIterator2, class OutputIterator, class ComparatorType>
+OutputIterator set_operation_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first1, first2, d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  const auto num_elements1 = Kokkos::Experimental::distance(first1, last1);
+  const auto num_elements2 = Kokkos::Experimental::distance(first2, last2);
+  if (num_elements1 + num_elements2 == 0) {
+    return d_first;
+  }
+
+  // run
+  using index_type      = typename InputIterator1::difference_type;
+  const auto num_chunks = merge_path_num_chunks<index_type>(
+      num_elements1 + num_elements2, merge_path_chunk_size);
+  index_type count = 0;
+  ::Kokkos::parallel_scan(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_chunks),
+      StdSetOperationFunctor<Tag, InputIterator1, InputIterator2,
+                             OutputIterator, ComparatorType>(
+          first1, num_elements1, first2, num_elements2, d_first,
+          merge_path_chunk_size, std::move(comp)),
+      count);
+
+  // fence not needed because of the scan accumulating into count
+  return d_first + count;
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class ComparatorType>
+bool includes_exespace_impl(const std::string& label, const ExecutionSpace& ex,
+                            InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first1, first2);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  const auto num_elements1 = Kokkos::Experimental::distance(first1, last1);
+  const auto num_elements2 = Kokkos::Experimental::distance(first2, last2);
+  if (num_elements2 == 0) {
+    return true;
+  }
+  if (num_elements2 > num_elements1) {
+    return false;
+  }
+
+  // run
+  using index_type      = typename InputIterator1::difference_type;
+  const auto num_chunks = merge_path_num_chunks<index_type>(
+      num_elements1 + num_elements2, merge_path_chunk_size);
+  index_type num_missing = 0;
+  ::Kokkos::parallel_reduce(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_chunks),
+      // use CTAD
+      StdIncludesFunctor(first1, num_elements1, first2, num_elements2,
+                         index_type(merge_path_chunk_size), std::move(comp)),
+      num_missing);
+
+  // fence not needed because reducing into scalar
+  return num_missing == 0;
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2>
+bool includes_exespace_impl(const std::string& label, const ExecutionSpace& ex,
+                            InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2) {
+  using pred_t =
+      std_set_operation_default_comparator_t<InputIterator1, InputIterator2>;
+  return includes_exespace_impl(label, ex, first1, last1, first2, last2,
+                                pred_t());
+}
+
+//
+// team impl
+//
+template <class Tag, class TeamHandleType, class InputIterator1,
+          class InputIterator2, class OutputIterator, class ComparatorType>
+KOKKOS_FUNCTION OutputIterator set_operation_team_impl(
+    const TeamHandleType& teamHandle, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  const auto num_elements1 = Kokkos::Experimental::distance(first1, last1);
+  const auto num_elements2 = Kokkos::Experimental::distance(first2, last2);
+  if (num_elements1 + num_elements2 == 0) {
+    return d_first;
+  }
+
+  using index_type = typename InputIterator1::difference_type;
+  if constexpr (stdalgo_must_use_kokkos_single_for_team_scan_v<
+                    typename TeamHandleType::execution_space>) {
+    index_type count = 0;
+    Kokkos::single(
+        Kokkos::PerTeam(teamHandle),
+        [=](index_type& lcount) {
+          lcount = set_operation_sequential<Tag, true>(
+              first1, 0, num_elements1, first2, 0, num_elements2, d_first,
+              comp);
+        },
+        count);
+    // no barrier needed since single above broadcasts to all members
+    return d_first + count;
+
+  } else {
+    const auto num_chunks = merge_path_num_chunks<index_type>(
+        num_elements1 + num_elements2, merge_path_team_chunk_size);
+    index_type count = 0;
+    ::Kokkos::parallel_scan(
+        TeamThreadRange(teamHandle, 0, num_chunks),
+        StdSetOperationFunctor<Tag, InputIterator1, InputIterator2,
+                               OutputIterator, ComparatorType>(
+            first1, num_elements1, first2, num_elements2, d_first,
+            merge_path_team_chunk_size, std::move(comp)),
+        count);
+    // no barrier needed because of the scan accumulating into count
+    return d_first + count;
+  }
+
+#if defined(KOKKOS_COMPILER_NVCC) && KOKKOS_COMPILER_NVCC >= 1130 && \
+    !defined(KOKKOS_COMPILER_MSVC)
+  __builtin_unreachable();
+#endif
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class ComparatorType>
+KOKKOS_FUNCTION bool includes_team_impl(const TeamHandleType& teamHandle,
+                                        InputIterator1 first1,
+                                        InputIterator1 last1,
+                                        InputIterator2 first2,
+                                        InputIterator2 last2,
+                                        ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  const auto num_elements1 = Kokkos::Experimental::distance(first1, last1);
+  const auto num_elements2 = Kokkos::Experimental::distance(first2, last2);
+  if (num_elements2 == 0) {
+    return true;
+  }
+  if (num_elements2 > num_elements1) {
+    return false;
+  }
+
+  using index_type      = typename InputIterator1::difference_type;
+  const auto num_chunks = merge_path_num_chunks<index_type>(
+      num_elements1 + num_elements2, merge_path_team_chunk_size);
+  index_type num_missing = 0;
+  ::Kokkos::parallel_reduce(
+      TeamThreadRange(teamHandle, 0, num_chunks),
+      // use CTAD
+      StdIncludesFunctor(first1, num_elements1, first2, num_elements2,
+                         index_type(merge_path_team_chunk_size),
+                         std::move(comp)),
+      num_missing);
+
+  // no barrier needed since reducing into scalar
+  return num_missing == 0;
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2>
+KOKKOS_FUNCTION bool includes_team_impl(const TeamHandleType& teamHandle,
+                                        InputIterator1 first1,
+                                        InputIterator1 last1,
+                                        InputIterator2 first2,
+                                        InputIterator2 last2) {
+  using pred_t =
+      std_set_operation_default_comparator_t<InputIterator1, InputIterator2>;
+  return includes_team_impl(teamHandle, first1, last1, first2, last2, pred_t());
+}
+
+//
+// set_union
+//
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator set_union_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first, ComparatorType comp) {
+  return set_operation_exespace_impl<StdSetUnionTag>(label, ex, first1, last1,
+                                                     first2, last2, d_first,
+                                                     std::move(comp));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator set_union_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first) {
+  using pred_t =
+      std_set_operation_default_comparator_t<InputIterator1, InputIterator2>;
+  return set_operation_exespace_impl<StdSetUnionTag>(label, ex, first1, last1,
+                                                     first2, last2, d_first,
+                                                     pred_t());
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+KOKKOS_FUNCTION OutputIterator set_union_team_impl(
+    const TeamHandleType& teamHandle, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first, ComparatorType comp) {
+  return set_operation_team_impl<StdSetUnionTag>(teamHandle, first1, last1,
+                                                 first2, last2, d_first,
+                                                 std::move(comp));
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+KOKKOS_FUNCTION OutputIterator set_union_team_impl(
+    const TeamHandleType& teamHandle, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first) {
+  using pred_t =
+      std_set_operation_default_comparator_t<InputIterator1, InputIterator2>;
+  return set_operation_team_impl<StdSetUnionTag>(teamHandle, first1, last1,
+                                                 first2, last2, d_first,
+                                                 pred_t());
+}
+
+//
+// set_intersection
+//
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator set_intersection_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first, ComparatorType comp) {
+  return set_operation_exespace_impl<StdSetIntersectionTag>(label, ex, first1,
+                                                            last1, first2,
+                                                            last2, d_first,
+                                                            std::move(comp));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator set_intersection_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first) {
+  using pred_t =
+      std_set_operation_default_comparator_t<InputIterator1, InputIterator2>;
+  return set_operation_exespace_impl<StdSetIntersectionTag>(label, ex, first1,
+                                                            last1, first2,
+                                                            last2, d_first,
+                                                            pred_t());
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+KOKKOS_FUNCTION OutputIterator set_intersection_team_impl(
+    const TeamHandleType& teamHandle, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first, ComparatorType comp) {
+  return set_operation_team_impl<StdSetIntersectionTag>(teamHandle, first1,
+                                                        last1, first2, last2,
+                                                        d_first,
+                                                        std::move(comp));
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+KOKKOS_FUNCTION OutputIterator set_intersection_team_impl(
+    const TeamHandleType& teamHandle, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first) {
+  using pred_t =
+      std_set_operation_default_comparator_t<InputIterator1, InputIterator2>;
+  return set_operation_team_impl<StdSetIntersectionTag>(teamHandle, first1,
+                                                        last1, first2, last2,
+                                                        d_first, pred_t());
+}
+
+//
+// set_difference
+//
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator set_difference_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first, ComparatorType comp) {
+  return set_operation_exespace_impl<StdSetDifferenceTag>(label, ex, first1,
+                                                          last1, first2, last2,
+                                                          d_first,
+                                                          std::move(comp));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator set_difference_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first) {
+  using pred_t =
+      std_set_operation_default_comparator_t<InputIterator1, InputIterator2>;
+  return set_operation_exespace_impl<StdSetDifferenceTag>(label, ex, first1,
+                                                          last1, first2, last2,
+                                                          d_first, pred_t());
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+KOKKOS_FUNCTION OutputIterator set_difference_team_impl(
+    const TeamHandleType& teamHandle, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first, ComparatorType comp) {
+  return set_operation_team_impl<StdSetDifferenceTag>(teamHandle, first1, last1,
+                                                      first2, last2, d_first,
+                                                      std::move(comp));
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+KOKKOS_FUNCTION OutputIterator set_difference_team_impl(
+    const TeamHandleType& teamHandle, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+    OutputIterator d_first) {
+  using pred_t =
+      std_set_operation_default_comparator_t<InputIterator1, InputIterator2>;
+  return set_operation_team_impl<StdSetDifferenceTag>(teamHandle, first1, last1,
+                                                      first2, last2, d_first,
+                                                      pred_t());
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
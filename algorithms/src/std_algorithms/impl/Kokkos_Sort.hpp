@@ -0,0 +1,383 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_SORT_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_SORT_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include <sorting/Kokkos_NestedSortPublicAPI.hpp>
+#include <sorting/Kokkos_SortByKeyPublicAPI.hpp>
+#include <sorting/Kokkos_SortPublicAPI.hpp>
+#include <sorting/impl/Kokkos_HostMergeSortImpl.hpp>
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <algorithm>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// Below this size nth_element stops partitioning and sorts what is left.
+inline constexpr std::ptrdiff_t nth_element_sort_threshold = 16384;
+
+// Views on [first, last) that can be handed to the sorting routines, which
+// only accept views.
+template <class IteratorType>
+KOKKOS_FUNCTION auto make_unmanaged_view_from_iterators(IteratorType first,
+                                                        IteratorType last) {
+  using view_type = typename IteratorType::view_type;
+  using unmanaged_view_type =
+      Kokkos::View<typename view_type::value_type*, Kokkos::LayoutStride,
+                   typename view_type::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  return unmanaged_view_type(
+      first.data(),
+      Kokkos::LayoutStride(Kokkos::Experimental::distance(first, last),
+                           first.stride()));
+}
+
+//
+// sort
+//
+template <class ExecutionSpace, class IteratorType, class... MaybeComparator>
+void sort_exespace_impl(const std::string& label, const ExecutionSpace& ex,
+                        IteratorType first, IteratorType last,
+                        MaybeComparator&&... maybeComparator) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+
+  if (Kokkos::Experimental::distance(first, last) <= 1) {
+    return;
+  }
+
+  // run
+  Kokkos::Profiling::pushRegion(label + " via Kokkos::sort");
+  Kokkos::sort(ex, make_unmanaged_view_from_iterators(first, last),
+               std::forward<MaybeComparator>(maybeComparator)...);
+  ex.fence("Kokkos::sort: fence after operation");
+  Kokkos::Profiling::popRegion();
+}
+
+//
+// stable_sort
+//
+template <class ExecutionSpace, class IteratorType, class... MaybeComparator>
+void stable_sort_exespace_impl(const std::string& label,
+                               const ExecutionSpace& ex, IteratorType first,
+                               IteratorType last,
+                               const MaybeComparator&... maybeComparator) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  if (num_elements <= 1) {
+    return;
+  }
+
+  // run
+  auto view       = make_unmanaged_view_from_iterators(first, last);
+  using view_type = decltype(view);
+  if constexpr (::Kokkos::Impl::better_off_calling_std_sort_v<
+                    ExecutionSpace>) {
+    // host backends merge sort chunks in parallel
+    Kokkos::Profiling::pushRegion(label + " via parallel merge sort");
+    const std::size_t num_chunks = std::min<std::size_t>(
+        ex.concurrency(),
+        num_elements / ::Kokkos::Impl::host_merge_sort_min_chunk_size);
+    if constexpr (sizeof...(MaybeComparator) == 0) {
+      ::Kokkos::Impl::host_merge_sort<true>(ex, view, num_chunks,
+                                            std::less<>{});
+    } else {
+      ::Kokkos::Impl::host_merge_sort<true>(ex, view, num_chunks,
+                                            maybeComparator...);
+    }
+  } else if constexpr (sizeof...(MaybeComparator) == 0 &&
+                       std::is_integral_v<
+                           typename view_type::non_const_value_type>) {
+    // equal integers cannot be told apart, so any sort is stable
+    Kokkos::Profiling::pushRegion(label + " via Kokkos::sort");
+    Kokkos::sort(ex, view);
+  } else {
+    // the keys are sorted along with values nobody looks at
+    Kokkos::Profiling::pushRegion(label + " via Kokkos::stable_sort_by_key");
+    Kokkos::View<unsigned int*, ExecutionSpace> unused_values(
+        Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                           "Kokkos::stable_sort::unused_values"),
+        num_elements);
+    Kokkos::Experimental::stable_sort_by_key(ex, view, unused_values,
+                                             maybeComparator...);
+  }
+  ex.fence("Kokkos::stable_sort: fence after operation");
+  Kokkos::Profiling::popRegion();
+}
+
+//
+// nth_element
+//
+template <class IndexType>
+struct StdNthElementCounts {
+  IndexType m_less;
+  IndexType m_equal;
+};
+
+// median of the first, middle and last elements of [lo, hi)
+template <class ViewType, class PivotViewType, class ComparatorType>
+struct StdNthElementPivotFunctor {
+  using index_type = std::ptrdiff_t;
+
+  ViewType m_view;
+  PivotViewType m_pivot;
+  index_type m_lo;
+  index_type m_hi;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(int) const {
+    const auto& a = m_view(m_lo);
+    const auto& b = m_view(m_lo + (m_hi - m_lo) / 2);
+    const auto& c = m_view(m_hi - 1);
+    if (m_comp(a, b)) {
+      m_pivot() = m_comp(b, c) ? b : (m_comp(a, c) ? c : a);
+    } else {
+      m_pivot() = m_comp(a, c) ? a : (m_comp(b, c) ? c : b);
+    }
+  }
+};
+
+//
+// Three way partition of [lo, hi) around the pivot: the reduction counts the
+// elements less than and equivalent to the pivot and the scan then moves
+// every element to its part in the buffer.
+//
+template <class ViewType, class PivotViewType, class BufferViewType,
+          class ComparatorType>
+struct StdNthElementPartitionFunctor {
+  using index_type = std::ptrdiff_t;
+  using value_type = StdNthElementCounts<index_type>;
+
+  ViewType m_view;
+  PivotViewType m_pivot;
+  BufferViewType m_buffer;
+  index_type m_lo;
+  value_type m_totals;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void init(value_type& update) const { update = {0, 0}; }
+
+  KOKKOS_FUNCTION
+  void join(value_type& update, const value_type& input) const {
+    update.m_less += input.m_less;
+    update.m_equal += input.m_equal;
+  }
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type i, value_type& update) const {
+    const auto& value = m_view(i);
+    if (m_comp(value, m_pivot())) {
+      ++update.m_less;
+    } else if (!m_comp(m_pivot(), value)) {
+      ++update.m_equal;
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type i, value_type& update,
+                  const bool final_pass) const {
+    const auto& value  = m_view(i);
+    const bool less    = m_comp(value, m_pivot());
+    const bool greater = !less && m_comp(m_pivot(), value);
+    if (final_pass) {
+      index_type dest = m_lo;
+      if (less) {
+        dest += update.m_less;
+      } else if (!greater) {
+        dest += m_totals.m_less + update.m_equal;
+      } else {
+        dest += i - m_lo + m_totals.m_less + m_totals.m_equal -
+                update.m_less - update.m_equal;
+      }
+      m_buffer(dest) = value;
+    }
+    if (less) {
+      ++update.m_less;
+    } else if (!greater) {
+      ++update.m_equal;
+    }
+  }
+};
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void nth_element_exespace_impl(const std::string& label,
+                               const ExecutionSpace& ex, IteratorType first,
+                               IteratorType nth, IteratorType last,
+                               ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, nth);
+  Impl::expect_valid_range(nth, last);
+
+  if (nth == last || Kokkos::Experimental::distance(first, last) <= 1) {
+    return;
+  }
+
+  // quickselect where each partition step is a parallel reduction and scan;
+  // only the part containing nth is kept until it is small enough to be sorted
+  using index_type  = std::ptrdiff_t;
+  using value_type  = typename IteratorType::value_type;
+  auto view         = make_unmanaged_view_from_iterators(first, last);
+  using view_type   = decltype(view);
+  using pivot_type  = Kokkos::View<value_type, ExecutionSpace>;
+  using buffer_type = Kokkos::View<value_type*, ExecutionSpace>;
+  using pivot_functor_type =
+      StdNthElementPivotFunctor<view_type, pivot_type, ComparatorType>;
+  using partition_functor_type =
+      StdNthElementPartitionFunctor<view_type, pivot_type, buffer_type,
+                                    ComparatorType>;
+
+  const index_type nth_index = Kokkos::Experimental::distance(first, nth);
+  index_type lo              = 0;
+  index_type hi              = Kokkos::Experimental::distance(first, last);
+  pivot_type pivot(Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                                      "std_nth_element_pivot"));
+  buffer_type buffer;
+  while (hi - lo > nth_element_sort_threshold) {
+    if (buffer.extent(0) == 0) {
+      buffer = buffer_type(Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                                              "std_nth_element_tmp_view"),
+                           hi);
+    }
+    ::Kokkos::parallel_for(label + " pivot",
+                           RangePolicy<ExecutionSpace>(ex, 0, 1),
+                           pivot_functor_type{view, pivot, lo, hi, comp});
+
+    typename partition_functor_type::value_type totals{0, 0};
+    ::Kokkos::parallel_reduce(
+        label + " count", RangePolicy<ExecutionSpace>(ex, lo, hi),
+        partition_functor_type{view, pivot, buffer, lo, totals, comp}, totals);
+    ::Kokkos::parallel_scan(
+        label + " partition", RangePolicy<ExecutionSpace>(ex, lo, hi),
+        partition_functor_type{view, pivot, buffer, lo, totals, comp});
+    Kokkos::deep_copy(ex, Kokkos::subview(view, Kokkos::pair(lo, hi)),
+                      Kokkos::subview(buffer, Kokkos::pair(lo, hi)));
+
+    const index_type less_end  = lo + totals.m_less;
+    const index_type equal_end = less_end + totals.m_equal;
+    if (nth_index < less_end) {
+      hi = less_end;
+    } else if (nth_index < equal_end) {
+      ex.fence("Kokkos::nth_element: fence after operation");
+      return;
+    } else {
+      lo = equal_end;
+    }
+  }
+
+  Kokkos::sort(ex, Kokkos::subview(view, Kokkos::pair(lo, hi)), comp);
+  ex.fence("Kokkos::nth_element: fence after operation");
+}
+
+template <class ExecutionSpace, class IteratorType>
+void nth_element_exespace_impl(const std::string& label,
+                               const ExecutionSpace& ex, IteratorType first,
+                               IteratorType nth, IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  nth_element_exespace_impl(label, ex, first, nth, last, pred_t());
+}
+
+//
+// partial_sort
+//
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void partial_sort_exespace_impl(const std::string& label,
+                                const ExecutionSpace& ex, IteratorType first,
+                                IteratorType middle, IteratorType last,
+                                ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, middle);
+  Impl::expect_valid_range(middle, last);
+
+  // select the smallest elements first so only those need to be sorted
+  nth_element_exespace_impl(label, ex, first, middle, last, comp);
+  sort_exespace_impl(label, ex, first, middle, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType>
+void partial_sort_exespace_impl(const std::string& label,
+                                const ExecutionSpace& ex, IteratorType first,
+                                IteratorType middle, IteratorType last) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, middle);
+  Impl::expect_valid_range(middle, last);
+
+  nth_element_exespace_impl(label, ex, first, middle, last);
+  sort_exespace_impl(label, ex, first, middle);
+}
+
+//
+// team impl
+//
+// The bitonic team sort needs no extra memory. nth_element and partial_sort
+// sort the whole range with it since partitioning would need a buffer.
+//
+template <class TeamHandleType, class IteratorType, class... MaybeComparator>
+KOKKOS_FUNCTION void sort_team_impl(const TeamHandleType& teamHandle,
+                                    IteratorType first, IteratorType last,
+                                    const MaybeComparator&... maybeComparator) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // sort_team ends with a barrier
+  Kokkos::Experimental::sort_team(
+      teamHandle, make_unmanaged_view_from_iterators(first, last),
+      maybeComparator...);
+}
+
+template <class TeamHandleType, class IteratorType, class... MaybeComparator>
+KOKKOS_FUNCTION void nth_element_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first,
+    [[maybe_unused]] IteratorType nth, IteratorType last,
+    const MaybeComparator&... maybeComparator) {
+  Impl::expect_valid_range(first, nth);
+  Impl::expect_valid_range(nth, last);
+  sort_team_impl(teamHandle, first, last, maybeComparator...);
+}
+
+template <class TeamHandleType, class IteratorType, class... MaybeComparator>
+KOKKOS_FUNCTION void partial_sort_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first,
+    [[maybe_unused]] IteratorType middle, IteratorType last,
+    const MaybeComparator&... maybeComparator) {
+  Impl::expect_valid_range(first, middle);
+  Impl::expect_valid_range(middle, last);
+  sort_team_impl(teamHandle, first, last, maybeComparator...);
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -27,7 +27,9 @@ import kokkos.sort;
 #include <Kokkos_Random.hpp>
 #include <Kokkos_Sort.hpp>
 #endif
+#include <algorithm>
 #include <random>
+#include <vector>
 
 namespace Test {
 namespace BinSortSetA {
@@ -224,6 +226,84 @@ void test_sort_integer_overflow() {
       << "view (" << vh[0] << ", " << vh[1] << ") is not sorted";
 }
 
+template <class ExecutionSpace>
+void test_sort_within_skewed_bins() {
+  // Most keys fall in the first bin, which is too large to be sorted by a
+  // single thread.
+  constexpr int n = 30000;
+  std::vector<int> keys_std(n);
+  std::mt19937 gen(1931);
+  std::uniform_int_distribution<int> first_bin(0, 999);
+  std::uniform_int_distribution<int> other_bins(1000, 15999);
+  for (int i = 0; i < n; ++i) {
+    keys_std[i] = i % 3 == 0 ? other_bins(gen) : first_bin(gen);
+  }
+
+  using KeyViewType = Kokkos::View<int*, ExecutionSpace>;
+  ExecutionSpace exec;
+  KeyViewType keys("keys", n);
+  Kokkos::deep_copy(exec, keys,
+                    Kokkos::View<const int*, Kokkos::HostSpace>(
+                        keys_std.data(), keys_std.size()));
+
+  using BinOp_t = Kokkos::BinOp1D<KeyViewType>;
+  BinOp_t bin_op(16, 0, 16000);
+  Kokkos::BinSort<KeyViewType, BinOp_t> Sorter(exec, keys, bin_op,
+                                               /*sort_within_bins*/ true);
+  Sorter.create_permute_vector(exec);
+  Sorter.sort(exec, keys);
+
+  auto keys_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, keys);
+  std::sort(keys_std.begin(), keys_std.end());
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(keys_h(i), keys_std[i]) << "at index " << i;
+  }
+}
+
+template <class ExecutionSpace>
+void test_permutation_plan() {
+  constexpr int n = 1000;
+  using KeyViewType = Kokkos::View<int*, ExecutionSpace>;
+  ExecutionSpace exec;
+  KeyViewType keys("keys", n);
+  Kokkos::View<double*, ExecutionSpace> values1("values1", n);
+  Kokkos::View<int* [2], ExecutionSpace> values2("values2", n);
+  Kokkos::Random_XorShift64_Pool<ExecutionSpace> g(73);
+  Kokkos::fill_random(exec, keys, g, 0, 100);
+  Kokkos::fill_random(exec, values1, g, -1., 1.);
+  Kokkos::fill_random(exec, values2, g, 1000);
+
+  using BinOp_t = Kokkos::BinOp1D<KeyViewType>;
+  BinOp_t bin_op(10, 0, 100);
+  Kokkos::BinSort<KeyViewType, BinOp_t> Sorter(exec, keys, bin_op, true);
+  Sorter.create_permute_vector(exec);
+
+  // Sorting every view separately is the reference
+  Kokkos::View<double*, ExecutionSpace> expected1("expected1", n);
+  Kokkos::View<int* [2], ExecutionSpace> expected2("expected2", n);
+  Kokkos::deep_copy(exec, expected1, values1);
+  Kokkos::deep_copy(exec, expected2, values2);
+  Sorter.sort(exec, expected1);
+  Sorter.sort(exec, expected2);
+
+  auto const plan = Sorter.get_permutation_plan();
+  plan.apply(exec, values1, values2);
+
+  auto values1_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, values1);
+  auto values2_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, values2);
+  auto expected1_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, expected1);
+  auto expected2_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, expected2);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(values1_h(i), expected1_h(i));
+    ASSERT_EQ(values2_h(i, 0), expected2_h(i, 0));
+    ASSERT_EQ(values2_h(i, 1), expected2_h(i, 1));
+  }
+}
+
 }  // namespace BinSortSetA
 
 TEST(TEST_CATEGORY, BinSortGenericTests) {
@@ -297,5 +377,57 @@ TEST(TEST_CATEGORY, BinSort_issue_7221) {
   Sorter.create_permute_vector(ExecutionSpace{});  // does not throw
 }
 
+TEST(TEST_CATEGORY, BinSortSkewedBins) {
+  BinSortSetA::test_sort_within_skewed_bins<TEST_EXECSPACE>();
+}
+
+TEST(TEST_CATEGORY, BinSortPermutationPlan) {
+  BinSortSetA::test_permutation_plan<TEST_EXECSPACE>();
+}
+
+TEST(TEST_CATEGORY_DEATH, BinSortPermutationPlanShortView) {
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+  using ExecutionSpace = TEST_EXECSPACE;
+  Kokkos::View<int*, ExecutionSpace> permute("permute", 10);
+  Kokkos::View<int*, ExecutionSpace> values("values", 10);
+  Kokkos::View<int*, ExecutionSpace> short_values("short_values", 5);
+  Kokkos::View<int*, ExecutionSpace> empty_values("empty_values", 0);
+  Kokkos::Experimental::PermutationPlan<decltype(permute)> plan(permute);
+  Kokkos::Experimental::PermutationPlan<decltype(permute)> shifted_plan(
+      permute, 0, 1);
+
+  ASSERT_DEATH(plan.apply(ExecutionSpace(), values, short_values),
+               "the View extent is 5, but the permutation needs 10 rows");
+  // an empty view is too short as well and does not skip the other ones
+  ASSERT_DEATH(plan.apply(ExecutionSpace(), empty_values, values),
+               "the View extent is 0, but the permutation needs 10 rows");
+  ASSERT_DEATH(shifted_plan.apply(ExecutionSpace(), values),
+               "the View extent is 10, but the permutation needs 11 rows");
+}
+
+TEST(TEST_CATEGORY_DEATH, BinSortShiftedSourceShortView) {
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+  using ExecutionSpace = TEST_EXECSPACE;
+  Kokkos::View<int*, ExecutionSpace> permute("permute", 10);
+  Kokkos::View<int*, ExecutionSpace> values("values", 10);
+  Kokkos::Experimental::PermutationPlan<decltype(permute)> shifted_plan(
+      permute, 1, 0);
+
+  // reading rows 1 + permute(i) runs one past the end of the views
+  ASSERT_DEATH(shifted_plan.apply(ExecutionSpace(), values),
+               "the View extent is 10, but the permutation needs 11 rows");
+
+  using KeyViewType = Kokkos::View<int*, ExecutionSpace>;
+  using BinOp       = Kokkos::BinOp1D<KeyViewType>;
+  KeyViewType keys("keys", 10);
+  Kokkos::BinSort<KeyViewType, BinOp> bin_sort(keys, 2, 7, BinOp(5, 0, 10));
+  bin_sort.create_permute_vector(ExecutionSpace());
+  // the sorted key range [2, 7) is applied to values [6, 11)
+  ASSERT_DEATH(bin_sort.sort(ExecutionSpace(), values, 6, 11),
+               "values range end exceeds values extent");
+}
+
 }  // namespace Test
 #endif
@@ -0,0 +1,233 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_ALGORITHMS_UNITTESTS_TEST_HISTOGRAM_HPP
+#define KOKKOS_ALGORITHMS_UNITTESTS_TEST_HISTOGRAM_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Macros.hpp>
+#ifdef KOKKOS_ENABLE_EXPERIMENTAL_CXX20_MODULES
+import kokkos.random;
+import kokkos.sort;
+#else
+#include <Kokkos_Random.hpp>
+#include <Kokkos_Sort.hpp>
+#endif
+#include <vector>
+
+namespace Test {
+namespace HistogramImpl {
+
+// Keys in [-2, num_bins + 2) so that some of them fall outside the bins,
+// and weights in [0, 4) which are summed exactly.
+template <class ExecutionSpace>
+auto make_keys_and_weights(const ExecutionSpace& exec, std::size_t n,
+                           int num_bins) {
+  Kokkos::View<int*, ExecutionSpace> keys("keys", n);
+  Kokkos::View<double*, ExecutionSpace> weights("weights", n);
+  Kokkos::Random_XorShift64_Pool<ExecutionSpace> pool(n + num_bins);
+  Kokkos::fill_random(exec, keys, pool, -2, num_bins + 2);
+  Kokkos::fill_random(exec, weights, pool, 0, 4);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(int i) { weights(i) = int(weights(i)); });
+  return std::make_pair(keys, weights);
+}
+
+template <class KeysView, class WeightsView, class BinOp>
+auto compute_gold(const KeysView& keys, const WeightsView& weights,
+                  const BinOp& bin_op, int num_bins) {
+  auto keys_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, keys);
+  auto weights_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, weights);
+  std::vector<int> counts(num_bins);
+  std::vector<double> sums(num_bins);
+  for (std::size_t i = 0; i < keys_h.extent(0); ++i) {
+    int const bin = bin_op(keys_h(i));
+    if (bin >= 0 && bin < num_bins) {
+      counts[bin] += 1;
+      sums[bin] += weights_h(i);
+    }
+  }
+  return std::make_pair(counts, sums);
+}
+
+template <class CountsView, class GoldType>
+void check_counts(const CountsView& counts, const std::vector<GoldType>& gold) {
+  auto counts_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, counts);
+  ASSERT_EQ(gold.size(), counts_h.extent(0));
+  for (std::size_t b = 0; b < gold.size(); ++b) {
+    ASSERT_EQ(gold[b], counts_h(b)) << "at bin " << b;
+  }
+}
+
+template <class ExecutionSpace>
+void test_histogram(std::size_t n, int num_bins) {
+  ExecutionSpace exec;
+  auto [keys, weights] = make_keys_and_weights(exec, n, num_bins);
+  Kokkos::View<int*, ExecutionSpace> counts("counts", num_bins);
+  Kokkos::View<double*, ExecutionSpace> sums("sums", num_bins);
+
+  // the keys are the bins
+  {
+    auto [gold_counts, gold_sums] =
+        compute_gold(keys, weights, [](int key) { return key; }, num_bins);
+    Kokkos::deep_copy(counts, -1);
+    Kokkos::Experimental::histogram(exec, keys, counts);
+    check_counts(counts, gold_counts);
+    Kokkos::Experimental::histogram(exec, keys, weights, sums);
+    check_counts(sums, gold_sums);
+
+    // floating-point keys are truncated, but the ones in (-1, 0) must be
+    // dropped like the other negative keys instead of landing in bin 0
+    Kokkos::View<double*, ExecutionSpace> fp_keys("fp_keys", n);
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(int i) { fp_keys(i) = keys(i) + 0.5; });
+    Kokkos::Experimental::histogram(exec, fp_keys, counts);
+    check_counts(counts, gold_counts);
+    Kokkos::Experimental::histogram(exec, fp_keys, weights, sums);
+    check_counts(sums, gold_sums);
+  }
+
+  // two keys per bin through a bin op
+  {
+    int const num_keys = num_bins + 4;
+    Kokkos::BinOp1D<Kokkos::View<int*, ExecutionSpace>> bin_op(
+        (num_keys + 1) / 2, -2, num_bins + 2);
+    auto [gold_counts, gold_sums] = compute_gold(
+        keys, weights,
+        [&](int key) { return int(bin_op.mul_ * (key - bin_op.min_)); },
+        num_bins);
+    Kokkos::Experimental::histogram(exec, keys, bin_op, counts);
+    check_counts(counts, gold_counts);
+    Kokkos::Experimental::histogram(exec, keys, bin_op, weights, sums);
+    check_counts(sums, gold_sums);
+  }
+
+  // every strategy runs on every backend
+  auto [gold_counts, gold_sums] =
+      compute_gold(keys, weights, [](int key) { return key; }, num_bins);
+  using Kokkos::Impl::HistogramStrategy;
+  for (auto strategy :
+       {HistogramStrategy::serial, HistogramStrategy::private_bins,
+        HistogramStrategy::team_scratch, HistogramStrategy::atomic}) {
+    if (strategy == HistogramStrategy::team_scratch &&
+        static_cast<std::size_t>(num_bins) * sizeof(double) >
+            static_cast<std::size_t>(
+                Kokkos::TeamPolicy<ExecutionSpace>::scratch_size_max(0)))
+      continue;
+    std::size_t const num_chunks =
+        strategy == HistogramStrategy::serial ? 1 : 3;
+    Kokkos::deep_copy(counts, -1);
+    Kokkos::Impl::histogram_with_strategy(
+        exec, strategy, num_chunks, keys,
+        Kokkos::Impl::HistogramIdentityBinOp{},
+        Kokkos::Impl::HistogramUnitWeights{}, counts);
+    check_counts(counts, gold_counts);
+    Kokkos::Impl::histogram_with_strategy(
+        exec, strategy, num_chunks, keys,
+        Kokkos::Impl::HistogramIdentityBinOp{}, weights, sums);
+    check_counts(sums, gold_sums);
+  }
+}
+
+// every team computes the histogram of one row of keys in scratch memory
+template <class ExecutionSpace>
+void test_histogram_team(int num_rows, int num_cols, int num_bins) {
+  ExecutionSpace exec;
+  // no structured bindings, they cannot be captured by the lambda below
+  auto const keys_and_weights =
+      make_keys_and_weights(exec, num_rows * num_cols, num_bins);
+  auto const keys    = keys_and_weights.first;
+  auto const weights = keys_and_weights.second;
+  Kokkos::View<int**, ExecutionSpace> counts("counts", num_rows, num_bins);
+  Kokkos::View<double**, ExecutionSpace> sums("sums", num_rows, num_bins);
+
+  using policy_type  = Kokkos::TeamPolicy<ExecutionSpace>;
+  using member_type  = typename policy_type::member_type;
+  using scratch_view =
+      Kokkos::View<int*, typename ExecutionSpace::scratch_memory_space,
+                   Kokkos::MemoryUnmanaged>;
+  policy_type policy(exec, num_rows, Kokkos::AUTO);
+  policy.set_scratch_size(0,
+                          Kokkos::PerTeam(scratch_view::shmem_size(num_bins)));
+  Kokkos::parallel_for(
+      policy, KOKKOS_LAMBDA(const member_type& member) {
+        int const row = member.league_rank();
+        auto const range =
+            Kokkos::make_pair(row * num_cols, (row + 1) * num_cols);
+        auto const row_keys    = Kokkos::subview(keys, range);
+        auto const row_weights = Kokkos::subview(weights, range);
+        scratch_view row_counts(member.team_scratch(0), num_bins);
+        Kokkos::Experimental::histogram(member, row_keys, row_counts);
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(member, num_bins),
+            [&](int b) { counts(row, b) = row_counts(b); });
+        Kokkos::Experimental::histogram(member, row_keys, row_weights,
+                                        Kokkos::subview(sums, row,
+                                                        Kokkos::ALL));
+      });
+
+  auto keys_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, keys);
+  auto weights_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, weights);
+  auto counts_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, counts);
+  auto sums_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, sums);
+  for (int row = 0; row < num_rows; ++row) {
+    std::vector<int> gold_counts(num_bins);
+    std::vector<double> gold_sums(num_bins);
+    for (int i = row * num_cols; i < (row + 1) * num_cols; ++i) {
+      if (keys_h(i) >= 0 && keys_h(i) < num_bins) {
+        gold_counts[keys_h(i)] += 1;
+        gold_sums[keys_h(i)] += weights_h(i);
+      }
+    }
+    for (int b = 0; b < num_bins; ++b) {
+      ASSERT_EQ(gold_counts[b], counts_h(row, b)) << row << ", " << b;
+      ASSERT_EQ(gold_sums[b], sums_h(row, b)) << row << ", " << b;
+    }
+  }
+}
+
+}  // namespace HistogramImpl
+
+TEST(TEST_CATEGORY, Histogram) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  for (std::size_t n : {0, 1, 1000, 100000, 1000003}) {
+    for (int num_bins : {1, 7, 256, 5000, 300000}) {
+      HistogramImpl::test_histogram<ExecutionSpace>(n, num_bins);
+    }
+  }
+}
+
+TEST(TEST_CATEGORY, HistogramTeam) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  for (int num_cols : {0, 1, 13, 1000}) {
+    for (int num_bins : {1, 7, 256}) {
+      HistogramImpl::test_histogram_team<ExecutionSpace>(11, num_cols,
+                                                         num_bins);
+    }
+  }
+}
+
+}  // namespace Test
+#endif
@@ -213,6 +213,99 @@ void test_sort_integer_overflow() {
       << "view (" << vh[0] << ", " << vh[1] << ") is not sorted";
 }
 
+template <class ExecutionSpace>
+void test_host_merge_sort_impl() {
+  // Exercise the merge rounds with chunk counts that are not powers of two
+  // and extents that do not divide evenly, independently of the concurrency
+  // of the execution space.
+  ExecutionSpace exec;
+  for (std::size_t n : {0, 1, 2, 7, 1000, 10007}) {
+    for (std::size_t num_chunks : {1, 2, 3, 5, 8, 13}) {
+      // strided view with a descending comparator
+      Kokkos::View<int**, Kokkos::LayoutRight, Kokkos::HostSpace> data(
+          "data", n, 3);
+      auto keys = Kokkos::subview(data, Kokkos::ALL, 1);
+      std::vector<int> expected(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        keys(i) = expected[i] = static_cast<int>((i * 7919) % 1009) - 500;
+      }
+      Kokkos::Impl::host_merge_sort(exec, keys, num_chunks,
+                                    std::greater<int>{});
+      std::sort(expected.begin(), expected.end(), std::greater<int>{});
+      for (std::size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(keys(i), expected[i]) << "n = " << n << " ; i = " << i;
+      }
+
+      // stable variant compares only the first member of the pairs
+      using pair_type = Kokkos::pair<int, int>;
+      Kokkos::View<pair_type*, Kokkos::HostSpace> pairs("pairs", n);
+      for (std::size_t i = 0; i < n; ++i) {
+        pairs(i) = pair_type(static_cast<int>(i % 17), static_cast<int>(i));
+      }
+      Kokkos::Impl::host_merge_sort<true>(
+          exec, pairs, num_chunks,
+          [](const pair_type& a, const pair_type& b) {
+            return a.first < b.first;
+          });
+      for (std::size_t i = 1; i < n; ++i) {
+        ASSERT_TRUE(pairs(i - 1).first < pairs(i).first ||
+                    (pairs(i - 1).first == pairs(i).first &&
+                     pairs(i - 1).second < pairs(i).second))
+            << "n = " << n << " ; i = " << i;
+      }
+    }
+  }
+}
+
+template <class ExecutionSpace, class KeyType>
+void test_radix_sort_key_type(std::size_t n) {
+  // values spread over the whole range of KeyType, including negative numbers
+  // and extreme values
+  Kokkos::View<KeyType*, Kokkos::HostSpace> expected("expected", n);
+  std::uint64_t state = 88172645463325252ull;
+  for (std::size_t i = 0; i < n; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    if constexpr (std::is_floating_point_v<KeyType>) {
+      expected(i) = static_cast<KeyType>(static_cast<std::int64_t>(state)) *
+                    KeyType(1e-12);
+    } else {
+      expected(i) = static_cast<KeyType>(state >> (i % 64));
+    }
+  }
+  if (n > 4) {
+    expected(0) = Kokkos::Experimental::finite_max<KeyType>::value;
+    expected(1) = Kokkos::Experimental::finite_min<KeyType>::value;
+    expected(2) = KeyType(0);
+    expected(3) = Kokkos::Experimental::finite_min<KeyType>::value;
+  }
+
+  ExecutionSpace exec;
+  Kokkos::View<KeyType*, ExecutionSpace> keys("keys", n);
+  Kokkos::View<KeyType*, ExecutionSpace> keys_radix("keys_radix", n);
+  Kokkos::deep_copy(exec, keys, expected);
+  Kokkos::deep_copy(exec, keys_radix, expected);
+  Kokkos::sort(exec, keys);
+  Kokkos::Impl::radix_sort(exec, keys_radix);
+  std::sort(expected.data(), expected.data() + n);
+
+  auto keys_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), keys);
+  auto keys_radix_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), keys_radix);
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(keys_h(i), expected(i)) << "n = " << n << " ; i = " << i;
+    ASSERT_EQ(keys_radix_h(i), expected(i)) << "n = " << n << " ; i = " << i;
+  }
+}
+
+template <class ExecutionSpace, class KeyType>
+void test_radix_sort_key_type() {
+  for (std::size_t n : {2, 3, 100, 1023, 1024, 5000, 100000}) {
+    test_radix_sort_key_type<ExecutionSpace, KeyType>(n);
+  }
+}
+
 }  // namespace SortImpl
 
 TEST(TEST_CATEGORY, SortUnsignedValueType) {
@@ -250,5 +343,26 @@ TEST(TEST_CATEGORY, SortEmptyView) {
   Kokkos::sort(v);
 }
 
+TEST(TEST_CATEGORY, SortHostMergeSort) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  if constexpr (Kokkos::Impl::better_off_calling_std_sort_v<ExecutionSpace>) {
+    SortImpl::test_host_merge_sort_impl<ExecutionSpace>();
+  } else {
+    GTEST_SKIP() << "only host execution spaces use the host merge sort";
+  }
+}
+
+TEST(TEST_CATEGORY, SortRadix) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  SortImpl::test_radix_sort_key_type<ExecutionSpace, std::int8_t>();
+  SortImpl::test_radix_sort_key_type<ExecutionSpace, std::uint16_t>();
+  SortImpl::test_radix_sort_key_type<ExecutionSpace, std::int32_t>();
+  SortImpl::test_radix_sort_key_type<ExecutionSpace, std::uint32_t>();
+  SortImpl::test_radix_sort_key_type<ExecutionSpace, std::int64_t>();
+  SortImpl::test_radix_sort_key_type<ExecutionSpace, std::uint64_t>();
+  SortImpl::test_radix_sort_key_type<ExecutionSpace, float>();
+  SortImpl::test_radix_sort_key_type<ExecutionSpace, double>();
+}
+
 }  // namespace Test
 #endif
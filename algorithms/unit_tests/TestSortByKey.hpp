@@ -266,6 +266,135 @@ TEST(TEST_CATEGORY, SortByKeyWithStrides) {
   ASSERT_EQ(sort_fails, 0u);
 }
 
+TEST(TEST_CATEGORY, SortByKeyRadix) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  using MemorySpace    = typename ExecutionSpace::memory_space;
+
+  ExecutionSpace space{};
+
+  // many duplicated keys to check that the order of values with equal keys is
+  // preserved
+  for (int n : {2, 17, 1500, 40000}) {
+    Kokkos::View<std::int64_t *, Kokkos::HostSpace> keys_h("keys_h", n);
+    for (int i = 0; i < n; ++i) {
+      keys_h(i) = (i % 2 == 0 ? -1 : 1) * (std::int64_t(i % 37) << 40);
+    }
+    Kokkos::View<std::int64_t *, MemorySpace> keys("keys", n);
+    Kokkos::View<int *, ExecutionSpace> values("values", n);
+    Kokkos::View<double *, ExecutionSpace> floats("floats", n);
+    Kokkos::deep_copy(space, keys, keys_h);
+    SortImpl::iota(space, values);
+    SortImpl::iota(space, floats, 0.5);
+
+    Kokkos::Impl::radix_sort(space, keys, values, floats);
+
+    auto keys_sorted =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, keys);
+    auto values_sorted =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, values);
+    auto floats_sorted =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, floats);
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(keys_sorted(i), keys_h(values_sorted(i)));
+      ASSERT_EQ(floats_sorted(i), values_sorted(i) + 0.5);
+      if (i > 0) {
+        ASSERT_LE(keys_sorted(i - 1), keys_sorted(i));
+        if (keys_sorted(i - 1) == keys_sorted(i)) {
+          ASSERT_LT(values_sorted(i - 1), values_sorted(i));
+        }
+      }
+    }
+  }
+}
+
+template <class Comparator>
+void test_stable_sort_by_key(int n, bool with_comparator) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  using MemorySpace    = typename ExecutionSpace::memory_space;
+
+  ExecutionSpace space{};
+
+  Kokkos::View<int *, Kokkos::HostSpace> keys_h("keys_h", n);
+  for (int i = 0; i < n; ++i) keys_h(i) = (i * 7) % 23;
+  Kokkos::View<int *, MemorySpace> keys("keys", n);
+  Kokkos::deep_copy(space, keys, keys_h);
+  Kokkos::View<int *, ExecutionSpace> permute("permute", n);
+  SortImpl::iota(space, permute);
+
+  Comparator comparator;
+  if (with_comparator)
+    Kokkos::Experimental::stable_sort_by_key(space, keys, permute, comparator);
+  else
+    Kokkos::Experimental::stable_sort_by_key(space, keys, permute);
+
+  auto keys_sorted =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, keys);
+  auto permute_sorted =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, permute);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(keys_sorted(i), keys_h(permute_sorted(i)));
+    if (i > 0) {
+      ASSERT_FALSE(comparator(keys_sorted(i), keys_sorted(i - 1)));
+      if (keys_sorted(i - 1) == keys_sorted(i)) {
+        ASSERT_LT(permute_sorted(i - 1), permute_sorted(i));
+      }
+    }
+  }
+}
+
+TEST(TEST_CATEGORY, StableSortByKey) {
+  for (int n : {2, 9, 1000, 4500, 50000}) {
+    test_stable_sort_by_key<SortImpl::Less>(n, false);
+    test_stable_sort_by_key<SortImpl::Less>(n, true);
+    test_stable_sort_by_key<SortImpl::Greater>(n, true);
+  }
+}
+
+TEST(TEST_CATEGORY, SortByKeyMultipleValues) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  using MemorySpace    = typename ExecutionSpace::memory_space;
+
+  ExecutionSpace space{};
+
+  for (int n : {2, 9, 1000, 50000}) {
+    for (bool stable : {false, true}) {
+      Kokkos::View<double *, Kokkos::HostSpace> keys_h("keys_h", n);
+      for (int i = 0; i < n; ++i) keys_h(i) = ((i * 37) % 101) * 0.5;
+      Kokkos::View<double *, MemorySpace> keys("keys", n);
+      Kokkos::deep_copy(space, keys, keys_h);
+
+      Kokkos::View<int *, ExecutionSpace> permute("permute", n);
+      Kokkos::View<int **, ExecutionSpace> data("data", n, 2);
+      auto shifted = Kokkos::subview(data, Kokkos::ALL, 1);
+      SortImpl::iota(space, permute);
+      SortImpl::iota(space, shifted, 3);
+
+      if (stable)
+        Kokkos::Experimental::stable_sort_by_key(space, keys, permute,
+                                                 shifted);
+      else
+        Kokkos::Experimental::sort_by_key(space, keys, permute, shifted);
+
+      auto keys_sorted =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, keys);
+      auto permute_sorted =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, permute);
+      auto data_sorted =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, data);
+      for (int i = 0; i < n; ++i) {
+        ASSERT_EQ(keys_sorted(i), keys_h(permute_sorted(i)));
+        ASSERT_EQ(data_sorted(i, 1), permute_sorted(i) + 3);
+        if (i > 0) {
+          ASSERT_LE(keys_sorted(i - 1), keys_sorted(i));
+          if (stable && keys_sorted(i - 1) == keys_sorted(i)) {
+            ASSERT_LT(permute_sorted(i - 1), permute_sorted(i));
+          }
+        }
+      }
+    }
+  }
+}
+
 TEST(TEST_CATEGORY_DEATH, SortByKeyKeysLargerThanValues) {
   ::testing::FLAGS_gtest_death_test_style = "threadsafe";
 
@@ -0,0 +1,183 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_ALGORITHMS_UNITTESTS_TEST_SORT_SEGMENTED_HPP
+#define KOKKOS_ALGORITHMS_UNITTESTS_TEST_SORT_SEGMENTED_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Macros.hpp>
+#ifdef KOKKOS_ENABLE_EXPERIMENTAL_CXX20_MODULES
+import kokkos.random;
+import kokkos.sort;
+#else
+#include <Kokkos_Random.hpp>
+#include <Kokkos_Sort.hpp>
+#endif
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace Test {
+namespace SortSegmentedImpl {
+
+template <class T>
+struct GreaterThan {
+  KOKKOS_FUNCTION constexpr bool operator()(const T& lhs, const T& rhs) const {
+    return lhs > rhs;
+  }
+};
+
+// Segment lengths covering every bucket: empty and single element segments,
+// insertion sort, team sorts of various sizes and segments long enough to be
+// sorted on their own.
+inline std::vector<int> make_offsets() {
+  std::vector<int> const lengths = {0,  1,   2,   5,    31,   32,   33,  64,
+                                    65, 100, 513, 1000, 4096, 4097, 20000};
+  std::vector<int> offsets = {0};
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    for (int len : lengths) offsets.push_back(offsets.back() + len);
+  }
+  return offsets;
+}
+
+template <class ViewType, class OffsetsHost, class Comparator>
+void check_segments_sorted(const ViewType& values, const ViewType& expected,
+                           const OffsetsHost& offsets,
+                           const Comparator& comp) {
+  auto values_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, values);
+  auto expected_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, expected);
+  for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+    std::sort(expected_h.data() + offsets[i],
+              expected_h.data() + offsets[i + 1], comp);
+  }
+  for (int i = 0; i < offsets.back(); ++i) {
+    ASSERT_EQ(values_h(i), expected_h(i)) << "at index " << i;
+  }
+}
+
+template <class ExecutionSpace, class ValueType, class SortFunc,
+          class Comparator>
+void test_sort_segmented_impl(const SortFunc& sort_func,
+                              const Comparator& comp) {
+  ExecutionSpace exec;
+  auto const offsets_std = make_offsets();
+  Kokkos::View<int*, ExecutionSpace> offsets("offsets", offsets_std.size());
+  Kokkos::deep_copy(exec, offsets,
+                    Kokkos::View<const int*, Kokkos::HostSpace>(
+                        offsets_std.data(), offsets_std.size()));
+
+  Kokkos::View<ValueType*, ExecutionSpace> values("values",
+                                                  offsets_std.back());
+  Kokkos::Random_XorShift64_Pool<ExecutionSpace> pool(7411);
+  Kokkos::fill_random(exec, values, pool, ValueType(-1000), ValueType(1000));
+  Kokkos::View<ValueType*, ExecutionSpace> expected("expected",
+                                                    offsets_std.back());
+  Kokkos::deep_copy(exec, expected, values);
+
+  sort_func(exec, values, offsets);
+  check_segments_sorted(values, expected, offsets_std, comp);
+}
+
+template <class ExecutionSpace, class ValueType>
+void test_sort_segmented() {
+  test_sort_segmented_impl<ExecutionSpace, ValueType>(
+      [](auto const& exec, auto const& values, auto const& offsets) {
+        Kokkos::Experimental::sort_segmented(exec, values, offsets);
+      },
+      std::less<ValueType>());
+  test_sort_segmented_impl<ExecutionSpace, ValueType>(
+      [](auto const& exec, auto const& values, auto const& offsets) {
+        Kokkos::Experimental::sort_segmented(exec, values, offsets,
+                                             GreaterThan<ValueType>());
+      },
+      std::greater<ValueType>());
+  // The bucketed kernels used on devices also run on the host backends.
+  test_sort_segmented_impl<ExecutionSpace, ValueType>(
+      [](auto const& exec, auto const& values, auto const& offsets) {
+        Kokkos::Impl::sort_segmented_on_device(exec, values, offsets);
+      },
+      std::less<ValueType>());
+  test_sort_segmented_impl<ExecutionSpace, ValueType>(
+      [](auto const& exec, auto const& values, auto const& offsets) {
+        Kokkos::Impl::sort_segmented_on_device(exec, values, offsets,
+                                               GreaterThan<ValueType>());
+      },
+      std::greater<ValueType>());
+}
+
+template <class ExecutionSpace>
+void test_sort_segmented_graph() {
+  using graph_type = Kokkos::Crs<int, ExecutionSpace, void, int>;
+
+  ExecutionSpace exec;
+  auto const offsets_std = make_offsets();
+  std::vector<std::vector<int>> rows(offsets_std.size() - 1);
+  std::vector<int> entries_std;
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    for (int j = offsets_std[i]; j < offsets_std[i + 1]; ++j) {
+      rows[i].push_back((j * 7919) % 10007);
+      entries_std.push_back(rows[i].back());
+    }
+  }
+  graph_type graph;
+  graph.row_map = typename graph_type::row_map_type("row_map",
+                                                    offsets_std.size());
+  graph.entries = typename graph_type::entries_type("entries",
+                                                    entries_std.size());
+  Kokkos::deep_copy(exec, graph.row_map,
+                    Kokkos::View<const int*, Kokkos::HostSpace>(
+                        offsets_std.data(), offsets_std.size()));
+  Kokkos::deep_copy(exec, graph.entries,
+                    Kokkos::View<const int*, Kokkos::HostSpace>(
+                        entries_std.data(), entries_std.size()));
+
+  Kokkos::Experimental::sort_segmented(exec, graph);
+  auto entries_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, graph.entries);
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    std::sort(rows[i].begin(), rows[i].end());
+    for (std::size_t j = 0; j < rows[i].size(); ++j) {
+      ASSERT_EQ(entries_h(offsets_std[i] + j), rows[i][j]);
+    }
+  }
+
+  Kokkos::Experimental::sort_segmented(exec, graph, GreaterThan<int>());
+  Kokkos::deep_copy(entries_h, graph.entries);
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    for (std::size_t j = 0; j < rows[i].size(); ++j) {
+      ASSERT_EQ(entries_h(offsets_std[i] + j), rows[i][rows[i].size() - 1 - j]);
+    }
+  }
+}
+
+}  // namespace SortSegmentedImpl
+
+TEST(TEST_CATEGORY, SortSegmented) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  SortSegmentedImpl::test_sort_segmented<ExecutionSpace, int>();
+  SortSegmentedImpl::test_sort_segmented<ExecutionSpace, double>();
+}
+
+TEST(TEST_CATEGORY, SortSegmentedGraph) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  SortSegmentedImpl::test_sort_segmented_graph<ExecutionSpace>();
+}
+
+}  // namespace Test
+#endif
@@ -0,0 +1,123 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace BinarySearch {
+
+namespace KE = Kokkos::Experimental;
+
+template <class Tag, class ValueType>
+auto create_sorted_view(std::size_t ext, int upper) {
+  auto view    = create_view<ValueType>(Tag{}, ext, "binary_search");
+  auto view_dc = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  std::mt19937 gen(ext);
+  std::uniform_int_distribution<int> dist(0, upper);
+  for (std::size_t i = 0; i < ext; ++i) {
+    view_dc_h(i) = static_cast<ValueType>(dist(gen));
+  }
+  std::sort(KE::begin(view_dc_h), KE::end(view_dc_h));
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  // use CTAD
+  CopyFunctor F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+
+  std::vector<ValueType> gold(KE::cbegin(view_dc_h), KE::cend(view_dc_h));
+  return std::make_pair(view, gold);
+}
+
+template <class Tag, class ValueType>
+void run_single_scenario(std::size_t ext, int upper) {
+  auto [view, gold] = create_sorted_view<Tag, ValueType>(ext, upper);
+  CustomLessThanComparator<ValueType> comp;
+
+  // values below, between, on and above the elements of the view
+  for (int i = -1; i <= upper + 1; i += Kokkos::max(1, upper / 17)) {
+    const auto value = static_cast<ValueType>(i);
+    const std::size_t gold_lower =
+        std::lower_bound(gold.begin(), gold.end(), value) - gold.begin();
+    const std::size_t gold_upper =
+        std::upper_bound(gold.begin(), gold.end(), value) - gold.begin();
+
+    const auto first = KE::begin(view);
+    const auto last  = KE::end(view);
+    std::vector<std::size_t> lowers(8);
+    lowers[0] = KE::lower_bound(exespace(), first, last, value) - first;
+    lowers[1] =
+        KE::lower_bound("label", exespace(), first, last, value) - first;
+    lowers[2] = KE::lower_bound(exespace(), view, value) - first;
+    lowers[3] = KE::lower_bound("label", exespace(), view, value) - first;
+    lowers[4] = KE::lower_bound(exespace(), first, last, value, comp) - first;
+    lowers[5] =
+        KE::lower_bound("label", exespace(), first, last, value, comp) - first;
+    lowers[6] = KE::lower_bound(exespace(), view, value, comp) - first;
+    lowers[7] = KE::lower_bound("label", exespace(), view, value, comp) - first;
+
+    std::vector<std::size_t> uppers(8);
+    uppers[0] = KE::upper_bound(exespace(), first, last, value) - first;
+    uppers[1] =
+        KE::upper_bound("label", exespace(), first, last, value) - first;
+    uppers[2] = KE::upper_bound(exespace(), view, value) - first;
+    uppers[3] = KE::upper_bound("label", exespace(), view, value) - first;
+    uppers[4] = KE::upper_bound(exespace(), first, last, value, comp) - first;
+    uppers[5] =
+        KE::upper_bound("label", exespace(), first, last, value, comp) - first;
+    uppers[6] = KE::upper_bound(exespace(), view, value, comp) - first;
+    uppers[7] = KE::upper_bound("label", exespace(), view, value, comp) - first;
+
+    std::vector<Kokkos::pair<decltype(first), decltype(first)>> ranges;
+    ranges.push_back(KE::equal_range(exespace(), first, last, value));
+    ranges.push_back(KE::equal_range("label", exespace(), first, last, value));
+    ranges.push_back(KE::equal_range(exespace(), view, value));
+    ranges.push_back(KE::equal_range("label", exespace(), view, value));
+    ranges.push_back(KE::equal_range(exespace(), first, last, value, comp));
+    ranges.push_back(
+        KE::equal_range("label", exespace(), first, last, value, comp));
+    ranges.push_back(KE::equal_range(exespace(), view, value, comp));
+    ranges.push_back(KE::equal_range("label", exespace(), view, value, comp));
+
+    for (std::size_t apiId = 0; apiId < 8; ++apiId) {
+      ASSERT_EQ(gold_lower, lowers[apiId]) << ext << ", " << i << ", " << apiId;
+      ASSERT_EQ(gold_upper, uppers[apiId]) << ext << ", " << i << ", " << apiId;
+      ASSERT_EQ(gold_lower, std::size_t(ranges[apiId].first - first));
+      ASSERT_EQ(gold_upper, std::size_t(ranges[apiId].second - first));
+    }
+  }
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  for (std::size_t ext : {0, 1, 2, 13, 1003, 101513}) {
+    for (int upper : {0, 5, 1000, 1000000}) {
+      run_single_scenario<Tag, ValueType>(ext, upper);
+    }
+  }
+}
+
+TEST(std_algorithms_sorting_ops_test, lower_upper_bound_equal_range) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+  run_all_scenarios<DynamicTag, double>();
+}
+
+}  // namespace BinarySearch
+}  // namespace stdalgos
+}  // namespace Test
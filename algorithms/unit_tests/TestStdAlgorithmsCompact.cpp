@@ -0,0 +1,173 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace Compact {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct IsEven {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& value) const { return value % 2 == 0; }
+};
+
+// sends the values to the output given by their remainder modulo 4 and
+// drops the ones whose remainder is 3
+template <class ValueType>
+struct ModuloFour {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const ValueType& value) const {
+    const int remainder = value % 4;
+    return remainder == 3 ? -1 : remainder;
+  }
+};
+
+template <class Tag, class ValueType>
+auto create_source(std::size_t ext) {
+  std::mt19937 gen(ext);
+  std::uniform_int_distribution<int> dist(0, 1000);
+  std::vector<ValueType> values(ext);
+  for (auto& value : values) {
+    value = static_cast<ValueType>(dist(gen));
+  }
+
+  auto view    = create_view<ValueType>(Tag{}, ext, "source");
+  auto view_dc = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  std::copy(values.begin(), values.end(), KE::begin(view_dc_h));
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  // use CTAD
+  CopyFunctor F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+  return std::make_pair(values, view);
+}
+
+template <std::size_t N, class ValueType, class SelectorType>
+auto compute_gold(const std::vector<ValueType>& values,
+                  SelectorType selector) {
+  std::vector<std::vector<ValueType>> gold(N);
+  for (const auto& value : values) {
+    const std::size_t k = KE::Impl::compact_output_index(selector(value));
+    if (k < N) {
+      gold[k].push_back(value);
+    }
+  }
+  return gold;
+}
+
+template <class ValueType, std::size_t N, class... DestViewTypes>
+void verify_outputs(const std::vector<std::vector<ValueType>>& gold,
+                    const Kokkos::Array<std::size_t, N>& counts,
+                    const DestViewTypes&... dests) {
+  std::size_t k = 0;
+  (
+      [&](const auto& dest) {
+        ASSERT_EQ(gold[k].size(), counts[k]) << k;
+        auto dest_h = create_host_space_copy(dest);
+        for (std::size_t i = 0; i < counts[k]; ++i) {
+          ASSERT_EQ(gold[k][i], dest_h(i)) << k << ", " << i;
+        }
+        ++k;
+      }(dests),
+      ...);
+}
+
+template <class Tag, class ValueType>
+void test_selected_and_rejected(std::size_t ext) {
+  auto [values, source] = create_source<Tag, ValueType>(ext);
+  IsEven<ValueType> pred;
+  const auto gold = compute_gold<2>(values, pred);
+
+  for (int apiId : {0, 1, 2, 3, 4, 5}) {
+    Kokkos::View<ValueType*> selected("selected", ext);
+    Kokkos::View<ValueType*> rejected("rejected", ext);
+
+    auto first = KE::cbegin(source);
+    auto last  = KE::cend(source);
+    Kokkos::Array<std::size_t, 2> counts;
+    if (apiId == 0) {
+      counts = KE::compact(exespace(), first, last, pred, KE::begin(selected),
+                           KE::begin(rejected));
+    } else if (apiId == 1) {
+      counts = KE::compact("label", exespace(), first, last, pred,
+                           KE::begin(selected), KE::begin(rejected));
+    } else if (apiId == 2) {
+      counts = KE::compact(exespace(), source, pred, selected, rejected);
+    } else if (apiId == 3) {
+      counts =
+          KE::compact("label", exespace(), source, pred, selected, rejected);
+    } else {
+      // the counts stay on the device
+      Kokkos::View<int*> counts_view("counts", 2);
+      Kokkos::deep_copy(counts_view, -1);
+      if (apiId == 4) {
+        KE::compact(exespace(), first, last, pred, counts_view,
+                    KE::begin(selected), KE::begin(rejected));
+      } else {
+        KE::compact("label", exespace(), first, last, pred, counts_view,
+                    KE::begin(selected), KE::begin(rejected));
+      }
+      auto counts_h = create_host_space_copy(counts_view);
+      counts        = {std::size_t(counts_h(0)), std::size_t(counts_h(1))};
+    }
+
+    verify_outputs(gold, counts, selected, rejected);
+  }
+
+  // a single output only keeps the selected elements
+  Kokkos::View<ValueType*> selected("selected", ext);
+  auto counts = KE::compact(exespace(), source, pred, selected);
+  verify_outputs(std::vector(gold.begin(), gold.begin() + 1), counts,
+                 selected);
+}
+
+template <class Tag, class ValueType>
+void test_multiway(std::size_t ext) {
+  auto [values, source] = create_source<Tag, ValueType>(ext);
+  ModuloFour<ValueType> selector;
+  const auto gold = compute_gold<3>(values, selector);
+
+  Kokkos::View<ValueType*> dest0("dest0", ext);
+  Kokkos::View<ValueType*> dest1("dest1", ext);
+  auto dest2 = create_view<ValueType>(Tag{}, ext, "dest2");
+
+  auto counts = KE::compact(exespace(), source, selector, dest0, dest1, dest2);
+  verify_outputs(gold, counts, dest0, dest1, dest2);
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  for (std::size_t ext : {0, 1, 2, 9, 1003, 100001}) {
+    test_selected_and_rejected<Tag, ValueType>(ext);
+    test_multiway<Tag, ValueType>(ext);
+  }
+}
+
+TEST(std_algorithms_mod_seq_ops, compact) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+  run_all_scenarios<DynamicTag, std::int64_t>();
+}
+
+}  // namespace Compact
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,156 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace LowerBoundBatch {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct GreaterThanComparator {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a > b;
+  }
+};
+
+template <class Tag, class ValueType>
+auto create_view_from_vector(const std::vector<ValueType>& values,
+                             const std::string& label) {
+  auto view    = create_view<ValueType>(Tag{}, values.size(), label);
+  auto view_dc = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  std::copy(values.begin(), values.end(), KE::begin(view_dc_h));
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  // use CTAD
+  CopyFunctor F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+  return view;
+}
+
+// the table has values in [0, upper] with duplicates, the queries also
+// fall below and above it
+template <class ValueType>
+auto create_table_and_queries(std::size_t tableExt, std::size_t queriesExt,
+                              int upper) {
+  std::mt19937 gen(tableExt + queriesExt);
+  std::uniform_int_distribution<int> tableDist(0, upper);
+  std::uniform_int_distribution<int> queryDist(-2, upper + 2);
+  std::vector<ValueType> table(tableExt);
+  for (auto& value : table) {
+    value = static_cast<ValueType>(tableDist(gen));
+  }
+  std::vector<ValueType> queries(queriesExt);
+  for (auto& value : queries) {
+    value = static_cast<ValueType>(queryDist(gen));
+  }
+  return std::make_pair(table, queries);
+}
+
+template <class Tag, class ValueType, class IndexType>
+void run_single_scenario(std::size_t tableExt, std::size_t queriesExt,
+                         int upper) {
+  auto [table, queries] =
+      create_table_and_queries<ValueType>(tableExt, queriesExt, upper);
+  auto queriesView = create_view_from_vector<Tag>(queries, "queries");
+
+  // apiId 0-3 use the default comparator, 4-7 a custom one
+  GreaterThanComparator<ValueType> comp;
+  auto ascending = table;
+  std::sort(ascending.begin(), ascending.end());
+  auto descending = table;
+  std::sort(descending.begin(), descending.end(), comp);
+  auto ascendingView  = create_view_from_vector<Tag>(ascending, "table");
+  auto descendingView = create_view_from_vector<Tag>(descending, "table");
+
+  for (int apiId : {0, 1, 2, 3, 4, 5, 6, 7}) {
+    const auto& sorted = (apiId < 4) ? ascending : descending;
+    auto view          = (apiId < 4) ? ascendingView : descendingView;
+    Kokkos::View<IndexType*> dest("dest", queriesExt);
+
+    auto first   = KE::cbegin(view);
+    auto last    = KE::cend(view);
+    auto q_first = KE::cbegin(queriesView);
+    auto q_last  = KE::cend(queriesView);
+    auto d_first = KE::begin(dest);
+    auto result  = d_first;
+    if (apiId == 0) {
+      result = KE::lower_bound_batch(exespace(), first, last, q_first, q_last,
+                                     d_first);
+    } else if (apiId == 1) {
+      result = KE::lower_bound_batch("label", exespace(), first, last, q_first,
+                                     q_last, d_first);
+    } else if (apiId == 2) {
+      result = KE::lower_bound_batch(exespace(), view, queriesView, dest);
+    } else if (apiId == 3) {
+      result =
+          KE::lower_bound_batch("label", exespace(), view, queriesView, dest);
+    } else if (apiId == 4) {
+      result = KE::lower_bound_batch(exespace(), first, last, q_first, q_last,
+                                     d_first, comp);
+    } else if (apiId == 5) {
+      result = KE::lower_bound_batch("label", exespace(), first, last, q_first,
+                                     q_last, d_first, comp);
+    } else if (apiId == 6) {
+      result = KE::lower_bound_batch(exespace(), view, queriesView, dest, comp);
+    } else if (apiId == 7) {
+      result = KE::lower_bound_batch("label", exespace(), view, queriesView,
+                                     dest, comp);
+    }
+    ASSERT_EQ(queriesExt, std::size_t(KE::distance(d_first, result)));
+
+    auto dest_h = create_host_space_copy(dest);
+    for (std::size_t i = 0; i < queriesExt; ++i) {
+      const auto goldIt =
+          (apiId < 4)
+              ? std::lower_bound(sorted.begin(), sorted.end(), queries[i])
+              : std::lower_bound(sorted.begin(), sorted.end(), queries[i],
+                                 comp);
+      ASSERT_EQ(IndexType(goldIt - sorted.begin()), dest_h(i))
+          << tableExt << ", " << queriesExt << ", " << apiId << ", " << i;
+    }
+  }
+}
+
+template <class Tag, class ValueType, class IndexType>
+void run_all_scenarios() {
+  // the large tables with many queries go through the Eytzinger layout,
+  // including a complete tree and one with a single node on its last level
+  for (std::size_t tableExt :
+       {0, 1, 2, 13, 1003, 65535, 65536, 100003, 262147}) {
+    for (std::size_t queriesExt : {0, 1, 1000, 200000}) {
+      for (int upper : {5, 1000000}) {
+        run_single_scenario<Tag, ValueType, IndexType>(tableExt, queriesExt,
+                                                       upper);
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_sorting_ops_test, lower_bound_batch) {
+  run_all_scenarios<DynamicTag, int, std::size_t>();
+  run_all_scenarios<StridedThreeTag, int, int>();
+  run_all_scenarios<DynamicTag, double, std::int64_t>();
+}
+
+}  // namespace LowerBoundBatch
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,230 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace MergeAndSetOps {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+auto create_sorted_vector(std::size_t ext, ValueType upper,
+                          std::size_t seed) {
+  std::vector<ValueType> values(ext);
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, upper);
+  for (auto& value : values) {
+    value = static_cast<ValueType>(dist(gen));
+  }
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+template <class Tag, class ValueType>
+auto create_view_from_vector(const std::vector<ValueType>& values,
+                             std::size_t ext, const std::string& label) {
+  auto view    = create_view<ValueType>(Tag{}, ext, label);
+  auto view_dc = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  std::copy(values.begin(), values.end(), KE::begin(view_dc_h));
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  // use CTAD
+  CopyFunctor F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+  return view;
+}
+
+template <class ViewType>
+auto view_to_vector(const ViewType& view, std::size_t count) {
+  auto view_h = create_host_space_copy(view);
+  return std::vector<typename ViewType::value_type>(
+      KE::cbegin(view_h), KE::cbegin(view_h) + count);
+}
+
+//
+// merge and the set operations share the same signature,
+// KokkosOp and StdOp wrap the algorithm so one test covers all of them
+//
+template <class Tag, class ValueType, class KokkosOp, class StdOp>
+void test_merge_like_op(const std::vector<ValueType>& values1,
+                        const std::vector<ValueType>& values2, KokkosOp op,
+                        StdOp std_op) {
+  std::vector<ValueType> gold(values1.size() + values2.size());
+  gold.erase(std_op(values1.begin(), values1.end(), values2.begin(),
+                    values2.end(), gold.begin()),
+             gold.end());
+
+  auto view1 = create_view_from_vector<Tag>(values1, values1.size(), "view1");
+  auto view2 = create_view_from_vector<Tag>(values2, values2.size(), "view2");
+  CustomLessThanComparator<ValueType> comp;
+  for (int apiId : {0, 1, 2, 3, 4, 5, 6, 7}) {
+    auto dest = create_view<ValueType>(
+        Tag{}, values1.size() + values2.size(), "dest");
+    auto first1 = KE::cbegin(view1);
+    auto last1  = KE::cend(view1);
+    auto first2 = KE::cbegin(view2);
+    auto last2  = KE::cend(view2);
+
+    auto result = KE::begin(dest);
+    if (apiId == 0) {
+      result = op(exespace(), first1, last1, first2, last2, KE::begin(dest));
+    } else if (apiId == 1) {
+      result = op("label", exespace(), first1, last1, first2, last2,
+                  KE::begin(dest));
+    } else if (apiId == 2) {
+      result = op(exespace(), view1, view2, dest);
+    } else if (apiId == 3) {
+      result = op("label", exespace(), view1, view2, dest);
+    } else if (apiId == 4) {
+      result =
+          op(exespace(), first1, last1, first2, last2, KE::begin(dest), comp);
+    } else if (apiId == 5) {
+      result = op("label", exespace(), first1, last1, first2, last2,
+                  KE::begin(dest), comp);
+    } else if (apiId == 6) {
+      result = op(exespace(), view1, view2, dest, comp);
+    } else if (apiId == 7) {
+      result = op("label", exespace(), view1, view2, dest, comp);
+    }
+
+    const std::size_t count = KE::distance(KE::begin(dest), result);
+    ASSERT_EQ(gold.size(), count) << apiId;
+    ASSERT_EQ(gold, view_to_vector(dest, count)) << apiId;
+  }
+}
+
+template <class Tag, class ValueType>
+void test_inplace_merge(const std::vector<ValueType>& values1,
+                        const std::vector<ValueType>& values2) {
+  std::vector<ValueType> gold(values1);
+  gold.insert(gold.end(), values2.begin(), values2.end());
+  const std::size_t middle = values1.size();
+
+  CustomLessThanComparator<ValueType> comp;
+  for (int apiId : {0, 1, 2, 3, 4, 5, 6, 7}) {
+    auto view = create_view_from_vector<Tag>(gold, gold.size(), "view");
+    auto first = KE::begin(view);
+    auto last  = KE::end(view);
+    if (apiId == 0) {
+      KE::inplace_merge(exespace(), first, first + middle, last);
+    } else if (apiId == 1) {
+      KE::inplace_merge("label", exespace(), first, first + middle, last);
+    } else if (apiId == 2) {
+      KE::inplace_merge(exespace(), view, middle);
+    } else if (apiId == 3) {
+      KE::inplace_merge("label", exespace(), view, middle);
+    } else if (apiId == 4) {
+      KE::inplace_merge(exespace(), first, first + middle, last, comp);
+    } else if (apiId == 5) {
+      KE::inplace_merge("label", exespace(), first, first + middle, last,
+                        comp);
+    } else if (apiId == 6) {
+      KE::inplace_merge(exespace(), view, middle, comp);
+    } else if (apiId == 7) {
+      KE::inplace_merge("label", exespace(), view, middle, comp);
+    }
+
+    auto expected = gold;
+    std::inplace_merge(expected.begin(), expected.begin() + middle,
+                       expected.end());
+    ASSERT_EQ(expected, view_to_vector(view, view.extent(0))) << apiId;
+  }
+}
+
+template <class Tag, class ValueType>
+void test_includes(const std::vector<ValueType>& values1,
+                   const std::vector<ValueType>& values2) {
+  // every third element of the first range is certainly included
+  std::vector<ValueType> subset;
+  for (std::size_t i = 0; i < values1.size(); i += 3) {
+    subset.push_back(values1[i]);
+  }
+
+  auto view1 = create_view_from_vector<Tag>(values1, values1.size(), "view1");
+  CustomLessThanComparator<ValueType> comp;
+  for (const auto& values : {subset, values2}) {
+    const bool gold = std::includes(values1.begin(), values1.end(),
+                                    values.begin(), values.end());
+    auto view2 = create_view_from_vector<Tag>(values, values.size(), "view2");
+    auto first1 = KE::cbegin(view1);
+    auto last1  = KE::cend(view1);
+    auto first2 = KE::cbegin(view2);
+    auto last2  = KE::cend(view2);
+
+    std::vector<bool> results(8);
+    results[0] = KE::includes(exespace(), first1, last1, first2, last2);
+    results[1] =
+        KE::includes("label", exespace(), first1, last1, first2, last2);
+    results[2] = KE::includes(exespace(), view1, view2);
+    results[3] = KE::includes("label", exespace(), view1, view2);
+    results[4] = KE::includes(exespace(), first1, last1, first2, last2, comp);
+    results[5] =
+        KE::includes("label", exespace(), first1, last1, first2, last2, comp);
+    results[6] = KE::includes(exespace(), view1, view2, comp);
+    results[7] = KE::includes("label", exespace(), view1, view2, comp);
+    for (std::size_t apiId = 0; apiId < results.size(); ++apiId) {
+      ASSERT_EQ(gold, results[apiId]) << apiId;
+    }
+  }
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  const std::vector<std::pair<std::size_t, std::size_t>> extents = {
+      {0, 0},       {0, 5},         {5, 0},          {1, 1},
+      {13, 17},     {1003, 2001},   {20011, 15013},  {101513, 50001}};
+
+  for (const auto& [ext1, ext2] : extents) {
+    // few distinct values give long runs of duplicates
+    for (int upper : {3, 50, 1000000}) {
+      const auto values1 = create_sorted_vector<ValueType>(ext1, upper, 11);
+      const auto values2 = create_sorted_vector<ValueType>(ext2, upper, 23);
+
+      test_merge_like_op<Tag>(
+          values1, values2,
+          [](auto&&... args) { return KE::merge(args...); },
+          [](auto... args) { return std::merge(args...); });
+      test_merge_like_op<Tag>(
+          values1, values2,
+          [](auto&&... args) { return KE::set_union(args...); },
+          [](auto... args) { return std::set_union(args...); });
+      test_merge_like_op<Tag>(
+          values1, values2,
+          [](auto&&... args) { return KE::set_intersection(args...); },
+          [](auto... args) { return std::set_intersection(args...); });
+      test_merge_like_op<Tag>(
+          values1, values2,
+          [](auto&&... args) { return KE::set_difference(args...); },
+          [](auto... args) { return std::set_difference(args...); });
+      test_inplace_merge<Tag>(values1, values2);
+      test_includes<Tag>(values1, values2);
+    }
+  }
+}
+
+TEST(std_algorithms_sorting_ops_test, merge_and_set_ops) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+  run_all_scenarios<DynamicTag, double>();
+}
+
+}  // namespace MergeAndSetOps
+}  // namespace stdalgos
+}  // namespace Test
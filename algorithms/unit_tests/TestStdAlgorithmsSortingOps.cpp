@@ -0,0 +1,276 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace SortingOps {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct GreaterThanComparator {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a > b;
+  }
+};
+
+// only looks at the tens so that many elements are equivalent
+template <class ValueType>
+struct CompareTensComparator {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a / 10 < b / 10;
+  }
+};
+
+// returns a view with random values and the same values on the host,
+// the values are drawn from a small range so that there are duplicates
+template <class Tag, class ValueType>
+auto create_random_view(std::size_t ext, ValueType upper) {
+  auto view    = create_view<ValueType>(Tag{}, ext, "sorting_ops");
+  auto view_dc = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> pool(
+      1234567 + ext);
+  Kokkos::fill_random(view_dc_h, pool, ValueType{0}, upper);
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  // use CTAD
+  CopyFunctor F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+
+  std::vector<ValueType> gold(KE::cbegin(view_dc_h), KE::cend(view_dc_h));
+  return std::make_pair(view, gold);
+}
+
+template <class ViewType>
+auto view_to_vector(const ViewType& view) {
+  auto view_h = create_host_space_copy(view);
+  return std::vector<typename ViewType::value_type>(KE::cbegin(view_h),
+                                                    KE::cend(view_h));
+}
+
+template <class Tag, class ValueType>
+void test_sort(std::size_t ext) {
+  for (int apiId : {0, 1, 2, 3}) {
+    auto [view, gold] = create_random_view<Tag, ValueType>(ext, 1000);
+    if (apiId == 0) {
+      KE::sort(exespace(), KE::begin(view), KE::end(view));
+    } else if (apiId == 1) {
+      KE::sort("label", exespace(), KE::begin(view), KE::end(view));
+    } else if (apiId == 2) {
+      KE::sort(exespace(), view);
+    } else if (apiId == 3) {
+      KE::sort("label", exespace(), view);
+    }
+    std::sort(gold.begin(), gold.end());
+    ASSERT_EQ(gold, view_to_vector(view)) << ext << ", " << apiId;
+  }
+
+  for (int apiId : {0, 1, 2, 3}) {
+    auto [view, gold] = create_random_view<Tag, ValueType>(ext, 1000);
+    GreaterThanComparator<ValueType> comp;
+    if (apiId == 0) {
+      KE::sort(exespace(), KE::begin(view), KE::end(view), comp);
+    } else if (apiId == 1) {
+      KE::sort("label", exespace(), KE::begin(view), KE::end(view), comp);
+    } else if (apiId == 2) {
+      KE::sort(exespace(), view, comp);
+    } else if (apiId == 3) {
+      KE::sort("label", exespace(), view, comp);
+    }
+    std::sort(gold.begin(), gold.end(), comp);
+    ASSERT_EQ(gold, view_to_vector(view)) << ext << ", " << apiId;
+  }
+}
+
+template <class Tag, class ValueType>
+void test_stable_sort(std::size_t ext) {
+  for (int apiId : {0, 1, 2, 3}) {
+    auto [view, gold] = create_random_view<Tag, ValueType>(ext, 1000);
+    if (apiId == 0) {
+      KE::stable_sort(exespace(), KE::begin(view), KE::end(view));
+    } else if (apiId == 1) {
+      KE::stable_sort("label", exespace(), KE::begin(view), KE::end(view));
+    } else if (apiId == 2) {
+      KE::stable_sort(exespace(), view);
+    } else if (apiId == 3) {
+      KE::stable_sort("label", exespace(), view);
+    }
+    std::stable_sort(gold.begin(), gold.end());
+    ASSERT_EQ(gold, view_to_vector(view)) << ext << ", " << apiId;
+  }
+
+  // equivalent elements must keep their relative order
+  for (int apiId : {0, 1, 2, 3}) {
+    auto [view, gold] = create_random_view<Tag, ValueType>(ext, 1000);
+    CompareTensComparator<ValueType> comp;
+    if (apiId == 0) {
+      KE::stable_sort(exespace(), KE::begin(view), KE::end(view), comp);
+    } else if (apiId == 1) {
+      KE::stable_sort("label", exespace(), KE::begin(view), KE::end(view),
+                      comp);
+    } else if (apiId == 2) {
+      KE::stable_sort(exespace(), view, comp);
+    } else if (apiId == 3) {
+      KE::stable_sort("label", exespace(), view, comp);
+    }
+    std::stable_sort(gold.begin(), gold.end(), comp);
+    ASSERT_EQ(gold, view_to_vector(view)) << ext << ", " << apiId;
+  }
+}
+
+template <class ValueType, class ComparatorType>
+void verify_nth_element(const std::vector<ValueType>& input,
+                        const std::vector<ValueType>& result, std::size_t nth,
+                        ComparatorType comp) {
+  auto sorted = input;
+  std::sort(sorted.begin(), sorted.end(), comp);
+  auto sorted_result = result;
+  std::sort(sorted_result.begin(), sorted_result.end(), comp);
+  // the result must be a permutation of the input
+  ASSERT_EQ(sorted, sorted_result);
+  if (nth == result.size()) {
+    return;
+  }
+
+  ASSERT_EQ(sorted[nth], result[nth]);
+  for (std::size_t i = 0; i < nth; ++i) {
+    ASSERT_FALSE(comp(result[nth], result[i])) << i;
+  }
+  for (std::size_t i = nth + 1; i < result.size(); ++i) {
+    ASSERT_FALSE(comp(result[i], result[nth])) << i;
+  }
+}
+
+template <class Tag, class ValueType>
+void test_nth_element(std::size_t ext) {
+  for (std::size_t nth : {std::size_t(0), ext / 3, ext / 2, ext - ext / 7,
+                          ext > 0 ? ext - 1 : 0, ext}) {
+    for (int apiId : {0, 1, 2, 3}) {
+      auto [view, gold] = create_random_view<Tag, ValueType>(ext, 1000);
+      auto first        = KE::begin(view);
+      if (apiId == 0) {
+        KE::nth_element(exespace(), first, first + nth, KE::end(view));
+      } else if (apiId == 1) {
+        KE::nth_element("label", exespace(), first, first + nth,
+                        KE::end(view));
+      } else if (apiId == 2) {
+        KE::nth_element(exespace(), view, nth);
+      } else if (apiId == 3) {
+        KE::nth_element("label", exespace(), view, nth);
+      }
+      verify_nth_element(gold, view_to_vector(view), nth, std::less<>{});
+    }
+
+    for (int apiId : {0, 1, 2, 3}) {
+      auto [view, gold] = create_random_view<Tag, ValueType>(ext, 1000);
+      auto first        = KE::begin(view);
+      GreaterThanComparator<ValueType> comp;
+      if (apiId == 0) {
+        KE::nth_element(exespace(), first, first + nth, KE::end(view), comp);
+      } else if (apiId == 1) {
+        KE::nth_element("label", exespace(), first, first + nth,
+                        KE::end(view), comp);
+      } else if (apiId == 2) {
+        KE::nth_element(exespace(), view, nth, comp);
+      } else if (apiId == 3) {
+        KE::nth_element("label", exespace(), view, nth, comp);
+      }
+      verify_nth_element(gold, view_to_vector(view), nth, comp);
+    }
+  }
+}
+
+template <class ValueType, class ComparatorType>
+void verify_partial_sort(const std::vector<ValueType>& input,
+                         const std::vector<ValueType>& result,
+                         std::size_t middle, ComparatorType comp) {
+  auto sorted = input;
+  std::sort(sorted.begin(), sorted.end(), comp);
+  for (std::size_t i = 0; i < middle; ++i) {
+    ASSERT_EQ(sorted[i], result[i]) << i;
+  }
+  // the remaining elements must be the ones not selected
+  std::vector<ValueType> rest(result.begin() + middle, result.end());
+  std::sort(rest.begin(), rest.end(), comp);
+  ASSERT_TRUE(std::equal(rest.begin(), rest.end(), sorted.begin() + middle));
+}
+
+template <class Tag, class ValueType>
+void test_partial_sort(std::size_t ext) {
+  for (std::size_t middle :
+       {std::size_t(0), std::size_t(1), ext / 10, ext / 2, ext}) {
+    middle = std::min(middle, ext);
+    for (int apiId : {0, 1, 2, 3}) {
+      auto [view, gold] = create_random_view<Tag, ValueType>(ext, 1000);
+      auto first        = KE::begin(view);
+      if (apiId == 0) {
+        KE::partial_sort(exespace(), first, first + middle, KE::end(view));
+      } else if (apiId == 1) {
+        KE::partial_sort("label", exespace(), first, first + middle,
+                         KE::end(view));
+      } else if (apiId == 2) {
+        KE::partial_sort(exespace(), view, middle);
+      } else if (apiId == 3) {
+        KE::partial_sort("label", exespace(), view, middle);
+      }
+      verify_partial_sort(gold, view_to_vector(view), middle, std::less<>{});
+    }
+
+    for (int apiId : {0, 1, 2, 3}) {
+      auto [view, gold] = create_random_view<Tag, ValueType>(ext, 1000);
+      auto first        = KE::begin(view);
+      GreaterThanComparator<ValueType> comp;
+      if (apiId == 0) {
+        KE::partial_sort(exespace(), first, first + middle, KE::end(view),
+                         comp);
+      } else if (apiId == 1) {
+        KE::partial_sort("label", exespace(), first, first + middle,
+                         KE::end(view), comp);
+      } else if (apiId == 2) {
+        KE::partial_sort(exespace(), view, middle, comp);
+      } else if (apiId == 3) {
+        KE::partial_sort("label", exespace(), view, middle, comp);
+      }
+      verify_partial_sort(gold, view_to_vector(view), middle, comp);
+    }
+  }
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  for (std::size_t ext : {0, 1, 2, 13, 1003, 20011, 101513}) {
+    test_sort<Tag, ValueType>(ext);
+    test_stable_sort<Tag, ValueType>(ext);
+    test_nth_element<Tag, ValueType>(ext);
+    test_partial_sort<Tag, ValueType>(ext);
+  }
+}
+
+TEST(std_algorithms_sorting_ops_test, sort_nth_element_partial_sort) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+  run_all_scenarios<DynamicTag, double>();
+}
+
+}  // namespace SortingOps
+}  // namespace stdalgos
+}  // namespace Test
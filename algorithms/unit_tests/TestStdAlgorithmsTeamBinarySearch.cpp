@@ -0,0 +1,179 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamBinarySearch {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ViewType, class PositionsViewType, class ValueType,
+          class IntraTeamSentinelView>
+struct TestFunctorA {
+  ViewType m_view;
+  PositionsViewType m_positions;
+  ValueType m_value;
+  IntraTeamSentinelView m_intraTeamSentinelView;
+  int m_apiPick;
+
+  TestFunctorA(const ViewType view, const PositionsViewType positions,
+               ValueType value,
+               const IntraTeamSentinelView intraTeamSentinelView, int apiPick)
+      : m_view(view),
+        m_positions(positions),
+        m_value(value),
+        m_intraTeamSentinelView(intraTeamSentinelView),
+        m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView        = Kokkos::subview(m_view, myRowIndex, Kokkos::ALL());
+    auto first            = KE::begin(myRowView);
+    auto last             = KE::end(myRowView);
+    CustomLessThanComparator<ValueType> comp;
+
+    auto lowerIt = first;
+    auto upperIt = first;
+    Kokkos::pair<decltype(first), decltype(first)> range(first, first);
+    if (m_apiPick == 0) {
+      lowerIt = KE::lower_bound(member, first, last, m_value);
+      upperIt = KE::upper_bound(member, first, last, m_value);
+      range   = KE::equal_range(member, first, last, m_value);
+    } else if (m_apiPick == 1) {
+      lowerIt = KE::lower_bound(member, myRowView, m_value);
+      upperIt = KE::upper_bound(member, myRowView, m_value);
+      range   = KE::equal_range(member, myRowView, m_value);
+    } else if (m_apiPick == 2) {
+      lowerIt = KE::lower_bound(member, first, last, m_value, comp);
+      upperIt = KE::upper_bound(member, first, last, m_value, comp);
+      range   = KE::equal_range(member, first, last, m_value, comp);
+    } else if (m_apiPick == 3) {
+      lowerIt = KE::lower_bound(member, myRowView, m_value, comp);
+      upperIt = KE::upper_bound(member, myRowView, m_value, comp);
+      range   = KE::equal_range(member, myRowView, m_value, comp);
+    }
+    const std::size_t lower      = KE::distance(first, lowerIt);
+    const std::size_t upper      = KE::distance(first, upperIt);
+    const std::size_t rangeFirst = KE::distance(first, range.first);
+    const std::size_t rangeLast  = KE::distance(first, range.second);
+
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_positions(myRowIndex, 0) = lower;
+      m_positions(myRowIndex, 1) = upper;
+      m_positions(myRowIndex, 2) = rangeFirst;
+      m_positions(myRowIndex, 3) = rangeLast;
+    });
+
+    // store result of checking if all members have their local
+    // values matching the one stored in m_positions
+    member.team_barrier();
+    const bool intraTeamCheck = team_members_have_matching_result(
+        member, lower, m_positions(myRowIndex, 0));
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_intraTeamSentinelView(myRowIndex) = intraTeamCheck;
+    });
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, ValueType value,
+            int apiId) {
+  /* description:
+     create a rank-2 view whose rows are sorted and run a team-level
+     lower_bound, upper_bound and equal_range for each row where each
+     team is responsible for a single row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  // the values are taken from a small range so that there are duplicates
+  auto [dataView, dataView_h] = create_random_view_and_host_clone(
+      LayoutTag{}, numTeams, numCols,
+      Kokkos::pair<ValueType, ValueType>{11, 57}, "dataView");
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto row = Kokkos::subview(dataView_h, i, Kokkos::ALL());
+    std::sort(KE::begin(row), KE::end(row));
+  }
+  auto dataView_dc =
+      create_deep_copyable_compatible_view_with_same_extent(dataView);
+  Kokkos::deep_copy(dataView_dc, dataView_h);
+  // use CTAD
+  CopyFunctorRank2 F1(dataView_dc, dataView);
+  Kokkos::parallel_for("copy", dataView.extent(0) * dataView.extent(1), F1);
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+  Kokkos::View<std::size_t**> positions("positions", numTeams, 4);
+  // sentinel to check if all members of the team compute the same result
+  Kokkos::View<bool*> intraTeamSentinelView("intraTeamSameResult", numTeams);
+
+  // use CTAD for functor
+  TestFunctorA fnc(dataView, positions, value, intraTeamSentinelView, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // check
+  // -----------------------------------------------
+  auto positions_h             = create_host_space_copy(positions);
+  auto intraTeamSentinelView_h = create_host_space_copy(intraTeamSentinelView);
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto row   = Kokkos::subview(dataView_h, i, Kokkos::ALL());
+    auto first = KE::cbegin(row);
+    auto last  = KE::cend(row);
+    const std::size_t goldLower =
+        KE::distance(first, std::lower_bound(first, last, value));
+    const std::size_t goldUpper =
+        KE::distance(first, std::upper_bound(first, last, value));
+    ASSERT_EQ(goldLower, positions_h(i, 0));
+    ASSERT_EQ(goldUpper, positions_h(i, 1));
+    ASSERT_EQ(goldLower, positions_h(i, 2));
+    ASSERT_EQ(goldUpper, positions_h(i, 3));
+    ASSERT_TRUE(intraTeamSentinelView_h(i));
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444, 8153}) {
+      // values below, inside and above the range of the data
+      for (int value : {0, 11, 23, 57, 99}) {
+        for (int apiId : {0, 1, 2, 3}) {
+          test_A<LayoutTag, ValueType>(numTeams, numCols,
+                                       static_cast<ValueType>(value), apiId);
+        }
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_binary_search_team_test, test) {
+  run_all_scenarios<DynamicTag, double>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, unsigned>();
+}
+
+}  // namespace TeamBinarySearch
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,179 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamCompact {
+
+namespace KE = Kokkos::Experimental;
+
+// picks the output by the remainder modulo 3 and drops the multiples of 5
+template <class ValueType>
+struct ModuloThreeSelector {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const ValueType& value) const {
+    return value % 5 == 0 ? 3 : int(value % 3);
+  }
+};
+
+template <class SourceViewType, class DestViewType, class CountsViewType,
+          class IntraTeamSentinelView>
+struct TestFunctorA {
+  SourceViewType m_sourceView;
+  DestViewType m_dest0View;
+  DestViewType m_dest1View;
+  DestViewType m_dest2View;
+  CountsViewType m_countsView;
+  IntraTeamSentinelView m_intraTeamSentinelView;
+  int m_apiPick;
+
+  TestFunctorA(const SourceViewType sourceView, const DestViewType dest0View,
+               const DestViewType dest1View, const DestViewType dest2View,
+               const CountsViewType countsView,
+               const IntraTeamSentinelView intraTeamSentinelView, int apiPick)
+      : m_sourceView(sourceView),
+        m_dest0View(dest0View),
+        m_dest1View(dest1View),
+        m_dest2View(dest2View),
+        m_countsView(countsView),
+        m_intraTeamSentinelView(intraTeamSentinelView),
+        m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+
+    auto myRowFrom   = Kokkos::subview(m_sourceView, myRowIndex, Kokkos::ALL());
+    auto myRowDest0  = Kokkos::subview(m_dest0View, myRowIndex, Kokkos::ALL());
+    auto myRowDest1  = Kokkos::subview(m_dest1View, myRowIndex, Kokkos::ALL());
+    auto myRowDest2  = Kokkos::subview(m_dest2View, myRowIndex, Kokkos::ALL());
+    using value_type = typename SourceViewType::value_type;
+    ModuloThreeSelector<value_type> selector;
+
+    Kokkos::Array<std::size_t, 3> counts;
+    if (m_apiPick == 0) {
+      counts = KE::compact(member, KE::cbegin(myRowFrom), KE::cend(myRowFrom),
+                           selector, KE::begin(myRowDest0),
+                           KE::begin(myRowDest1), KE::begin(myRowDest2));
+    } else {
+      counts = KE::compact(member, myRowFrom, selector, myRowDest0, myRowDest1,
+                           myRowDest2);
+    }
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      for (int k = 0; k < 3; ++k) {
+        m_countsView(myRowIndex, k) = counts[k];
+      }
+    });
+
+    // store result of checking if all members have their local
+    // values matching the one stored in m_countsView
+    member.team_barrier();
+    bool intraTeamCheck = true;
+    for (int k = 0; k < 3; ++k) {
+      intraTeamCheck =
+          intraTeamCheck && team_members_have_matching_result(
+                                member, counts[k], m_countsView(myRowIndex, k));
+    }
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_intraTeamSentinelView(myRowIndex) = intraTeamCheck;
+    });
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, int apiId) {
+  /* description:
+     use a rank-2 view randomly filled with values,
+     and run a team-level compact of each row into three outputs
+     where each team is responsible for a single row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  auto [sourceView, sourceView_h] = create_random_view_and_host_clone(
+      LayoutTag{}, numTeams, numCols,
+      Kokkos::pair<ValueType, ValueType>{11, 523}, "sourceView");
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+  Kokkos::View<ValueType**> dest0("dest0", numTeams, numCols);
+  Kokkos::View<ValueType**> dest1("dest1", numTeams, numCols);
+  Kokkos::View<ValueType**> dest2("dest2", numTeams, numCols);
+  Kokkos::View<std::size_t**> counts("counts", numTeams, 3);
+  // sentinel to check if all members of the team compute the same result
+  Kokkos::View<bool*> intraTeamSentinelView("intraTeamSameResult", numTeams);
+
+  // use CTAD for functor
+  TestFunctorA fnc(sourceView, dest0, dest1, dest2, counts,
+                   intraTeamSentinelView, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // check
+  // -----------------------------------------------
+  auto counts_h                = create_host_space_copy(counts);
+  auto intraTeamSentinelView_h = create_host_space_copy(intraTeamSentinelView);
+  const std::vector dests_h{create_host_space_copy(dest0),
+                            create_host_space_copy(dest1),
+                            create_host_space_copy(dest2)};
+  ModuloThreeSelector<ValueType> selector;
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    std::vector<std::vector<ValueType>> gold(3);
+    for (std::size_t j = 0; j < numCols; ++j) {
+      const int k = selector(sourceView_h(i, j));
+      if (k < 3) {
+        gold[k].push_back(sourceView_h(i, j));
+      }
+    }
+
+    for (std::size_t k = 0; k < 3; ++k) {
+      ASSERT_EQ(gold[k].size(), counts_h(i, k));
+      for (std::size_t j = 0; j < gold[k].size(); ++j) {
+        ASSERT_EQ(gold[k][j], dests_h[k](i, j));
+      }
+    }
+    ASSERT_TRUE(intraTeamSentinelView_h(i));
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444, 8153}) {
+      for (int apiId : {0, 1}) {
+        test_A<LayoutTag, ValueType>(numTeams, numCols, apiId);
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_compact_team_test, test) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, int>();
+}
+
+}  // namespace TeamCompact
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,177 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamLowerBoundBatch {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ViewType, class QueriesViewType, class DestViewType,
+          class DistancesViewType, class IntraTeamSentinelView>
+struct TestFunctorA {
+  ViewType m_view;
+  QueriesViewType m_queries;
+  DestViewType m_dest;
+  DistancesViewType m_distances;
+  IntraTeamSentinelView m_intraTeamSentinelView;
+  int m_apiPick;
+
+  TestFunctorA(const ViewType view, const QueriesViewType queries,
+               const DestViewType dest, const DistancesViewType distances,
+               const IntraTeamSentinelView intraTeamSentinelView, int apiPick)
+      : m_view(view),
+        m_queries(queries),
+        m_dest(dest),
+        m_distances(distances),
+        m_intraTeamSentinelView(intraTeamSentinelView),
+        m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView        = Kokkos::subview(m_view, myRowIndex, Kokkos::ALL());
+
+    auto myRowQueries = Kokkos::subview(m_queries, myRowIndex, Kokkos::ALL());
+    auto myRowDest    = Kokkos::subview(m_dest, myRowIndex, Kokkos::ALL());
+    auto first        = KE::cbegin(myRowView);
+    auto last         = KE::cend(myRowView);
+    auto q_first      = KE::cbegin(myRowQueries);
+    auto q_last       = KE::cend(myRowQueries);
+    auto d_first      = KE::begin(myRowDest);
+    using value_type  = typename ViewType::value_type;
+    CustomLessThanComparator<value_type> comp;
+
+    decltype(d_first) result = d_first;
+    if (m_apiPick == 0) {
+      result = KE::lower_bound_batch(member, first, last, q_first, q_last,
+                                     d_first);
+    } else if (m_apiPick == 1) {
+      result =
+          KE::lower_bound_batch(member, myRowView, myRowQueries, myRowDest);
+    } else if (m_apiPick == 2) {
+      result = KE::lower_bound_batch(member, first, last, q_first, q_last,
+                                     d_first, comp);
+    } else if (m_apiPick == 3) {
+      result = KE::lower_bound_batch(member, myRowView, myRowQueries,
+                                     myRowDest, comp);
+    }
+    const std::size_t distance = KE::distance(d_first, result);
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_distances(myRowIndex) = distance;
+    });
+
+    // store result of checking if all members have their local
+    // values matching the one stored in m_distances
+    member.team_barrier();
+    const bool intraTeamCheck = team_members_have_matching_result(
+        member, distance, m_distances(myRowIndex));
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_intraTeamSentinelView(myRowIndex) = intraTeamCheck;
+    });
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, int apiId) {
+  /* description:
+     create a rank-2 view whose rows are sorted and a rank-2 view of
+     queries, and do a team-level lower_bound_batch of each row of queries
+     in the matching row of the table where each team is responsible for
+     a single row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  // the values are taken from a small range so that there are duplicates
+  auto [dataView, dataView_h] = create_random_view_and_host_clone(
+      LayoutTag{}, numTeams, numCols,
+      Kokkos::pair<ValueType, ValueType>{11, 57}, "dataView");
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto row = Kokkos::subview(dataView_h, i, Kokkos::ALL());
+    std::sort(KE::begin(row), KE::end(row));
+  }
+  auto dataView_dc =
+      create_deep_copyable_compatible_view_with_same_extent(dataView);
+  Kokkos::deep_copy(dataView_dc, dataView_h);
+  // use CTAD
+  CopyFunctorRank2 F1(dataView_dc, dataView);
+  Kokkos::parallel_for("copy", dataView.extent(0) * dataView.extent(1), F1);
+
+  // the queries also fall below and above the values of the table
+  auto [queriesView, queriesView_h] = create_random_view_and_host_clone(
+      LayoutTag{}, numTeams, numCols,
+      Kokkos::pair<ValueType, ValueType>{5, 63}, "queriesView", 4527);
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+  Kokkos::View<std::size_t**> dest("dest", numTeams, numCols);
+  Kokkos::View<std::size_t*> distances("distances", numTeams);
+  // sentinel to check if all members of the team compute the same result
+  Kokkos::View<bool*> intraTeamSentinelView("intraTeamSameResult", numTeams);
+
+  // use CTAD for functor
+  TestFunctorA fnc(dataView, queriesView, dest, distances,
+                   intraTeamSentinelView, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // check
+  // -----------------------------------------------
+  auto dest_h                  = create_host_space_copy(dest);
+  auto distances_h             = create_host_space_copy(distances);
+  auto intraTeamSentinelView_h = create_host_space_copy(intraTeamSentinelView);
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto row   = Kokkos::subview(dataView_h, i, Kokkos::ALL());
+    auto first = KE::cbegin(row);
+    auto last  = KE::cend(row);
+    ASSERT_EQ(numCols, distances_h(i));
+    for (std::size_t j = 0; j < numCols; ++j) {
+      const std::size_t gold = KE::distance(
+          first, std::lower_bound(first, last, queriesView_h(i, j)));
+      ASSERT_EQ(gold, dest_h(i, j));
+    }
+    ASSERT_TRUE(intraTeamSentinelView_h(i));
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444, 8153}) {
+      for (int apiId : {0, 1, 2, 3}) {
+        test_A<LayoutTag, ValueType>(numTeams, numCols, apiId);
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_lower_bound_batch_team_test, test) {
+  run_all_scenarios<DynamicTag, double>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, unsigned>();
+}
+
+}  // namespace TeamLowerBoundBatch
+}  // namespace stdalgos
+}  // namespace Test
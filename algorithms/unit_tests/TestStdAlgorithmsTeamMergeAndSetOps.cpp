@@ -0,0 +1,238 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamMergeAndSetOps {
+
+namespace KE = Kokkos::Experimental;
+
+enum class MergeOp { merge, set_union, set_intersection, set_difference };
+
+template <class SourceViewType, class DestViewType, class CountsViewType,
+          class IncludesViewType, class IntraTeamSentinelView>
+struct TestFunctorA {
+  SourceViewType m_view1;
+  SourceViewType m_view2;
+  DestViewType m_dest;
+  CountsViewType m_counts;
+  IncludesViewType m_includes;
+  IntraTeamSentinelView m_intraTeamSentinelView;
+  MergeOp m_op;
+  int m_apiPick;
+
+  TestFunctorA(const SourceViewType view1, const SourceViewType view2,
+               const DestViewType dest, const CountsViewType counts,
+               const IncludesViewType includes,
+               const IntraTeamSentinelView intraTeamSentinelView, MergeOp op,
+               int apiPick)
+      : m_view1(view1),
+        m_view2(view2),
+        m_dest(dest),
+        m_counts(counts),
+        m_includes(includes),
+        m_intraTeamSentinelView(intraTeamSentinelView),
+        m_op(op),
+        m_apiPick(apiPick) {}
+
+  template <class... Args>
+  KOKKOS_INLINE_FUNCTION auto call(Args&&... args) const {
+    if (m_op == MergeOp::merge) {
+      return KE::merge(args...);
+    } else if (m_op == MergeOp::set_union) {
+      return KE::set_union(args...);
+    } else if (m_op == MergeOp::set_intersection) {
+      return KE::set_intersection(args...);
+    }
+    return KE::set_difference(args...);
+  }
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView1 = Kokkos::subview(m_view1, myRowIndex, Kokkos::ALL());
+    auto myRowView2 = Kokkos::subview(m_view2, myRowIndex, Kokkos::ALL());
+    auto myRowDest  = Kokkos::subview(m_dest, myRowIndex, Kokkos::ALL());
+    auto first1     = KE::cbegin(myRowView1);
+    auto last1      = KE::cend(myRowView1);
+    auto first2     = KE::cbegin(myRowView2);
+    auto last2      = KE::cend(myRowView2);
+    auto mid1       = first1 + KE::distance(first1, last1) / 2;
+    auto d_first    = KE::begin(myRowDest);
+    using value_type = typename SourceViewType::value_type;
+    CustomLessThanComparator<value_type> comp;
+
+    decltype(d_first) result = d_first;
+    bool includes            = false;
+    if (m_apiPick == 0) {
+      result   = call(member, first1, last1, first2, last2, d_first);
+      includes = KE::includes(member, first1, last1, first1, mid1);
+    } else if (m_apiPick == 1) {
+      result   = call(member, myRowView1, myRowView2, myRowDest);
+      includes = KE::includes(member, myRowView1, myRowView2);
+    } else if (m_apiPick == 2) {
+      result   = call(member, first1, last1, first2, last2, d_first, comp);
+      includes = KE::includes(member, first1, last1, first1, mid1, comp);
+    } else if (m_apiPick == 3) {
+      result   = call(member, myRowView1, myRowView2, myRowDest, comp);
+      includes = KE::includes(member, myRowView1, myRowView2, comp);
+    }
+    const std::size_t count = KE::distance(d_first, result);
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_counts(myRowIndex)   = count;
+      m_includes(myRowIndex) = includes;
+    });
+
+    // store result of checking if all members have their local
+    // values matching the one stored in m_counts
+    member.team_barrier();
+    const bool intraTeamCheck =
+        team_members_have_matching_result(member, count, m_counts(myRowIndex));
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_intraTeamSentinelView(myRowIndex) = intraTeamCheck;
+    });
+  }
+};
+
+template <class LayoutTag, class ValueType>
+auto create_view_with_sorted_rows(std::size_t numRows, std::size_t numCols,
+                                  ValueType upper, std::size_t seed) {
+  auto dataView =
+      create_view<ValueType>(LayoutTag{}, numRows, numCols, "dataView");
+  auto dataView_dc =
+      create_deep_copyable_compatible_view_with_same_extent(dataView);
+  auto dataView_dc_h = create_mirror_view(Kokkos::HostSpace(), dataView_dc);
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> pool(
+      seed);
+  Kokkos::fill_random(dataView_dc_h, pool, ValueType{0}, upper);
+  for (std::size_t i = 0; i < numRows; ++i) {
+    auto row = Kokkos::subview(dataView_dc_h, i, Kokkos::ALL());
+    std::sort(KE::begin(row), KE::end(row));
+  }
+  Kokkos::deep_copy(dataView_dc, dataView_dc_h);
+  // use CTAD
+  CopyFunctorRank2 F1(dataView_dc, dataView);
+  Kokkos::parallel_for("copy", dataView.extent(0) * dataView.extent(1), F1);
+  return std::make_pair(dataView, dataView_dc_h);
+}
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, MergeOp op, int apiId) {
+  /* description:
+     create two rank-2 views whose rows are sorted and do a team-level
+     merge or set operation of the matching rows where each team is
+     responsible for a single row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  // the values are taken from a small range so that there are duplicates
+  auto [view1, view1_h] = create_view_with_sorted_rows<LayoutTag, ValueType>(
+      numTeams, numCols, 37, 3451);
+  auto [view2, view2_h] = create_view_with_sorted_rows<LayoutTag, ValueType>(
+      numTeams, numCols, 37, 8756);
+  auto dest = create_view<ValueType>(LayoutTag{}, numTeams, 2 * numCols,
+                                     "destView");
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+  Kokkos::View<std::size_t*> counts("counts", numTeams);
+  Kokkos::View<bool*> includes("includes", numTeams);
+  // sentinel to check if all members of the team compute the same result
+  Kokkos::View<bool*> intraTeamSentinelView("intraTeamSameResult", numTeams);
+
+  // use CTAD for functor
+  TestFunctorA fnc(view1, view2, dest, counts, includes,
+                   intraTeamSentinelView, op, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // check
+  // -----------------------------------------------
+  auto counts_h                = create_host_space_copy(counts);
+  auto includes_h              = create_host_space_copy(includes);
+  auto dest_h                  = create_host_space_copy(dest);
+  auto intraTeamSentinelView_h = create_host_space_copy(intraTeamSentinelView);
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto row1 = Kokkos::subview(view1_h, i, Kokkos::ALL());
+    auto row2 = Kokkos::subview(view2_h, i, Kokkos::ALL());
+    std::vector<ValueType> gold(2 * numCols);
+    auto goldFirst1 = KE::cbegin(row1);
+    auto goldLast1  = KE::cend(row1);
+    auto goldFirst2 = KE::cbegin(row2);
+    auto goldLast2  = KE::cend(row2);
+    auto goldEnd    = gold.begin();
+    if (op == MergeOp::merge) {
+      goldEnd = std::merge(goldFirst1, goldLast1, goldFirst2, goldLast2,
+                           gold.begin());
+    } else if (op == MergeOp::set_union) {
+      goldEnd = std::set_union(goldFirst1, goldLast1, goldFirst2, goldLast2,
+                               gold.begin());
+    } else if (op == MergeOp::set_intersection) {
+      goldEnd = std::set_intersection(goldFirst1, goldLast1, goldFirst2,
+                                      goldLast2, gold.begin());
+    } else {
+      goldEnd = std::set_difference(goldFirst1, goldLast1, goldFirst2,
+                                    goldLast2, gold.begin());
+    }
+    gold.erase(goldEnd, gold.end());
+
+    // apiId 0 and 2 check that a row includes its first half
+    const bool goldIncludes =
+        (apiId % 2 == 0)
+            ? true
+            : std::includes(goldFirst1, goldLast1, goldFirst2, goldLast2);
+    ASSERT_EQ(goldIncludes, includes_h(i));
+
+    ASSERT_EQ(gold.size(), counts_h(i));
+    for (std::size_t j = 0; j < gold.size(); ++j) {
+      ASSERT_EQ(gold[j], dest_h(i, j));
+    }
+    ASSERT_TRUE(intraTeamSentinelView_h(i));
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444, 8153}) {
+      for (auto op : {MergeOp::merge, MergeOp::set_union,
+                      MergeOp::set_intersection, MergeOp::set_difference}) {
+        for (int apiId : {0, 1, 2, 3}) {
+          test_A<LayoutTag, ValueType>(numTeams, numCols, op, apiId);
+        }
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_merge_and_set_ops_team_test, test) {
+  run_all_scenarios<DynamicTag, double>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, unsigned>();
+}
+
+}  // namespace TeamMergeAndSetOps
+}  // namespace stdalgos
+}  // namespace Test
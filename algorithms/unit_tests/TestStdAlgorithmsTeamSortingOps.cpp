@@ -0,0 +1,179 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamSortingOps {
+
+namespace KE = Kokkos::Experimental;
+
+enum class SortingOp { sort, nth_element, partial_sort };
+
+template <class ValueType>
+struct GreaterThanComparator {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a > b;
+  }
+};
+
+template <class ViewType>
+struct TestFunctorA {
+  ViewType m_view;
+  SortingOp m_op;
+  std::size_t m_location;
+  int m_apiPick;
+
+  TestFunctorA(const ViewType view, SortingOp op, std::size_t location,
+               int apiPick)
+      : m_view(view), m_op(op), m_location(location), m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView        = Kokkos::subview(m_view, myRowIndex, Kokkos::ALL());
+    auto first            = KE::begin(myRowView);
+    auto last             = KE::end(myRowView);
+    auto location         = first + m_location;
+    using value_type      = typename ViewType::value_type;
+    GreaterThanComparator<value_type> comp;
+
+    if (m_op == SortingOp::sort) {
+      if (m_apiPick == 0) {
+        KE::sort(member, first, last);
+      } else if (m_apiPick == 1) {
+        KE::sort(member, myRowView);
+      } else if (m_apiPick == 2) {
+        KE::sort(member, first, last, comp);
+      } else if (m_apiPick == 3) {
+        KE::sort(member, myRowView, comp);
+      }
+    } else if (m_op == SortingOp::nth_element) {
+      if (m_apiPick == 0) {
+        KE::nth_element(member, first, location, last);
+      } else if (m_apiPick == 1) {
+        KE::nth_element(member, myRowView, m_location);
+      } else if (m_apiPick == 2) {
+        KE::nth_element(member, first, location, last, comp);
+      } else if (m_apiPick == 3) {
+        KE::nth_element(member, myRowView, m_location, comp);
+      }
+    } else {
+      if (m_apiPick == 0) {
+        KE::partial_sort(member, first, location, last);
+      } else if (m_apiPick == 1) {
+        KE::partial_sort(member, myRowView, m_location);
+      } else if (m_apiPick == 2) {
+        KE::partial_sort(member, first, location, last, comp);
+      } else if (m_apiPick == 3) {
+        KE::partial_sort(member, myRowView, m_location, comp);
+      }
+    }
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, SortingOp op,
+            int apiId) {
+  /* description:
+     create a rank-2 view, randomly fill, and do a team-level
+     sort, nth_element or partial_sort for each row where each team
+     is responsible for a single row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  // the values are taken from a small range so that there are duplicates
+  auto [dataView, cloneOfDataViewBeforeOp_h] =
+      create_random_view_and_host_clone(
+          LayoutTag{}, numTeams, numCols,
+          Kokkos::pair<ValueType, ValueType>{11, 97}, "dataView");
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  const std::size_t location = (op == SortingOp::nth_element)
+                                   ? numCols / 2
+                                   : std::min<std::size_t>(numCols, 7);
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+  // use CTAD for functor
+  TestFunctorA fnc(dataView, op, location, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // check
+  // -----------------------------------------------
+  auto dataViewAfterOp_h = create_host_space_copy(dataView);
+  for (std::size_t i = 0; i < dataViewAfterOp_h.extent(0); ++i) {
+    auto rowBefore =
+        Kokkos::subview(cloneOfDataViewBeforeOp_h, i, Kokkos::ALL());
+    auto rowAfter = Kokkos::subview(dataViewAfterOp_h, i, Kokkos::ALL());
+    std::vector<ValueType> gold(KE::cbegin(rowBefore), KE::cend(rowBefore));
+    std::vector<ValueType> result(KE::cbegin(rowAfter), KE::cend(rowAfter));
+    if (apiId <= 1) {
+      std::sort(gold.begin(), gold.end());
+    } else {
+      std::sort(gold.begin(), gold.end(), GreaterThanComparator<ValueType>{});
+    }
+
+    if (op == SortingOp::sort) {
+      ASSERT_EQ(gold, result);
+    } else if (op == SortingOp::nth_element) {
+      if (location < numCols) {
+        ASSERT_EQ(gold[location], result[location]);
+      }
+      std::sort(result.begin(), result.end());
+      std::sort(gold.begin(), gold.end());
+      ASSERT_EQ(gold, result);
+    } else {
+      ASSERT_TRUE(std::equal(gold.begin(), gold.begin() + location,
+                             result.begin()));
+      std::sort(result.begin(), result.end());
+      std::sort(gold.begin(), gold.end());
+      ASSERT_EQ(gold, result);
+    }
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444, 8153}) {
+      for (auto op :
+           {SortingOp::sort, SortingOp::nth_element, SortingOp::partial_sort}) {
+        for (int apiId : {0, 1, 2, 3}) {
+          test_A<LayoutTag, ValueType>(numTeams, numCols, op, apiId);
+        }
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_sorting_ops_team_test, sort_nth_element_partial_sort) {
+  run_all_scenarios<DynamicTag, double>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, unsigned>();
+}
+
+}  // namespace TeamSortingOps
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,350 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_Bitset64.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::Bitset64.
+
+#ifndef KOKKOS_BITSET64_HPP
+#define KOKKOS_BITSET64_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_BITSET64
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_BitManipulation.hpp>
+
+#include <cstdint>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class Bitset64
+/// \brief Thread-safe view to a bitset with 64-bit blocks.
+///
+/// Unlike Kokkos::Bitset, whose blocks and indices are \c unsigned, the
+/// blocks are 64 bits wide and the bits are indexed with \c size_t, so the
+/// set can hold more than 2^32 bits and the scans over it read twice as many
+/// bits per word.  Besides setting, resetting and testing single bits with
+/// atomics from the device, the host functions set and reset ranges of bits,
+/// count the bits that are set, find the first one and compact the indices
+/// of all of them into a View.
+///
+/// The bits past size() in the last block are always 0.
+template <typename Device = Kokkos::DefaultExecutionSpace>
+class Bitset64 {
+ public:
+  using execution_space = typename Device::execution_space;
+  using size_type       = size_t;
+  using block_type      = uint64_t;
+
+  static constexpr size_type block_size = sizeof(block_type) * CHAR_BIT;
+
+ private:
+  static constexpr size_type block_mask = block_size - 1;
+  static constexpr int block_shift      = 6;
+  static_assert(size_type(1) << block_shift == block_size);
+
+  static constexpr block_type all_bits = ~block_type(0);
+
+  using block_view_type =
+      View<block_type*, Device, MemoryTraits<RandomAccess>>;
+
+ public:
+  Bitset64() = default;
+
+  /// arg_size := number of bits in the set
+  Bitset64(size_type arg_size) : Bitset64(Kokkos::view_alloc(), arg_size) {}
+
+  template <class... P>
+  Bitset64(const Kokkos::Impl::ViewCtorProp<P...>& arg_prop, size_type arg_size)
+      : m_size(arg_size) {
+    using alloc_prop_t = std::decay_t<decltype(arg_prop)>;
+    static_assert(alloc_prop_t::initialize,
+                  "Allocation property 'initialize' should be true.");
+    static_assert(
+        !alloc_prop_t::has_pointer,
+        "Allocation properties should not contain the 'pointer' property.");
+
+    const auto prop_copy = Kokkos::Impl::with_properties_if_unset(
+        arg_prop, std::string("Bitset64"));
+    m_blocks = block_view_type(prop_copy, (m_size + block_mask) >> block_shift);
+  }
+
+  //! \name Host functions
+  //@{
+
+  /// number of bits which are set to 1
+  size_type count() const { return count(execution_space()); }
+
+  template <class ExecSpace>
+  size_type count(ExecSpace const& exec) const {
+    // four blocks per iteration leave the compiler room to vectorize the
+    // population counts
+    constexpr size_type unroll = 4;
+    const block_view_type blocks = m_blocks;
+    const size_type num_blocks   = blocks.extent(0);
+    size_type result             = 0;
+    parallel_reduce(
+        "Kokkos::Experimental::Bitset64::count",
+        RangePolicy<ExecSpace>(exec, 0, (num_blocks + unroll - 1) / unroll),
+        KOKKOS_LAMBDA(size_type j, size_type & partial) {
+          const size_type begin = j * unroll;
+          if (begin + unroll <= num_blocks) {
+            for (size_type b = begin; b < begin + unroll; ++b) {
+              partial += Kokkos::Experimental::popcount_builtin(blocks(b));
+            }
+          } else {
+            for (size_type b = begin; b < num_blocks; ++b) {
+              partial += Kokkos::Experimental::popcount_builtin(blocks(b));
+            }
+          }
+        },
+        result);
+    return result;
+  }
+
+  /// set all bits to 1
+  void set() {
+    execution_space exec;
+    set(exec, 0, m_size);
+    exec.fence("Kokkos::Experimental::Bitset64::set: fence after setting");
+  }
+
+  /// set all bits to 0
+  void reset() {
+    execution_space exec;
+    reset(exec, 0, m_size);
+    exec.fence("Kokkos::Experimental::Bitset64::reset: fence after resetting");
+  }
+
+  /// set all bits to 0
+  void clear() { reset(); }
+
+  /// set the bits [begin, end) to 1
+  ///
+  /// Only the first and the last block of the range are updated with atomics,
+  /// so the bits outside of the range may be changed concurrently.
+  template <class ExecSpace>
+  void set(ExecSpace const& exec, size_type begin, size_type end) {
+    impl_update_range(exec, begin, end, true);
+  }
+
+  /// set the bits [begin, end) to 0
+  template <class ExecSpace>
+  void reset(ExecSpace const& exec, size_type begin, size_type end) {
+    impl_update_range(exec, begin, end, false);
+  }
+
+  /// the index of the first bit set to 1, or size() if there is none
+  size_type find_first_set() const { return find_first_set(execution_space()); }
+
+  template <class ExecSpace>
+  size_type find_first_set(ExecSpace const& exec) const {
+    const block_view_type blocks = m_blocks;
+    size_type result             = 0;
+    parallel_reduce(
+        "Kokkos::Experimental::Bitset64::find_first_set",
+        RangePolicy<ExecSpace>(exec, 0, blocks.extent(0)),
+        KOKKOS_LAMBDA(size_type b, size_type & first) {
+          const block_type block = blocks(b);
+          if (block == 0) return;
+          const size_type i =
+              (b << block_shift) +
+              Kokkos::Experimental::countr_zero_builtin(block);
+          if (i < first) first = i;
+        },
+        Kokkos::Min<size_type>(result));
+    return result < m_size ? result : m_size;
+  }
+
+  /// \brief Write the indices of the bits set to 1 in increasing order.
+  ///
+  /// \c indices is reallocated if it cannot hold all of them.
+  /// \return The number of bits set to 1.
+  template <class ExecSpace, class IndicesView>
+  size_type to_indices(ExecSpace const& exec, IndicesView& indices) const {
+    size_type total = impl_write_indices(exec, indices);
+    if (total > indices.extent(0)) {
+      Kokkos::realloc(view_alloc(exec, WithoutInitializing), indices, total);
+      impl_write_indices(exec, indices);
+    }
+    return total;
+  }
+
+  //@}
+  //! \name Device functions
+  //@{
+
+  /// number of bits in the set
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_type size() const { return m_size; }
+
+  /// set i'th bit to 1, returns true if it was 0 before
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool set(size_type i) const {
+    if (i < m_size) {
+      const block_type mask = block_type(1) << (i & block_mask);
+      return !(atomic_fetch_or(&m_blocks[i >> block_shift], mask) & mask);
+    }
+    return false;
+  }
+
+  /// set i'th bit to 0, returns true if it was 1 before
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool reset(size_type i) const {
+    if (i < m_size) {
+      const block_type mask = block_type(1) << (i & block_mask);
+      return atomic_fetch_and(&m_blocks[i >> block_shift], ~mask) & mask;
+    }
+    return false;
+  }
+
+  /// return true if the i'th bit set to 1
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool test(size_type i) const {
+    if (i < m_size) {
+      const block_type mask = block_type(1) << (i & block_mask);
+      return load_block(i >> block_shift) & mask;
+    }
+    return false;
+  }
+
+  /// \brief The index of the first bit set to 1 in [i, end), or end if there
+  ///   is none.
+  ///
+  /// Threads iterate over the bits of disjoint ranges in parallel by calling
+  /// this with the index following the last one found.
+  KOKKOS_INLINE_FUNCTION
+  size_type find_next(size_type i, size_type end) const {
+    end = end < m_size ? end : m_size;
+    if (i >= end) return end;
+    size_type b            = i >> block_shift;
+    const size_type last   = (end - 1) >> block_shift;
+    block_type block = load_block(b) & (all_bits << (i & block_mask));
+    while (block == 0) {
+      if (++b > last) return end;
+      block = load_block(b);
+    }
+    const size_type next =
+        (b << block_shift) + Kokkos::Experimental::countr_zero_builtin(block);
+    return next < end ? next : end;
+  }
+
+  /// the index of the first bit set to 1 at or after i, or size()
+  KOKKOS_INLINE_FUNCTION
+  size_type find_next(size_type i) const { return find_next(i, m_size); }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool is_allocated() const {
+    return m_blocks.is_allocated();
+  }
+
+  //@}
+
+  // The helpers below are public only because nvcc does not allow device
+  // lambdas in private member functions.
+  template <class ExecSpace>
+  void impl_update_range(ExecSpace const& exec, size_type begin,
+                         size_type end, bool value) {
+    end = end < m_size ? end : m_size;
+    if (begin >= end) return;
+    const block_view_type blocks = m_blocks;
+    const size_type first        = begin >> block_shift;
+    const size_type last         = (end - 1) >> block_shift;
+    const block_type first_mask  = all_bits << (begin & block_mask);
+    const block_type last_mask =
+        all_bits >> (block_mask - ((end - 1) & block_mask));
+    parallel_for(
+        "Kokkos::Experimental::Bitset64::update_range",
+        RangePolicy<ExecSpace>(exec, first, last + 1),
+        KOKKOS_LAMBDA(size_type b) {
+          block_type mask = all_bits;
+          if (b == first) mask &= first_mask;
+          if (b == last) mask &= last_mask;
+          if (mask == all_bits) {
+            blocks(b) = value ? all_bits : 0;
+          } else if (value) {
+            atomic_fetch_or(&blocks(b), mask);
+          } else {
+            atomic_fetch_and(&blocks(b), ~mask);
+          }
+        });
+  }
+
+  // Writes the indices that fit into indices, returns the number of bits set.
+  template <class ExecSpace, class IndicesView>
+  size_type impl_write_indices(ExecSpace const& exec,
+                               IndicesView const& indices) const {
+    using index_type             = typename IndicesView::non_const_value_type;
+    const block_view_type blocks = m_blocks;
+    const size_type capacity     = indices.extent(0);
+    size_type total              = 0;
+    parallel_scan(
+        "Kokkos::Experimental::Bitset64::to_indices",
+        RangePolicy<ExecSpace>(exec, 0, blocks.extent(0)),
+        KOKKOS_LAMBDA(size_type b, size_type & offset, bool final) {
+          block_type block = blocks(b);
+          if (final) {
+            for (size_type out = offset; block != 0 && out < capacity;
+                 ++out) {
+              indices(out) = index_type(
+                  (b << block_shift) +
+                  Kokkos::Experimental::countr_zero_builtin(block));
+              block &= block - 1;
+            }
+            block = blocks(b);
+          }
+          offset += Kokkos::Experimental::popcount_builtin(block);
+        },
+        total);
+    return total;
+  }
+
+ private:
+  KOKKOS_FORCEINLINE_FUNCTION
+  block_type load_block(size_type b) const {
+#ifdef KOKKOS_ENABLE_SYCL
+    return Kokkos::atomic_load(&m_blocks[b]);
+#else
+    return volatile_load(&m_blocks[b]);
+#endif
+  }
+
+  size_type m_size = 0;
+  block_view_type m_blocks;
+
+  template <typename DstDevice, typename SrcDevice>
+  friend void deep_copy(Bitset64<DstDevice>& dst,
+                        Bitset64<SrcDevice> const& src);
+};
+
+template <typename DstDevice, typename SrcDevice>
+void deep_copy(Bitset64<DstDevice>& dst, Bitset64<SrcDevice> const& src) {
+  if (dst.size() != src.size()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Error: Cannot deep_copy bitsets of different sizes!");
+  }
+  Kokkos::deep_copy(dst.m_blocks, src.m_blocks);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_BITSET64
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_BITSET64
+#endif
+#endif  // KOKKOS_BITSET64_HPP
@@ -29,6 +29,13 @@
 
 #include <Kokkos_Core.hpp>
 #include <impl/Kokkos_Error.hpp>
+#include <impl/Kokkos_HostSharedPtr.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
 
 namespace Kokkos {
 
@@ -85,6 +92,173 @@ inline const Kokkos::Cuda& get_cuda_space(const NonCudaExecSpace&) {
 
 #endif  // KOKKOS_ENABLE_CUDA
 
+// The copy started by the last DualView::sync_async that may still be running:
+// the side it writes to and how to wait for it.  The mutex serializes the
+// handoff of the fence between host threads sharing the DualView.
+struct DualViewPendingSync {
+  std::mutex mutex;
+  std::atomic<int> target{-1};
+  std::function<void()> fence;
+};
+
+// Record of the blocks of a DualView's span that were modified since the last
+// sync, see DualView::enable_dirty_tracking.  The first entries hold whether
+// the whole span is dirty, the size of the span and the size of a block, the
+// following ones one bit per block.
+using DualViewDirtyBlocks = View<uint64_t*, LayoutLeft, Kokkos::HostSpace>;
+
+enum : size_t {
+  dual_view_all_dirty        = 0,
+  dual_view_dirty_span       = 1,
+  dual_view_dirty_block_size = 2,
+  dual_view_dirty_bits       = 3
+};
+
+inline DualViewDirtyBlocks dual_view_create_dirty_blocks(size_t span,
+                                                         size_t block_size) {
+  const size_t num_blocks = (span + block_size - 1) / block_size;
+  DualViewDirtyBlocks dirty("DualView::dirty_blocks",
+                            dual_view_dirty_bits + (num_blocks + 63) / 64);
+  dirty(dual_view_dirty_span)       = span;
+  dirty(dual_view_dirty_block_size) = block_size;
+  return dirty;
+}
+
+inline void dual_view_clear_dirty(const DualViewDirtyBlocks& dirty) {
+  for (size_t i = 0; i < dirty.extent(0); ++i) {
+    if (i != dual_view_dirty_span && i != dual_view_dirty_block_size) {
+      dirty(i) = 0;
+    }
+  }
+}
+
+// marks the blocks overlapping the entries [begin, end) of the span
+inline void dual_view_mark_dirty(const DualViewDirtyBlocks& dirty,
+                                 size_t begin, size_t end) {
+  end = std::min<size_t>(end, dirty(dual_view_dirty_span));
+  if (begin >= end) return;
+  const size_t block_size = dirty(dual_view_dirty_block_size);
+  for (size_t b = begin / block_size; b <= (end - 1) / block_size; ++b) {
+    dirty(dual_view_dirty_bits + b / 64) |= uint64_t(1) << (b % 64);
+  }
+}
+
+inline bool dual_view_is_dirty(const DualViewDirtyBlocks& dirty, size_t b) {
+  return (dirty(dual_view_dirty_bits + b / 64) >> (b % 64)) & 1;
+}
+
+// position in the span of the entry p of the runs packed one after the other
+template <class Offsets>
+KOKKOS_INLINE_FUNCTION size_t dual_view_unpack(const Offsets& begins,
+                                               const Offsets& starts,
+                                               size_t p) {
+  size_t lo = 0;
+  size_t hi = begins.extent(0);
+  while (hi - lo > 1) {
+    const size_t mid = (lo + hi) / 2;
+    if (starts(mid) <= p) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return begins(lo) + (p - starts(lo));
+}
+
+// Copies the dirty blocks of the span starting at src into the span starting
+// at dst.  A single run of blocks, or most of the span, is copied with one
+// deep_copy.  Several runs are copied by a single kernel when the destination
+// can access the source memory, otherwise they are packed into a buffer that
+// is copied with one deep_copy and unpacked on the other side.
+template <class DstDevice, class SrcDevice, class ValueType, class... Args>
+void dual_view_copy_dirty_blocks(ValueType* dst, const ValueType* src,
+                                 const DualViewDirtyBlocks& dirty,
+                                 const Args&... args) {
+  using dst_exec   = typename DstDevice::execution_space;
+  using src_exec   = typename SrcDevice::execution_space;
+  using dst_memory = typename DstDevice::memory_space;
+  using src_memory = typename SrcDevice::memory_space;
+
+  const size_t span       = dirty(dual_view_dirty_span);
+  const size_t block_size = dirty(dual_view_dirty_block_size);
+  const size_t num_blocks = (span + block_size - 1) / block_size;
+
+  // the runs of consecutive dirty blocks, with their positions in the span
+  // and in the packed buffer
+  std::vector<size_t> begins;
+  std::vector<size_t> starts;
+  size_t total = 0;
+  for (size_t b = 0; b < num_blocks;) {
+    if (!dual_view_is_dirty(dirty, b)) {
+      ++b;
+      continue;
+    }
+    size_t e = b + 1;
+    while (e < num_blocks && dual_view_is_dirty(dirty, e)) ++e;
+    begins.push_back(b * block_size);
+    starts.push_back(total);
+    total += std::min(e * block_size, span) - b * block_size;
+    b = e;
+  }
+  if (begins.empty()) return;
+
+  if (begins.size() == 1 || 2 * total > span) {
+    const size_t begin = begins.size() == 1 ? begins[0] : 0;
+    const size_t count = begins.size() == 1 ? total : span;
+    deep_copy(args...,
+              View<ValueType*, DstDevice, MemoryUnmanaged>(dst + begin, count),
+              View<const ValueType*, SrcDevice, MemoryUnmanaged>(src + begin,
+                                                                 count));
+    return;
+  }
+
+  // the kernels run on the default instances, ordered after the work
+  // submitted to the instance passed to sync
+  (args.fence("Kokkos::DualView::sync: fence before copying dirty blocks"),
+   ...);
+
+  const View<const size_t*, Kokkos::HostSpace, MemoryUnmanaged> host_begins(
+      begins.data(), begins.size());
+  const View<const size_t*, Kokkos::HostSpace, MemoryUnmanaged> host_starts(
+      starts.data(), starts.size());
+  const auto dst_begins =
+      create_mirror_view_and_copy(dst_memory{}, host_begins);
+  const auto dst_starts =
+      create_mirror_view_and_copy(dst_memory{}, host_starts);
+
+  if constexpr (SpaceAccessibility<dst_exec, src_memory>::accessible) {
+    parallel_for(
+        "Kokkos::DualView::sync: copy dirty blocks",
+        RangePolicy<dst_exec>(0, total), KOKKOS_LAMBDA(size_t p) {
+          const size_t i = dual_view_unpack(dst_begins, dst_starts, p);
+          dst[i]         = src[i];
+        });
+  } else {
+    const auto src_begins =
+        create_mirror_view_and_copy(src_memory{}, host_begins);
+    const auto src_starts =
+        create_mirror_view_and_copy(src_memory{}, host_starts);
+    View<ValueType*, SrcDevice> src_packed(
+        view_alloc(WithoutInitializing, "DualView::packed_dirty_blocks"),
+        total);
+    View<ValueType*, DstDevice> dst_packed(
+        view_alloc(WithoutInitializing, "DualView::packed_dirty_blocks"),
+        total);
+    parallel_for(
+        "Kokkos::DualView::sync: pack dirty blocks",
+        RangePolicy<src_exec>(0, total), KOKKOS_LAMBDA(size_t p) {
+          src_packed(p) = src[dual_view_unpack(src_begins, src_starts, p)];
+        });
+    deep_copy(dst_packed, src_packed);
+    parallel_for(
+        "Kokkos::DualView::sync: unpack dirty blocks",
+        RangePolicy<dst_exec>(0, total), KOKKOS_LAMBDA(size_t p) {
+          dst[dual_view_unpack(dst_begins, dst_starts, p)] = dst_packed(p);
+        });
+  }
+  dst_exec().fence("Kokkos::DualView::sync: fence after copying dirty blocks");
+}
+
 }  // namespace Impl
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
@@ -228,6 +402,25 @@ class DualView : public ViewTraits<DataType, Properties...> {
   t_host h_view;
   //@}
 
+  // Blocks of the span modified since the last sync, see
+  // enable_dirty_tracking.  Shared by copies like the modified flags.
+  Impl::DualViewDirtyBlocks dirty_blocks;
+  // offset of the views into the tracked span, nonzero for subviews
+  size_t dirty_offset = 0;
+
+  // Copy started by sync_async, shared by copies like the modified flags.
+  Kokkos::Impl::HostSharedPtr<Impl::DualViewPendingSync> pending_sync;
+
+  static Kokkos::Impl::HostSharedPtr<Impl::DualViewPendingSync>
+  impl_create_pending_sync() {
+    if constexpr (impl_dualview_is_single_device) {
+      return nullptr;
+    } else {
+      return Kokkos::Impl::HostSharedPtr<Impl::DualViewPendingSync>(
+          new Impl::DualViewPendingSync);
+    }
+  }
+
  public:
   //! \name Constructors
   //@{
@@ -260,8 +453,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
             Kokkos::view_alloc(typename t_modified_flags::execution_space{},
                                "DualView::modified_flags")),
         d_view(label, n0, n1, n2, n3, n4, n5, n6, n7),
-        h_view(create_mirror_view(d_view))  // without UVM, host View mirrors
-  {}
+        h_view(create_mirror_view(d_view)),  // without UVM, host View mirrors
+        pending_sync(impl_create_pending_sync()) {}
 
   /// \brief Constructor that allocates View objects on both host and device.
   ///
@@ -284,7 +477,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
            const size_t n5                   = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
            const size_t n6                   = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
            const size_t n7                   = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
-      : modified_flags(t_modified_flags("DualView::modified_flags")) {
+      : modified_flags(t_modified_flags("DualView::modified_flags")),
+        pending_sync(impl_create_pending_sync()) {
     if constexpr (Impl::ViewCtorProp<P...>::sequential_host_init) {
       h_view = t_host(arg_prop, n0, n1, n2, n3, n4, n5, n6, n7);
       static_assert(Impl::ViewCtorProp<P...>::initialize,
@@ -314,14 +508,21 @@ class DualView : public ViewTraits<DataType, Properties...> {
   DualView(const DualView<DT, DP...>& src)
       : modified_flags(src.modified_flags),
         d_view(src.d_view),
-        h_view(src.h_view) {}
+        h_view(src.h_view),
+        dirty_blocks(src.dirty_blocks),
+        dirty_offset(src.dirty_offset),
+        pending_sync(src.pending_sync) {}
 
   //! Subview constructor
   template <class DT, class... DP, class Arg0, class... Args>
   DualView(const DualView<DT, DP...>& src, const Arg0& arg0, Args... args)
       : modified_flags(src.modified_flags),
         d_view(Kokkos::subview(src.d_view, arg0, args...)),
-        h_view(Kokkos::subview(src.h_view, arg0, args...)) {}
+        h_view(Kokkos::subview(src.h_view, arg0, args...)),
+        dirty_blocks(src.dirty_blocks),
+        dirty_offset(src.dirty_offset +
+                     size_t(h_view.data() - src.h_view.data())),
+        pending_sync(src.pending_sync) {}
 
   /// \brief Create DualView from existing device and host View objects.
   ///
@@ -336,7 +537,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
   DualView(const t_dev& d_view_, const t_host& h_view_)
       : modified_flags(t_modified_flags("DualView::modified_flags")),
         d_view(d_view_),
-        h_view(h_view_) {
+        h_view(h_view_),
+        pending_sync(impl_create_pending_sync()) {
     if (int(d_view.rank) != int(h_view.rank) ||
         [&]() {
           // This has a false positive in clang-tidy
@@ -380,8 +582,19 @@ class DualView : public ViewTraits<DataType, Properties...> {
   ///   using host_device_type = typename Kokkos::HostSpace::execution_space;
   ///   typename dual_view_type::t_host hostView = DV.view<host_device_type> ();
   /// \endcode
+  ///
+  /// On the host, returning the host View waits for a sync_async to the
+  /// host.  Returning the device View never waits.
   template <class Device>
   KOKKOS_FUNCTION auto view() const {
+    if constexpr (!std::is_same_v<decltype(impl_view<Device>()), t_dev>) {
+      KOKKOS_IF_ON_HOST((impl_wait_for_sync(0);))
+    }
+    return impl_view<Device>();
+  }
+
+  template <class Device>
+  KOKKOS_FUNCTION auto impl_view() const {
     if constexpr (std::is_same_v<Device, typename Device::memory_space>) {
       if constexpr (std::is_same_v<typename Device::memory_space,
                                    typename t_dev::memory_space>) {
@@ -423,18 +636,44 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
   KOKKOS_INLINE_FUNCTION
-  t_host view_host() const { return h_view; }
+  t_host view_host() const {
+    KOKKOS_IF_ON_HOST((impl_wait_for_sync(0);))
+    return h_view;
+  }
 
   KOKKOS_INLINE_FUNCTION
-  t_dev view_device() const { return d_view; }
+  t_dev view_device() const {
+    return d_view;
+  }
 #else
   KOKKOS_INLINE_FUNCTION
-  const t_host& view_host() const { return h_view; }
+  const t_host& view_host() const {
+    KOKKOS_IF_ON_HOST((impl_wait_for_sync(0);))
+    return h_view;
+  }
 
   KOKKOS_INLINE_FUNCTION
-  const t_dev& view_device() const { return d_view; }
+  const t_dev& view_device() const {
+    return d_view;
+  }
 #endif
 
+  /// \brief Wait for the copy started by the last sync_async to complete.
+  ///
+  /// With \c side 0 or 1 only if it writes to the host or the device View.
+  /// Safe to call from several host threads: all of them return after the
+  /// copy completed.
+  void impl_wait_for_sync(int side = -1) const {
+    if (!pending_sync) return;
+    const int target = pending_sync->target.load(std::memory_order_acquire);
+    if (target < 0 || (side >= 0 && side != target)) return;
+    std::lock_guard<std::mutex> lock(pending_sync->mutex);
+    if (pending_sync->target.load(std::memory_order_relaxed) < 0) return;
+    pending_sync->fence();
+    pending_sync->fence = nullptr;
+    pending_sync->target.store(-1, std::memory_order_release);
+  }
+
   KOKKOS_INLINE_FUNCTION constexpr bool is_allocated() const {
     return (d_view.is_allocated() && h_view.is_allocated());
   }
@@ -546,6 +785,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
   template <class Device, class... Args>
   void sync_impl(std::true_type, Args const&... args) {
     if (modified_flags.data() == nullptr) return;
+    impl_wait_for_sync();
 
     int dev = get_device_side<Device>();
 
@@ -561,7 +801,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
         }
 #endif
 
-        deep_copy(args..., d_view, h_view);
+        impl_copy_modified(d_view, h_view, args...);
         modified_flags(0) = modified_flags(1) = 0;
         impl_report_device_sync();
       }
@@ -578,7 +818,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
         }
 #endif
 
-        deep_copy(args..., h_view, d_view);
+        impl_copy_modified(h_view, d_view, args...);
         modified_flags(0) = modified_flags(1) = 0;
         impl_report_host_sync();
       }
@@ -592,6 +832,71 @@ class DualView : public ViewTraits<DataType, Properties...> {
     }
   }
 
+  // Copies the modified parts of src into dst, see enable_dirty_tracking.
+  template <class DstView, class SrcView, class... Args>
+  void impl_copy_modified(const DstView& dst, const SrcView& src,
+                          Args const&... args) {
+    if constexpr (std::is_same_v<typename traits::data_type,
+                                 typename traits::non_const_data_type>) {
+      if (dirty_blocks.data() != nullptr &&
+          !dirty_blocks(Impl::dual_view_all_dirty)) {
+        Impl::dual_view_copy_dirty_blocks<typename DstView::device_type,
+                                          typename SrcView::device_type>(
+            dst.data() - dirty_offset, src.data() - dirty_offset, dirty_blocks,
+            args...);
+        Impl::dual_view_clear_dirty(dirty_blocks);
+        return;
+      }
+    }
+    deep_copy(args..., dst, src);
+    if (dirty_blocks.data() != nullptr) {
+      Impl::dual_view_clear_dirty(dirty_blocks);
+    }
+  }
+
+  /// \brief Like sync<Device>(exec), without waiting for the copy.
+  ///
+  /// The copy is ordered on \c exec like the other work submitted to it, so
+  /// kernels that use the synced View can be submitted to \c exec right
+  /// away while other instances keep working.  After a sync to the host the
+  /// DualView and its copies wait for it when they next return the host View
+  /// through view() or view_host().  Returning the device View never waits:
+  /// kernels using it must be ordered after the copy, e.g. by submitting them
+  /// to \c exec.  Modifying, syncing or reallocating the data always waits.
+  template <class Device, class ExecutionSpace>
+  void sync_async([[maybe_unused]] const ExecutionSpace& exec) {
+    if constexpr (!impl_dualview_is_single_device) {
+      impl_sync_async(get_device_side<Device>(), exec);
+    }
+  }
+
+  template <class ExecutionSpace>
+  void sync_host_async([[maybe_unused]] const ExecutionSpace& exec) {
+    if constexpr (!impl_dualview_is_single_device) impl_sync_async(0, exec);
+  }
+
+  template <class ExecutionSpace>
+  void sync_device_async([[maybe_unused]] const ExecutionSpace& exec) {
+    if constexpr (!impl_dualview_is_single_device) impl_sync_async(1, exec);
+  }
+
+  template <class ExecutionSpace>
+  void impl_sync_async(int side, const ExecutionSpace& exec) {
+    impl_wait_for_sync();
+    if (side == 1 && need_sync_device()) {
+      sync_device_impl(exec);
+    } else if (side == 0 && need_sync_host()) {
+      sync_host_impl(exec);
+    } else {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(pending_sync->mutex);
+    pending_sync->fence = [exec]() {
+      exec.fence("Kokkos::DualView::sync_async: fence before using the View");
+    };
+    pending_sync->target.store(side, std::memory_order_release);
+  }
+
   template <class Device>
   void sync() {
     if constexpr (impl_dualview_is_single_device) {
@@ -623,6 +928,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
   template <class Device, class... Args>
   void sync_impl(std::false_type, Args const&...) {
     if (modified_flags.data() == nullptr) return;
+    impl_wait_for_sync();
 
     int dev = get_device_side<Device>();
 
@@ -650,6 +956,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       Impl::throw_runtime_exception(
           "Calling sync_host on a DualView with a const datatype.");
     if (modified_flags.data() == nullptr) return;
+    impl_wait_for_sync();
     if (modified_flags(1) > modified_flags(0)) {
 #ifdef KOKKOS_ENABLE_CUDA
       if (std::is_same<typename t_dev::memory_space,
@@ -661,7 +968,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       }
 #endif
 
-      deep_copy(args..., h_view, d_view);
+      impl_copy_modified(h_view, d_view, args...);
       modified_flags(1) = modified_flags(0) = 0;
       impl_report_host_sync();
     }
@@ -693,6 +1000,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       Impl::throw_runtime_exception(
           "Calling sync_device on a DualView with a const datatype.");
     if (modified_flags.data() == nullptr) return;
+    impl_wait_for_sync();
     if (modified_flags(0) > modified_flags(1)) {
 #ifdef KOKKOS_ENABLE_CUDA
       if (std::is_same<typename t_dev::memory_space,
@@ -704,7 +1012,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       }
 #endif
 
-      deep_copy(args..., d_view, h_view);
+      impl_copy_modified(d_view, h_view, args...);
       modified_flags(1) = modified_flags(0) = 0;
       impl_report_device_sync();
     }
@@ -786,6 +1094,10 @@ class DualView : public ViewTraits<DataType, Properties...> {
       return;
     } else {
       if (modified_flags.data() == nullptr) return;
+      impl_wait_for_sync();
+      if (dirty_blocks.data() != nullptr) {
+        dirty_blocks(Impl::dual_view_all_dirty) = 1;
+      }
 
       int dev = get_device_side<Device>();
 
@@ -822,6 +1134,10 @@ class DualView : public ViewTraits<DataType, Properties...> {
       return;
     } else {
       if (modified_flags.data() != nullptr) {
+        impl_wait_for_sync();
+        if (dirty_blocks.data() != nullptr) {
+          dirty_blocks(Impl::dual_view_all_dirty) = 1;
+        }
         modified_flags(0) =
             (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                    : modified_flags(0)) +
@@ -844,6 +1160,10 @@ class DualView : public ViewTraits<DataType, Properties...> {
       return;
     } else {
       if (modified_flags.data() != nullptr) {
+        impl_wait_for_sync();
+        if (dirty_blocks.data() != nullptr) {
+          dirty_blocks(Impl::dual_view_all_dirty) = 1;
+        }
         modified_flags(1) =
             (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                    : modified_flags(0)) +
@@ -862,10 +1182,121 @@ class DualView : public ViewTraits<DataType, Properties...> {
   }
 
   inline void clear_sync_state() {
+    impl_wait_for_sync();
     if (modified_flags.data() != nullptr)
       modified_flags(1) = modified_flags(0) = 0;
+    if (dirty_blocks.data() != nullptr)
+      Impl::dual_view_clear_dirty(dirty_blocks);
   }
 
+  /// \brief Track modifications in blocks of \c block_size entries of the
+  ///   span instead of with a single flag per side.
+  ///
+  /// The ranges passed to modify(range), modify_host(range) and
+  /// modify_device(range) are then recorded in a bitmap of dirty blocks and
+  /// sync only copies those blocks, several of them in one batched copy.
+  /// The other modify methods still mark the whole span.
+  ///
+  /// The record is shared with the copies and subviews of this DualView made
+  /// afterwards.  Copies made before only see the modified flags and must not
+  /// be used to modify the data.
+  void enable_dirty_tracking(size_t block_size = 4096) {
+    if constexpr (impl_dualview_is_single_device) {
+      return;
+    } else {
+      if (block_size == 0) {
+        Impl::throw_runtime_exception(
+            "DualView::enable_dirty_tracking: the block size must be "
+            "positive");
+      }
+      if (!d_view.span_is_contiguous()) {
+        Impl::throw_runtime_exception(
+            "DualView::enable_dirty_tracking: the views must be contiguous");
+      }
+      dirty_blocks = Impl::dual_view_create_dirty_blocks(d_view.span(),
+                                                          block_size);
+      dirty_offset = 0;
+      // earlier modifications were not recorded block by block
+      if (modified_flags.data() != nullptr &&
+          (modified_flags(0) > 0 || modified_flags(1) > 0)) {
+        dirty_blocks(Impl::dual_view_all_dirty) = 1;
+      }
+    }
+  }
+
+  bool is_tracking_dirty_blocks() const {
+    return dirty_blocks.data() != nullptr;
+  }
+
+  /// \brief Mark the entries \c range of the first dimension as modified on
+  ///   the given device \c Device, see enable_dirty_tracking.
+  template <class Device>
+  void modify(const Kokkos::pair<size_t, size_t>& range) {
+    if constexpr (impl_dualview_is_single_device) {
+      return;
+    } else {
+      int dev = get_device_side<Device>();
+      if (dev == 1) modify_device(range);
+      if (dev == 0) modify_host(range);
+    }
+  }
+
+  inline void modify_host(const Kokkos::pair<size_t, size_t>& range) {
+    impl_modify_range(0, range);
+  }
+
+  inline void modify_device(const Kokkos::pair<size_t, size_t>& range) {
+    impl_modify_range(1, range);
+  }
+
+ private:
+  void impl_modify_range(int side, const Kokkos::pair<size_t, size_t>& range) {
+    if constexpr (impl_dualview_is_single_device) {
+      return;
+    } else {
+      if (modified_flags.data() == nullptr) return;
+      if (dirty_blocks.data() == nullptr) {
+        side == 1 ? modify_device() : modify_host();
+        return;
+      }
+      // the blocks of earlier modifications on the same side are kept
+      const bool restart   = modified_flags(side) == 0;
+      const auto all_dirty = dirty_blocks(Impl::dual_view_all_dirty);
+      side == 1 ? modify_device() : modify_host();
+      if (restart) {
+        Impl::dual_view_clear_dirty(dirty_blocks);
+      } else {
+        dirty_blocks(Impl::dual_view_all_dirty) = all_dirty;
+      }
+
+      // the part of the span covered by the entries range of the first
+      // dimension
+      const size_t end = std::min<size_t>(range.second, h_view.extent(0));
+      if (h_view.rank() == 0) {
+        dirty_blocks(Impl::dual_view_all_dirty) = 1;
+        return;
+      }
+      if (range.first >= end) return;
+      size_t first = range.first * h_view.stride(0);
+      size_t last  = (end - 1) * h_view.stride(0);
+      for (size_t r = 1; r < h_view.rank(); ++r) {
+        if (h_view.extent(r) == 0) return;
+        last += (h_view.extent(r) - 1) * h_view.stride(r);
+      }
+      Impl::dual_view_mark_dirty(dirty_blocks, dirty_offset + first,
+                                 dirty_offset + last + 1);
+    }
+  }
+
+  // the span changed, start over with a record of the new one
+  void impl_restart_dirty_tracking() {
+    if (dirty_blocks.data() != nullptr) {
+      enable_dirty_tracking(dirty_blocks(Impl::dual_view_dirty_block_size));
+    }
+  }
+
+ public:
+
   //@}
   //! \name Methods for reallocating or resizing the View objects.
   //@{
@@ -881,6 +1312,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
                     const size_t n6, const size_t n7,
                     const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop) {
     using alloc_prop_input = Impl::ViewCtorProp<ViewCtorArgs...>;
+    impl_wait_for_sync();
 
     static_assert(!alloc_prop_input::has_label,
                   "The view constructor arguments passed to Kokkos::realloc "
@@ -927,8 +1359,10 @@ class DualView : public ViewTraits<DataType, Properties...> {
     /* Reset dirty flags */
     if (modified_flags.data() == nullptr) {
       modified_flags = t_modified_flags("DualView::modified_flags");
+      pending_sync   = impl_create_pending_sync();
     } else
       modified_flags(1) = modified_flags(0) = 0;
+    impl_restart_dirty_tracking();
   }
 
   template <class... ViewCtorArgs>
@@ -978,6 +1412,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
                    const size_t n3, const size_t n4, const size_t n5,
                    const size_t n6, const size_t n7) {
     using alloc_prop_input = Impl::ViewCtorProp<ViewCtorArgs...>;
+    impl_wait_for_sync();
 
     static_assert(!alloc_prop_input::has_label,
                   "The view constructor arguments passed to Kokkos::resize "
@@ -997,6 +1432,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
     if (modified_flags.data() == nullptr) {
       modified_flags = t_modified_flags("DualView::modified_flags");
+      pending_sync   = impl_create_pending_sync();
     }
 
     [[maybe_unused]] auto resize_on_device = [&](const auto& properties) {
@@ -1010,6 +1446,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
         /* Mark Device copy as modified */
         ++modified_flags(1);
+        impl_restart_dirty_tracking();
       }
     };
 
@@ -1024,6 +1461,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
         /* Mark Host copy as modified */
         ++modified_flags(0);
+        impl_restart_dirty_tracking();
       }
     };
 
@@ -1040,6 +1478,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
         ::Kokkos::resize(arg_prop, h_view, n0, n1, n2, n3, n4, n5, n6, n7);
         d_view =
             create_mirror_view_and_copy(typename t_dev::memory_space(), h_view);
+        impl_restart_dirty_tracking();
       }
       return;
     } else if constexpr (alloc_prop_input::has_execution_space) {
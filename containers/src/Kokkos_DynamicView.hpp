@@ -227,7 +227,8 @@ struct ChunkedArrayManager {
 } /* end namespace Impl */
 
 /** \brief Dynamic views are restricted to rank-one and no layout.
- *         Resize only occurs on host outside of parallel_regions.
+ *         Resize only occurs on host outside of parallel_regions,
+ *         inside of them the view can only grow through grow_by.
  *         Subviews are not allowed.
  */
 template <typename DataType, typename... P>
@@ -265,6 +266,27 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
                          // to a chunk of extent == m_chunk_size entries
   unsigned m_chunk_size;  // 2 << (m_chunk_shift - 1)
 
+  // chunks can be allocated from host threads in parallel regions
+  static constexpr bool can_allocate_from_host =
+      device_accessor::template IsAccessibleFrom<host_space>::value;
+
+  // Publish a chunk allocated in a parallel region, see grow_by.
+  void allocate_chunk(uintptr_t ic) const {
+    uintptr_t* const slot = reinterpret_cast<uintptr_t*>(m_chunks + ic);
+    if (Kokkos::atomic_load(slot) == 0) {
+      const size_t bytes = sizeof(typename traits::value_type)
+                           << m_chunk_shift;
+      void* const ptr = device_space().allocate(bytes);
+      if (Kokkos::atomic_compare_exchange(slot, uintptr_t(0),
+                                          reinterpret_cast<uintptr_t>(ptr)) !=
+          0) {
+        device_space().deallocate(ptr, bytes);
+      }
+    }
+    Kokkos::atomic_max(reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max),
+                       ic + 1);
+  }
+
  public:
   //----------------------------------------------------------------------
 
@@ -446,6 +468,146 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
         "DynamicView::resize_serial: Fence after copying chunks to the device");
   }
 
+  /// Returned by grow_by and push_back when the view cannot grow any further.
+  static constexpr size_t invalid_index = ~size_t(0);
+
+  /** \brief  Append \c n entries from inside a parallel region.
+   *
+   *  Returns the index of the first new entry, or invalid_index if the view
+   *  is full.  Threads reserve disjoint ranges by an atomic update of the
+   *  extent.  Missing chunks are allocated on the fly when the memory space
+   *  can be allocated from where this runs (i.e. on the host for a host
+   *  accessible memory space), the first thread to publish a chunk wins and
+   *  the others free theirs.  Otherwise only the chunks allocated with
+   *  reserve beforehand are used.
+   *
+   *  size() is exact once the parallel region has completed; for memory
+   *  spaces that are not accessible from the host call sync_extent first.
+   */
+  KOKKOS_FUNCTION size_t grow_by(size_t n) const {
+    // The two slots after the chunk pointers count the allocated chunks and
+    // the extent, see ChunkedArrayManager::allocate_with_destroy.
+    uintptr_t* const counters =
+        reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max);
+
+    uintptr_t capacity = Kokkos::atomic_load(counters) << m_chunk_shift;
+    if constexpr (can_allocate_from_host) {
+      KOKKOS_IF_ON_HOST(
+          (capacity = uintptr_t(m_chunk_max) << m_chunk_shift;))
+    }
+
+    // A failed reservation is undone right away.  No reservation can succeed
+    // while the extent includes a failed one, so the successful ranges stay
+    // disjoint and contiguous.
+    const uintptr_t begin =
+        Kokkos::atomic_fetch_add(counters + 1, uintptr_t(n));
+    if (capacity < begin + n) {
+      Kokkos::atomic_sub(counters + 1, uintptr_t(n));
+      return invalid_index;
+    }
+
+    if constexpr (can_allocate_from_host) {
+      KOKKOS_IF_ON_HOST((if (n > 0) {
+        for (uintptr_t ic = begin >> m_chunk_shift;
+             ic <= ((begin + n - 1) >> m_chunk_shift); ++ic) {
+          allocate_chunk(ic);
+        }
+      }))
+    }
+    return begin;
+  }
+
+  /// Append \c value from inside a parallel region, see grow_by.
+  KOKKOS_FUNCTION size_t push_back(const value_type& value) const {
+    const size_t i = grow_by(1);
+    if (i != invalid_index) (*this)(i) = value;
+    return i;
+  }
+
+  /** \brief  Allocate the chunks needed to hold \c n entries without
+   *          changing the extent, so that grow_by can use them on the device.
+   */
+  template <typename IntType>
+  inline void reserve(IntType const& n) {
+    const uintptr_t NC = (n + m_chunk_mask) >> m_chunk_shift;
+    if (m_chunk_max < NC) {
+      Kokkos::abort("DynamicView::reserve exceeded maximum size");
+    }
+
+    typename device_space::execution_space exec{};
+    sync_extent(exec);
+
+    uintptr_t* const pc =
+        reinterpret_cast<uintptr_t*>(m_chunks_host + m_chunk_max);
+    std::string _label = m_chunks_host.track().template get_label<host_space>();
+    while (*pc < NC) {
+      m_chunks_host[*pc] = reinterpret_cast<pointer_type>(
+          device_space().allocate(_label.c_str(), sizeof(value_type)
+                                                      << m_chunk_shift));
+      ++*pc;
+    }
+
+    m_chunks_host.deep_copy_to(exec, m_chunks);
+    exec.fence(
+        "DynamicView::reserve: Fence after copying chunks to the device");
+  }
+
+  /** \brief  Update the extent seen by size() on the host after grow_by was
+   *          called on the device.  Returns the new size.
+   */
+  template <class ExecSpace>
+  size_t sync_extent(const ExecSpace& exec) const {
+    if constexpr (!device_accessor::template IsAccessibleFrom<
+                      host_space>::value) {
+      // the device owns the counters, the chunk pointers are the same
+      Kokkos::deep_copy(
+          exec,
+          Kokkos::View<uintptr_t*, host_space>(
+              reinterpret_cast<uintptr_t*>(m_chunks_host + m_chunk_max), 2),
+          Kokkos::View<uintptr_t*, device_space>(
+              reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max), 2));
+      exec.fence("DynamicView::sync_extent: Fence after copying the extent");
+    } else {
+      (void)exec;
+    }
+    return size();
+  }
+
+  size_t sync_extent() const {
+    return sync_extent(typename device_space::execution_space{});
+  }
+
+  /** \brief  Copy the entries into a contiguous View, e.g. at the end of a
+   *          phase of appends, so that bulk algorithms avoid the chunk
+   *          indirection.
+   */
+  template <class ExecSpace>
+  Kokkos::View<typename traits::non_const_value_type*,
+               typename traits::device_type>
+  flatten(const ExecSpace& exec) const {
+    const size_t n = size();
+    Kokkos::View<typename traits::non_const_value_type*,
+                 typename traits::device_type>
+        flat(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                                std::string(label()).append("_flat")),
+             n);
+    const DynamicView self = *this;
+    Kokkos::parallel_for(
+        "Kokkos::DynamicView::flatten",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(size_t i) { flat(i) = self(i); });
+    return flat;
+  }
+
+  Kokkos::View<typename traits::non_const_value_type*,
+               typename traits::device_type>
+  flatten() const {
+    typename device_space::execution_space exec{};
+    auto flat = flatten(exec);
+    exec.fence("DynamicView::flatten: Fence after copying the entries");
+    return flat;
+  }
+
   KOKKOS_INLINE_FUNCTION bool is_allocated() const {
     if (m_chunks_host.valid()) {
       // *m_chunks_host[m_chunk_max] stores the current number of chunks being
@@ -0,0 +1,427 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_OrderedMap.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::OrderedMap.
+
+#ifndef KOKKOS_ORDERED_MAP_HPP
+#define KOKKOS_ORDERED_MAP_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_ORDEREDMAP
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include <impl/Kokkos_OrderedMap_impl.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class OrderedMap
+/// \brief Map whose keys are kept sorted, for point and range queries.
+///
+/// The entries are stored in two sorted arrays of keys and values: the main
+/// array and a much smaller array of pending entries (a two-level
+/// log-structured merge tree).  Batches of new keys are sorted and merged
+/// into the pending array only, so that inserting does not rewrite the whole
+/// map.  Once the pending array holds more than 1/\c merge_ratio of the
+/// entries, or when merge() is called, it is merged into the main array.
+/// A key is never in both arrays, so a query searches each of them once.
+///
+/// Entries are identified by an index, which is below size() for valid
+/// entries.  The indices of the main array come first, those of the pending
+/// entries after them.  Any insert() or merge() invalidates the indices.
+///
+/// Keys and values are added in batches from the host with build() and
+/// insert().  In a parallel kernel the map can be searched with find(),
+/// count() and for_each(), and values can be changed with value_at().
+/// Keys are compared with \c operator<.
+///
+/// \tparam Key Type of the keys.  Must be trivially copyable.
+///
+/// \tparam Value Type of the values.  Must be trivially copyable.
+///
+/// \tparam Device The Kokkos Device type.
+template <typename Key, typename Value,
+          typename Device = Kokkos::DefaultExecutionSpace>
+class OrderedMap {
+  static_assert(!std::is_const_v<Key> && !std::is_const_v<Value> &&
+                    !std::is_void_v<Value>,
+                "OrderedMap: key and value types must not be const or void");
+
+ public:
+  //! \name Public types and constants
+  //@{
+  using key_type        = Key;
+  using value_type      = Value;
+  using device_type     = Device;
+  using execution_space = typename Device::execution_space;
+  using memory_space    = typename Device::memory_space;
+  using size_type       = uint32_t;
+
+  using keys_view   = View<key_type *, device_type>;
+  using values_view = View<value_type *, device_type>;
+
+  enum : size_type { invalid_index = ~static_cast<size_type>(0) };
+
+  //! Pending entries are merged once they are 1/merge_ratio of the map.
+  static constexpr size_type merge_ratio = 8;
+  //@}
+
+  //! Construct an empty map.
+  OrderedMap() = default;
+
+  //! Construct a map from the entries in \c keys and \c values.
+  template <typename ExecSpace, typename KeysView, typename ValuesView>
+  OrderedMap(ExecSpace const &exec, KeysView const &keys,
+             ValuesView const &values) {
+    build(exec, keys, values);
+  }
+
+  //! \name Host functions
+  //@{
+
+  /// \brief Replace the entries of the map with \c keys and \c values.
+  ///
+  /// Of keys that appear more than once, the last value is kept.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  template <typename ExecSpace, typename KeysView, typename ValuesView>
+  void build(ExecSpace const &exec, KeysView const &keys,
+             ValuesView const &values) {
+    auto batch = impl_sort_unique(exec, keys, values);
+    m_keys     = batch.first;
+    m_values   = batch.second;
+    m_pending_keys   = keys_view();
+    m_pending_values = values_view();
+  }
+
+  /// \brief Insert the entries in \c keys and \c values into the map.
+  ///
+  /// The values of keys already in the map are replaced.  Of keys that
+  /// appear more than once, the last value is kept.  The new keys are
+  /// merged into the pending entries, which are merged into the main array
+  /// when there are too many of them.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  template <typename ExecSpace, typename KeysView, typename ValuesView>
+  void insert(ExecSpace const &exec, KeysView const &keys,
+              ValuesView const &values) {
+    if (keys.extent(0) == 0u) return;
+    auto batch = impl_sort_unique(exec, keys, values);
+
+    // update the keys that exist and collect the others
+    const keys_view batch_keys     = batch.first;
+    const values_view batch_values = batch.second;
+    keys_view new_keys(view_alloc(exec, WithoutInitializing,
+                                  "Kokkos::Experimental::OrderedMap::keys"),
+                       batch_keys.extent(0));
+    values_view new_values(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::Experimental::OrderedMap::values"),
+        batch_keys.extent(0));
+    const OrderedMap map = *this;
+    size_type num_new    = 0;
+    parallel_scan(
+        "Kokkos::Experimental::OrderedMap::insert",
+        RangePolicy<ExecSpace>(exec, 0, batch_keys.extent(0)),
+        KOKKOS_LAMBDA(size_type i, size_type & offset, bool final) {
+          const size_type index = map.find(batch_keys(i));
+          if (index != invalid_index) {
+            if (final) map.value_at(index) = batch_values(i);
+            return;
+          }
+          if (final) {
+            new_keys(offset)   = batch_keys(i);
+            new_values(offset) = batch_values(i);
+          }
+          ++offset;
+        },
+        num_new);
+    if (num_new == 0u) return;
+
+    using run_type  = Kokkos::Impl::OrderedMapRun<keys_view, values_view>;
+    const auto size = num_pending() + num_new;
+    keys_view merged_keys(view_alloc(exec, WithoutInitializing,
+                                     "Kokkos::Experimental::OrderedMap::keys"),
+                          size);
+    values_view merged_values(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::Experimental::OrderedMap::values"),
+        size);
+    Kokkos::Impl::OrderedMapMerge<run_type, run_type, ExecSpace>::apply(
+        exec, run_type{m_pending_keys, m_pending_values, 0, num_pending()},
+        run_type{new_keys, new_values, 0, num_new},
+        run_type{merged_keys, merged_values, 0, size});
+    m_pending_keys   = merged_keys;
+    m_pending_values = merged_values;
+
+    if (uint64_t(num_pending()) * merge_ratio > m_keys.extent(0)) merge(exec);
+  }
+
+  /// \brief Merge the pending entries into the main array.
+  ///
+  /// The merge is enqueued on \c exec and the function returns without
+  /// waiting for it, so it can run on an execution space instance of its
+  /// own while the host goes on.  Kernels that use the map afterwards have
+  /// to be ordered after it.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  template <typename ExecSpace>
+  void merge(ExecSpace const &exec) {
+    if (num_pending() == 0u) return;
+
+    using run_type = Kokkos::Impl::OrderedMapRun<keys_view, values_view>;
+    keys_view merged_keys(view_alloc(exec, WithoutInitializing,
+                                     "Kokkos::Experimental::OrderedMap::keys"),
+                          size());
+    values_view merged_values(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::Experimental::OrderedMap::values"),
+        size());
+    Kokkos::Impl::OrderedMapMerge<run_type, run_type, ExecSpace>::apply(
+        exec, run_type{m_keys, m_values, 0, size_type(m_keys.extent(0))},
+        run_type{m_pending_keys, m_pending_values, 0, num_pending()},
+        run_type{merged_keys, merged_values, 0, size()});
+    m_keys           = merged_keys;
+    m_values         = merged_values;
+    m_pending_keys   = keys_view();
+    m_pending_values = values_view();
+  }
+
+  /// \brief Find all the keys in \c keys and write the results of find()
+  ///   to \c indices.
+  template <typename ExecSpace, typename KeysView, typename IndicesView>
+  void find_batch(ExecSpace const &exec, KeysView const &keys,
+                  IndicesView const &indices) const {
+    KOKKOS_EXPECTS(indices.extent(0) >= keys.extent(0));
+    const OrderedMap map = *this;
+    parallel_for(
+        "Kokkos::Experimental::OrderedMap::find_batch",
+        RangePolicy<ExecSpace>(exec, 0, keys.extent(0)),
+        KOKKOS_LAMBDA(size_type i) { indices(i) = map.find(keys(i)); });
+  }
+
+  /// \brief Count the keys in every range [lower(i), upper(i)).
+  template <typename ExecSpace, typename BoundsView, typename CountsView>
+  void count_batch(ExecSpace const &exec, BoundsView const &lower,
+                   BoundsView const &upper, CountsView const &counts) const {
+    KOKKOS_EXPECTS(upper.extent(0) == lower.extent(0) &&
+                   counts.extent(0) >= lower.extent(0));
+    const OrderedMap map = *this;
+    parallel_for(
+        "Kokkos::Experimental::OrderedMap::count_batch",
+        RangePolicy<ExecSpace>(exec, 0, lower.extent(0)),
+        KOKKOS_LAMBDA(size_type i) {
+          counts(i) = map.count(lower(i), upper(i));
+        });
+  }
+
+  /// \brief Find the keys in every range [lower(i), upper(i)).
+  ///
+  /// The indices of the keys in range \c i are written in key order to
+  /// indices(offsets(i)) up to indices(offsets(i + 1)).  \c offsets must
+  /// have one more entry than there are ranges; \c indices is reallocated
+  /// if it cannot hold all the results.
+  template <typename ExecSpace, typename BoundsView, typename OffsetsView,
+            typename IndicesView>
+  void find_ranges(ExecSpace const &exec, BoundsView const &lower,
+                   BoundsView const &upper, OffsetsView const &offsets,
+                   IndicesView &indices) const {
+    const size_type num_ranges = lower.extent(0);
+    KOKKOS_EXPECTS(upper.extent(0) == num_ranges &&
+                   offsets.extent(0) == num_ranges + 1);
+    const OrderedMap map = *this;
+    size_type total      = 0;
+    parallel_scan(
+        "Kokkos::Experimental::OrderedMap::find_ranges::count",
+        RangePolicy<ExecSpace>(exec, 0, num_ranges + 1),
+        KOKKOS_LAMBDA(size_type i, size_type & offset, bool final) {
+          if (final) offsets(i) = offset;
+          if (i < num_ranges) offset += map.count(lower(i), upper(i));
+        },
+        total);
+    if (indices.extent(0) < total) {
+      Kokkos::realloc(view_alloc(exec, WithoutInitializing), indices, total);
+    }
+    const IndicesView result = indices;
+    parallel_for(
+        "Kokkos::Experimental::OrderedMap::find_ranges::fill",
+        RangePolicy<ExecSpace>(exec, 0, num_ranges),
+        KOKKOS_LAMBDA(size_type i) {
+          size_type out = offsets(i);
+          map.for_each(lower(i), upper(i),
+                       [&](size_type index) { result(out++) = index; });
+        });
+  }
+
+  //@}
+  //! \name Device functions
+  //@{
+
+  //! The number of entries in the map.
+  KOKKOS_INLINE_FUNCTION
+  size_type size() const { return m_keys.extent(0) + num_pending(); }
+
+  //! The number of entries not yet merged into the main array.
+  KOKKOS_INLINE_FUNCTION
+  size_type num_pending() const { return m_pending_keys.extent(0); }
+
+  /// \brief Find the key \c k.
+  ///
+  /// \return The index of the entry of the key if it exists in the map;
+  ///   otherwise, an invalid index.
+  KOKKOS_INLINE_FUNCTION
+  size_type find(key_type const &k) const {
+    const size_type num_keys = m_keys.extent(0);
+    size_type i = Kokkos::Impl::ordered_map_lower_bound(m_keys, 0, num_keys, k);
+    if (i < num_keys && !(k < m_keys(i))) return i;
+    i = Kokkos::Impl::ordered_map_lower_bound(m_pending_keys, 0, num_pending(),
+                                              k);
+    if (i < num_pending() && !(k < m_pending_keys(i))) return num_keys + i;
+    return invalid_index;
+  }
+
+  //! Does the key \c k exist in the map.
+  KOKKOS_INLINE_FUNCTION
+  bool exists(key_type const &k) const { return valid_at(find(k)); }
+
+  //! Is \c i the index of an entry.
+  KOKKOS_INLINE_FUNCTION
+  bool valid_at(size_type i) const { return i < size(); }
+
+  //! Get the key of the entry with index \c i.
+  KOKKOS_INLINE_FUNCTION
+  key_type key_at(size_type i) const {
+    KOKKOS_EXPECTS(valid_at(i));
+    const size_type num_keys = m_keys.extent(0);
+    return i < num_keys ? m_keys(i) : m_pending_keys(i - num_keys);
+  }
+
+  //! Get the value of the entry with index \c i.
+  KOKKOS_INLINE_FUNCTION
+  value_type &value_at(size_type i) const {
+    KOKKOS_EXPECTS(valid_at(i));
+    const size_type num_keys = m_keys.extent(0);
+    return i < num_keys ? m_values(i) : m_pending_values(i - num_keys);
+  }
+
+  //! Count the keys in [lower, upper), which is empty unless lower < upper.
+  KOKKOS_INLINE_FUNCTION
+  size_type count(key_type const &lower, key_type const &upper) const {
+    using Kokkos::Impl::ordered_map_lower_bound;
+    if (!(lower < upper)) return 0;
+    const size_type num_keys = m_keys.extent(0);
+    return (ordered_map_lower_bound(m_keys, 0, num_keys, upper) -
+            ordered_map_lower_bound(m_keys, 0, num_keys, lower)) +
+           (ordered_map_lower_bound(m_pending_keys, 0, num_pending(), upper) -
+            ordered_map_lower_bound(m_pending_keys, 0, num_pending(), lower));
+  }
+
+  /// \brief Call \c f with the index of every key in [lower, upper), in
+  ///   increasing order of the keys.
+  template <typename Functor>
+  KOKKOS_INLINE_FUNCTION void for_each(key_type const &lower,
+                                       key_type const &upper,
+                                       Functor const &f) const {
+    using Kokkos::Impl::ordered_map_lower_bound;
+    const size_type num_keys = m_keys.extent(0);
+    size_type i = ordered_map_lower_bound(m_keys, 0, num_keys, lower);
+    size_type j =
+        ordered_map_lower_bound(m_pending_keys, 0, num_pending(), lower);
+    const bool has_i = i < num_keys && m_keys(i) < upper;
+    const bool has_j = j < num_pending() && m_pending_keys(j) < upper;
+    for (bool more_i = has_i, more_j = has_j; more_i || more_j;) {
+      if (more_i && (!more_j || m_keys(i) < m_pending_keys(j))) {
+        f(i);
+        more_i = ++i < num_keys && m_keys(i) < upper;
+      } else {
+        f(num_keys + j);
+        more_j = ++j < num_pending() && m_pending_keys(j) < upper;
+      }
+    }
+  }
+
+  //@}
+
+  // Copy the entries to new arrays, sort them and keep the last value of
+  // every key.  Public only because nvcc does not allow device lambdas in
+  // private member functions.
+  template <typename ExecSpace, typename KeysView, typename ValuesView>
+  static std::pair<keys_view, values_view> impl_sort_unique(
+      ExecSpace const &exec, KeysView const &keys, ValuesView const &values) {
+    static_assert(Kokkos::is_execution_space_v<ExecSpace>,
+                  "OrderedMap: exec must be an execution space instance");
+    static_assert(
+        SpaceAccessibility<ExecSpace, memory_space>::accessible,
+        "OrderedMap: the map must be accessible from the execution space");
+    KOKKOS_EXPECTS(values.extent(0) >= keys.extent(0));
+
+    const size_type n = keys.extent(0);
+    keys_view sorted_keys(view_alloc(exec, WithoutInitializing,
+                                     "Kokkos::Experimental::OrderedMap::keys"),
+                          n);
+    values_view sorted_values(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::Experimental::OrderedMap::values"),
+        n);
+    parallel_for(
+        "Kokkos::Experimental::OrderedMap::copy",
+        RangePolicy<ExecSpace>(exec, 0, n), KOKKOS_LAMBDA(size_type i) {
+          sorted_keys(i)   = keys(i);
+          sorted_values(i) = values(i);
+        });
+    Kokkos::Impl::OrderedMapSort<keys_view, values_view, ExecSpace>::apply(
+        exec, sorted_keys, sorted_values);
+
+    keys_view unique_keys(view_alloc(exec, WithoutInitializing,
+                                     "Kokkos::Experimental::OrderedMap::keys"),
+                          n);
+    values_view unique_values(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::Experimental::OrderedMap::values"),
+        n);
+    const size_type num_unique =
+        Kokkos::Impl::OrderedMapUnique<keys_view, values_view, ExecSpace>::
+            apply(exec, sorted_keys, sorted_values, unique_keys,
+                  unique_values);
+    const Kokkos::pair<size_type, size_type> range(0, num_unique);
+    return {Kokkos::subview(unique_keys, range),
+            Kokkos::subview(unique_values, range)};
+  }
+
+ private:
+  keys_view m_keys;
+  values_view m_values;
+  keys_view m_pending_keys;
+  values_view m_pending_values;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_ORDEREDMAP
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_ORDEREDMAP
+#endif
+#endif  // KOKKOS_ORDERED_MAP_HPP
@@ -28,6 +28,10 @@
 #endif
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_BitManipulation.hpp>
+
+#include <algorithm>
+#include <climits>
 #include <utility>
 
 namespace Kokkos {
@@ -45,10 +49,29 @@ struct ScatterMin {};
 
 struct ScatterNonDuplicated {};
 struct ScatterDuplicated {};
+struct ScatterSparseDuplicated {};
 
 struct ScatterNonAtomic {};
 struct ScatterAtomic {};
 
+/*
+ * Tuning parameters of a ScatterView with ScatterSparseDuplicated.
+ *  - The target is split into blocks of block_size consecutive values (a
+ *    power of two), which are duplicated for a thread on demand.
+ *  - The private blocks of all threads together hold at most max_copies
+ *    copies of the target; once they are used up, the threads contribute to
+ *    the blocks they have not duplicated yet with atomics.
+ *  - A thread contributes atomic_threshold times to a block with atomics
+ *    before it gets a private copy of it (hybrid mode), so that blocks a
+ *    thread rarely touches are not duplicated.  With 0 a block is
+ *    duplicated on the first contribution.
+ */
+struct ScatterSparseConfig {
+  std::size_t block_size = 1024;
+  double max_copies      = 2.0;
+  int atomic_threshold   = 0;
+};
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -62,6 +85,13 @@ struct DefaultDuplication;
 template <typename ExecSpace, typename Duplication>
 struct DefaultContribution;
 
+// contributions to the blocks that are not duplicated need atomics
+template <typename ExecSpace>
+struct DefaultContribution<ExecSpace,
+                           Kokkos::Experimental::ScatterSparseDuplicated> {
+  using type = Kokkos::Experimental::ScatterAtomic;
+};
+
 #ifdef KOKKOS_ENABLE_SERIAL
 template <>
 struct DefaultDuplication<Kokkos::Serial> {
@@ -199,6 +229,45 @@ struct DefaultContribution<Kokkos::SYCL,
 };
 #endif
 
+/* ScatterComponents describes value types made of several values of an
+   arithmetic type.  ScatterSum updates these component by component, so that
+   ScatterAtomic uses a lock-free atomic per component instead of the lock
+   array for the whole value. */
+template <typename ValueType>
+struct ScatterComponents {
+  static constexpr bool is_compound = false;
+};
+
+template <typename T>
+struct ScatterComponents<Kokkos::complex<T>> {
+  using component_type               = T;
+  static constexpr bool is_compound = true;
+  static constexpr int size         = 2;
+  KOKKOS_FORCEINLINE_FUNCTION static T& get(Kokkos::complex<T>& value,
+                                            int i) {
+    return i == 0 ? value.real() : value.imag();
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static T get(Kokkos::complex<T> const& value,
+                                           int i) {
+    return i == 0 ? value.real() : value.imag();
+  }
+};
+
+template <typename T, size_t N>
+struct ScatterComponents<Kokkos::Array<T, N>> {
+  using component_type               = T;
+  static constexpr bool is_compound = true;
+  static constexpr int size         = N;
+  KOKKOS_FORCEINLINE_FUNCTION static T& get(Kokkos::Array<T, N>& value,
+                                            int i) {
+    return value[i];
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static T get(Kokkos::Array<T, N> const& value,
+                                           int i) {
+    return value[i];
+  }
+};
+
 // FIXME All these scatter values need overhaul:
 //   - like should they be copyable at all?
 //   - what is the internal handle type
@@ -235,10 +304,28 @@ struct ScatterValue<ValueType, Kokkos::Experimental::ScatterSum, DeviceType,
   KOKKOS_FORCEINLINE_FUNCTION void operator--() { update(ValueType(-1)); }
   KOKKOS_FORCEINLINE_FUNCTION void operator--(int) { update(ValueType(-1)); }
   KOKKOS_FORCEINLINE_FUNCTION void update(ValueType const& rhs) {
-    value += rhs;
+    using components = ScatterComponents<ValueType>;
+    if constexpr (components::is_compound) {
+      for (int i = 0; i < components::size; ++i) {
+        components::get(value, i) += components::get(rhs, i);
+      }
+    } else {
+      value += rhs;
+    }
   }
-  KOKKOS_FORCEINLINE_FUNCTION void reset() {
-    value = reduction_identity<ValueType>::sum();
+  KOKKOS_FORCEINLINE_FUNCTION void reset() { reset_sum(value); }
+
+  template <typename T>
+  KOKKOS_FORCEINLINE_FUNCTION static void reset_sum(T& value) {
+    using components = ScatterComponents<T>;
+    if constexpr (components::is_compound) {
+      for (int i = 0; i < components::size; ++i) {
+        components::get(value, i) =
+            reduction_identity<typename components::component_type>::sum();
+      }
+    } else {
+      value = reduction_identity<T>::sum();
+    }
   }
 };
 
@@ -273,7 +360,14 @@ struct ScatterValue<ValueType, Kokkos::Experimental::ScatterSum, DeviceType,
 
   KOKKOS_INLINE_FUNCTION
   void join(ValueType& dest, const ValueType& src) const {
-    Kokkos::atomic_add(&dest, src);
+    using components = ScatterComponents<ValueType>;
+    if constexpr (components::is_compound) {
+      for (int i = 0; i < components::size; ++i) {
+        Kokkos::atomic_add(&components::get(dest, i), components::get(src, i));
+      }
+    } else {
+      Kokkos::atomic_add(&dest, src);
+    }
   }
 
   KOKKOS_FORCEINLINE_FUNCTION void update(ValueType const& rhs) {
@@ -281,7 +375,8 @@ struct ScatterValue<ValueType, Kokkos::Experimental::ScatterSum, DeviceType,
   }
 
   KOKKOS_FORCEINLINE_FUNCTION void reset() {
-    value = reduction_identity<ValueType>::sum();
+    ScatterValue<ValueType, Kokkos::Experimental::ScatterSum, DeviceType,
+                 Kokkos::Experimental::ScatterNonAtomic>::reset_sum(value);
   }
 };
 
@@ -461,6 +556,135 @@ struct ScatterValue<ValueType, Kokkos::Experimental::ScatterMax, DeviceType,
   }
 };
 
+/* ScatterValue <Op, Contribution=ScatterNonAtomic> for a user-defined Op.
+   Such an op is a reducer-like policy with the static member functions
+     join(ValueType& dest, ValueType const& src), combining src into dest,
+     init(ValueType& value), setting value to the identity of join,
+   and optionally
+     atomic_join(ValueType& dest, ValueType const& src), doing the same as join
+     atomically, e.g. with a lock-free atomic per component of the value.
+   The values are updated with update(rhs). */
+template <typename ValueType, typename Op, typename DeviceType>
+struct ScatterValue<ValueType, Op, DeviceType,
+                    Kokkos::Experimental::ScatterNonAtomic> {
+  ValueType& value;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION ScatterValue(ValueType& value_in)
+      : value(value_in) {}
+  KOKKOS_FORCEINLINE_FUNCTION ScatterValue(ScatterValue&& other)
+      : value(other.value) {}
+  KOKKOS_FORCEINLINE_FUNCTION void update(ValueType const& rhs) {
+    Op::join(value, rhs);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void reset() { Op::init(value); }
+};
+
+template <typename Op, typename ValueType, typename = void>
+struct ScatterOpHasAtomicJoin : std::false_type {};
+
+template <typename Op, typename ValueType>
+struct ScatterOpHasAtomicJoin<
+    Op, ValueType,
+    std::void_t<decltype(Op::atomic_join(std::declval<ValueType&>(),
+                                         std::declval<ValueType const&>()))>>
+    : std::true_type {};
+
+/* ScatterValue <Op, Contribution=ScatterAtomic> for a user-defined Op uses
+   the atomic_join of the op if it has one.  Otherwise values of 4 or 8 bytes
+   are updated with a lock-free compare-and-swap loop over their bits. */
+template <typename ValueType, typename Op, typename DeviceType>
+struct ScatterValue<ValueType, Op, DeviceType,
+                    Kokkos::Experimental::ScatterAtomic> {
+  ValueType& value;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION ScatterValue(ValueType& value_in)
+      : value(value_in) {}
+  KOKKOS_FORCEINLINE_FUNCTION ScatterValue(ScatterValue&& other)
+      : value(other.value) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void join(ValueType& dest, const ValueType& src) const {
+    if constexpr (ScatterOpHasAtomicJoin<Op, ValueType>::value) {
+      Op::atomic_join(dest, src);
+    } else {
+      static_assert(
+          (sizeof(ValueType) == 4 || sizeof(ValueType) == 8) &&
+              alignof(ValueType) == sizeof(ValueType) &&
+              std::is_trivially_copyable_v<ValueType>,
+          "ScatterAtomic with a user-defined op needs an atomic_join in the "
+          "op unless the values are trivially copyable and have a size and "
+          "alignment of 4 or 8 bytes");
+      using bits_type = std::conditional_t<sizeof(ValueType) == 4,
+                                           unsigned int, unsigned long long>;
+      bits_type* const bits = reinterpret_cast<bits_type*>(&dest);
+      bits_type expected    = Kokkos::atomic_load(bits);
+      while (true) {
+        ValueType desired = Kokkos::bit_cast<ValueType>(expected);
+        Op::join(desired, src);
+        const bits_type old = Kokkos::atomic_compare_exchange(
+            bits, expected, Kokkos::bit_cast<bits_type>(desired));
+        if (old == expected) return;
+        expected = old;
+      }
+    }
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void update(ValueType const& rhs) {
+    this->join(value, rhs);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void reset() { Op::init(value); }
+};
+
+/* ScatterSparseValue is the object returned by the access operator() of
+   ScatterAccess for ScatterSparseDuplicated.  It refers either to the private
+   copy of the value of the calling thread, which is updated without atomics,
+   or to the shared target, which is updated according to Contribution. */
+template <typename ValueType, typename Op, typename DeviceType,
+          typename Contribution>
+struct ScatterSparseValue {
+  using private_value_type =
+      ScatterValue<ValueType, Op, DeviceType,
+                   Kokkos::Experimental::ScatterNonAtomic>;
+  using shared_value_type =
+      ScatterValue<ValueType, Op, DeviceType, Contribution>;
+
+  ValueType& value;
+  bool is_shared;
+
+  KOKKOS_FORCEINLINE_FUNCTION ScatterSparseValue(ValueType& value_in,
+                                                 bool is_shared_in)
+      : value(value_in), is_shared(is_shared_in) {}
+  KOKKOS_FORCEINLINE_FUNCTION void operator+=(ValueType const& rhs) {
+    is_shared ? shared_value_type(value) += rhs
+              : private_value_type(value) += rhs;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator-=(ValueType const& rhs) {
+    is_shared ? shared_value_type(value) -= rhs
+              : private_value_type(value) -= rhs;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator*=(ValueType const& rhs) {
+    is_shared ? shared_value_type(value) *= rhs
+              : private_value_type(value) *= rhs;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator/=(ValueType const& rhs) {
+    is_shared ? shared_value_type(value) /= rhs
+              : private_value_type(value) /= rhs;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void operator++() { *this += ValueType(1); }
+  KOKKOS_FORCEINLINE_FUNCTION void operator++(int) { *this += ValueType(1); }
+  KOKKOS_FORCEINLINE_FUNCTION void operator--() { *this -= ValueType(1); }
+  KOKKOS_FORCEINLINE_FUNCTION void operator--(int) { *this -= ValueType(1); }
+  KOKKOS_FORCEINLINE_FUNCTION void update(ValueType const& rhs) {
+    is_shared ? shared_value_type(value).update(rhs)
+              : private_value_type(value).update(rhs);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void reset() {
+    private_value_type(value).reset();
+  }
+};
+
 /* DuplicatedDataType, given a View DataType, will create a new DataType
    that has a new runtime dimension which becomes the largest-stride dimension.
    In the case of LayoutLeft, due to the limitation induced by the design of
@@ -659,6 +883,253 @@ struct ResetDuplicates : public ResetDuplicatesBase<ExecSpace, ValueType, Op> {
   }
 };
 
+/* ScatterRange -- The offsets within one copy of the target that belong to a
+ * range of rows, i.e. of indices of the first dimension.  These are count runs
+ * of length consecutive offsets, the first run starting at begin and every
+ * following one period offsets after the previous one. */
+struct ScatterRange {
+  size_t begin;
+  size_t length;
+  size_t period;
+  size_t count;
+
+  KOKKOS_FORCEINLINE_FUNCTION size_t size() const { return length * count; }
+
+  KOKKOS_FORCEINLINE_FUNCTION size_t offset(size_t j) const {
+    return (j / length) * period + begin + j % length;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION bool contains(size_t i) const {
+    if (i < begin) return false;
+    const size_t d = i - begin;
+    return d / period < count && d % period < length;
+  }
+};
+
+/* The offsets of rows [rows.first, rows.second) of the first dimension of
+ * view, which is a single copy of the target.  With LayoutRight every row is
+ * contiguous, with LayoutLeft its values are strided by the leading
+ * dimension. */
+template <typename V>
+ScatterRange scatter_rows_range(std::pair<size_t, size_t> rows,
+                                V const& view) {
+  using layout = typename V::array_layout;
+  static_assert(std::is_same_v<layout, Kokkos::LayoutLeft> ||
+                    std::is_same_v<layout, Kokkos::LayoutRight>,
+                "ScatterView can only contribute rows with LayoutLeft or "
+                "LayoutRight");
+  static_assert(V::rank > 0, "ScatterView can only contribute rows of views "
+                             "of rank > 0");
+  if (rows.first > rows.second || rows.second > view.extent(0)) {
+    Kokkos::abort("ScatterView: the rows to contribute are out of bounds");
+  }
+  if (rows.first == rows.second) return {0, 1, 1, 0};
+  if constexpr (std::is_same_v<layout, Kokkos::LayoutLeft>) {
+    const size_t stride = V::rank > 1 ? view.stride(1) : view.span();
+    return {rows.first, rows.second - rows.first, stride,
+            view.span() / stride};
+  } else {
+    const size_t stride = view.stride(0);
+    const size_t length = (rows.second - rows.first) * stride;
+    return {rows.first * stride, length, length, 1};
+  }
+}
+
+/* ContributeDuplicates -- Like ReduceDuplicates for the offsets in a
+ * ScatterRange.  With reset_in, every copy is reset right after it was read,
+ * which saves a second sweep over the duplicates. */
+template <typename ExecSpace, typename ValueType, typename Op>
+struct ContributeDuplicates {
+  using value_type = ScatterValue<ValueType, Op, ExecSpace,
+                                  Kokkos::Experimental::ScatterNonAtomic>;
+
+  ValueType* src;
+  ValueType* dst;
+  size_t stride;
+  size_t start;
+  size_t n;
+  ScatterRange range;
+  bool reset;
+
+  ContributeDuplicates(ExecSpace const& exec_space, ValueType* src_in,
+                       ValueType* dst_in, size_t stride_in, size_t start_in,
+                       size_t n_in, ScatterRange range_in, bool reset_in,
+                       std::string const& name)
+      : src(src_in),
+        dst(dst_in),
+        stride(stride_in),
+        start(start_in),
+        n(n_in),
+        range(range_in),
+        reset(reset_in) {
+    parallel_for(
+        std::string("Kokkos::ScatterView::ContributeDuplicates [") + name +
+            "]",
+        RangePolicy<ExecSpace, size_t>(exec_space, 0, range.size()), *this);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(size_t j) const {
+    const size_t i = range.offset(j);
+    for (size_t c = start; c < n; ++c) {
+      value_type(dst[i]).update(src[i + stride * c]);
+      if (reset) value_type(src[i + stride * c]).reset();
+    }
+  }
+};
+
+/* ContributeAndResetByDomain -- Contribute and reset the duplicates in two
+ * levels, for host execution spaces whose threads span several NUMA domains.
+ *
+ * The copy of thread t is first touched by thread t in ResetDuplicates, so it
+ * lives in the memory of the domain of t.  The first level reduces the copies
+ * of the threads of every domain into the first copy of the domain.  With a
+ * static schedule these are mostly read by threads of the same domain.  The
+ * second level then only reads one copy per domain instead of one per thread
+ * across the domains. */
+template <typename ExecSpace, typename ValueType, typename Op>
+struct ContributeAndResetByDomain {
+  struct LocalTag {};
+  struct GlobalTag {};
+
+  using value_type = ScatterValue<ValueType, Op, ExecSpace,
+                                  Kokkos::Experimental::ScatterNonAtomic>;
+
+  ValueType* src;
+  ValueType* dst;
+  size_t stride;
+  size_t start;
+  size_t n;
+  size_t group;
+  size_t domains;
+  size_t size;
+
+  ContributeAndResetByDomain(ExecSpace const& exec_space, ValueType* src_in,
+                             ValueType* dst_in, size_t stride_in,
+                             size_t start_in, size_t n_in, size_t domains_in,
+                             std::string const& name)
+      : src(src_in),
+        dst(dst_in),
+        stride(stride_in),
+        start(start_in),
+        n(n_in),
+        group((n_in + domains_in - 1) / domains_in),
+        domains((n_in + group - 1) / group),
+        size(stride_in) {
+    parallel_for(
+        std::string("Kokkos::ScatterView::ContributeAndResetByDomain [") +
+            name + "]",
+        Kokkos::RangePolicy<ExecSpace, Schedule<Static>, IndexType<size_t>,
+                            LocalTag>(exec_space, 0, domains * size),
+        *this);
+    parallel_for(
+        std::string("Kokkos::ScatterView::ContributeAndResetByDomain [") +
+            name + "]",
+        Kokkos::RangePolicy<ExecSpace, Schedule<Static>, IndexType<size_t>,
+                            GlobalTag>(exec_space, 0, size),
+        *this);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(LocalTag, size_t j) const {
+    const size_t i      = j % size;
+    const size_t leader = (j / size) * group;
+    const size_t last   = leader + group < n ? leader + group : n;
+    for (size_t c = leader + 1; c < last; ++c) {
+      value_type(src[i + stride * leader]).update(src[i + stride * c]);
+      value_type(src[i + stride * c]).reset();
+    }
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(GlobalTag, size_t i) const {
+    for (size_t leader = 0; leader < n; leader += group) {
+      if (leader < start) continue;
+      value_type(dst[i]).update(src[i + stride * leader]);
+      value_type(src[i + stride * leader]).reset();
+    }
+  }
+};
+
+/* The number of NUMA domains the duplicates of a ScatterView with num_copies
+ * copies are reduced in by contribute_and_reset. */
+template <typename ExecSpace>
+size_t scatter_view_numa_domains(size_t num_copies) {
+  if constexpr (!Kokkos::SpaceAccessibility<
+                    Kokkos::HostSpace,
+                    typename ExecSpace::memory_space>::accessible) {
+    return 1;
+  } else {
+    const size_t domains =
+        Kokkos::hwloc::available() ? Kokkos::hwloc::get_available_numa_count()
+                                   : 1;
+    // with only a few copies per domain there is nothing to gain
+    return domains > 1 && num_copies >= 4 * domains ? domains : 1;
+  }
+}
+
+/* ReduceSparseDuplicates -- Reduce the private blocks of all threads, and
+ * the shared target unless it is the destination, into the offsets of the
+ * destination in a ScatterRange.  Every block of the destination is reduced by
+ * one thread, so no atomics are needed, and only the blocks the threads
+ * duplicated are read.  With reset_in, the shared target and the table of
+ * private blocks are reset in the same pass. */
+template <typename ExecSpace, typename ValueType, typename Op,
+          typename BlocksView>
+struct ReduceSparseDuplicates {
+  using value_type = ScatterValue<ValueType, Op, ExecSpace,
+                                  Kokkos::Experimental::ScatterNonAtomic>;
+
+  ValueType* shared;
+  ValueType const* pool;
+  ValueType* dst;
+  BlocksView blocks;
+  size_t block_size;
+  size_t span;
+  ScatterRange range;
+  bool reset;
+
+  ReduceSparseDuplicates(ExecSpace const& exec_space, ValueType* shared_in,
+                         ValueType const* pool_in, ValueType* dst_in,
+                         BlocksView const& blocks_in, size_t block_size_in,
+                         size_t span_in, ScatterRange range_in, bool reset_in,
+                         std::string const& name)
+      : shared(shared_in),
+        pool(pool_in),
+        dst(dst_in),
+        blocks(blocks_in),
+        block_size(block_size_in),
+        span(span_in),
+        range(range_in),
+        reset(reset_in) {
+    parallel_for(
+        std::string("Kokkos::ScatterView::ReduceSparseDuplicates [") + name +
+            "]",
+        RangePolicy<ExecSpace, size_t>(exec_space, 0, blocks.extent(0)),
+        *this);
+  }
+
+  KOKKOS_FUNCTION void operator()(size_t block) const {
+    const size_t begin = block * block_size;
+    const size_t end = begin + block_size < span ? begin + block_size : span;
+    if (shared != nullptr) {
+      for (size_t i = begin; i < end; ++i) {
+        if (!range.contains(i)) continue;
+        value_type(dst[i]).update(shared[i]);
+        if (reset) value_type(shared[i]).reset();
+      }
+    }
+    for (size_t t = 0; t < blocks.extent(1); ++t) {
+      if (blocks(block, t) < 0) {
+        if (reset) blocks(block, t) = -1;
+        continue;
+      }
+      ValueType const* src = pool + size_t(blocks(block, t)) * block_size;
+      for (size_t i = begin; i < end; ++i) {
+        if (range.contains(i)) value_type(dst[i]).update(src[i - begin]);
+      }
+      if (reset) blocks(block, t) = -1;
+    }
+  }
+};
+
 template <typename... P>
 void check_scatter_view_allocation_properties_argument(
     ViewCtorProp<P...> const&) {
@@ -801,6 +1272,56 @@ class ScatterView<DataType, Layout, DeviceType, Op, ScatterNonDuplicated,
         internal_view.label());
   }
 
+  // contribute only rows [rows.first, rows.second) of the first dimension
+  template <typename DT, typename... RP>
+  void contribute_into(View<DT, RP...> const& dest,
+                       std::pair<size_t, size_t> rows) const {
+    contribute_into(execution_space(), dest, rows);
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_into(execution_space const& exec_space,
+                       View<DT, RP...> const& dest,
+                       std::pair<size_t, size_t> rows) const {
+    using dest_type = View<DT, RP...>;
+    static_assert(std::is_same_v<typename dest_type::array_layout, Layout>,
+                  "ScatterView contribute destination has different layout");
+    static_assert(
+        Kokkos::SpaceAccessibility<
+            execution_space, typename dest_type::memory_space>::accessible,
+        "ScatterView contribute destination memory space not accessible");
+    if (dest.data() == internal_view.data()) return;
+    Kokkos::Impl::Experimental::ContributeDuplicates<execution_space,
+                                                     original_value_type, Op>(
+        exec_space, internal_view.data(), dest.data(), 0, 0, 1,
+        Kokkos::Impl::Experimental::scatter_rows_range(rows, internal_view),
+        false, internal_view.label());
+  }
+
+  // contribute_into(dest) followed by reset_except(dest) in a single pass
+  template <typename DT, typename... RP>
+  void contribute_and_reset(View<DT, RP...> const& dest) {
+    contribute_and_reset(execution_space(), dest);
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_and_reset(execution_space const& exec_space,
+                            View<DT, RP...> const& dest) {
+    using dest_type = View<DT, RP...>;
+    static_assert(std::is_same_v<typename dest_type::array_layout, Layout>,
+                  "ScatterView contribute destination has different layout");
+    static_assert(
+        Kokkos::SpaceAccessibility<
+            execution_space, typename dest_type::memory_space>::accessible,
+        "ScatterView contribute destination memory space not accessible");
+    if (dest.data() == internal_view.data()) return;
+    const size_t span = internal_view.span();
+    Kokkos::Impl::Experimental::ContributeDuplicates<execution_space,
+                                                     original_value_type, Op>(
+        exec_space, internal_view.data(), dest.data(), 0, 0, 1,
+        {0, span, span, 1}, true, internal_view.label());
+  }
+
   void reset(execution_space const& exec_space = execution_space()) {
     Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
                                                 original_value_type, Op>(
@@ -1086,6 +1607,56 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
         start, internal_view.extent(0), internal_view.label());
   }
 
+  // contribute only rows [rows.first, rows.second) of the first dimension
+  template <typename DT, typename... RP>
+  void contribute_into(View<DT, RP...> const& dest,
+                       std::pair<size_t, size_t> rows) const {
+    contribute_into(execution_space(), dest, rows);
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_into(execution_space const& exec_space,
+                       View<DT, RP...> const& dest,
+                       std::pair<size_t, size_t> rows) const {
+    check_destination<View<DT, RP...>>();
+    size_t start = dest.data() == internal_view.data() ? 1 : 0;
+    Kokkos::Impl::Experimental::ContributeDuplicates<execution_space,
+                                                     original_value_type, Op>(
+        exec_space, internal_view.data(), dest.data(),
+        internal_view.stride(0), start, internal_view.extent(0),
+        Kokkos::Impl::Experimental::scatter_rows_range(rows, subview()), false,
+        internal_view.label());
+  }
+
+  // contribute_into(dest) followed by reset_except(dest) in a single pass,
+  // which first reduces the copies within every NUMA domain
+  template <typename DT, typename... RP>
+  void contribute_and_reset(View<DT, RP...> const& dest) {
+    contribute_and_reset(execution_space(), dest);
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_and_reset(execution_space const& exec_space,
+                            View<DT, RP...> const& dest) {
+    check_destination<View<DT, RP...>>();
+    size_t start   = dest.data() == internal_view.data() ? 1 : 0;
+    size_t stride  = internal_view.stride(0);
+    size_t n       = internal_view.extent(0);
+    size_t domains = Kokkos::Impl::Experimental::scatter_view_numa_domains<
+        execution_space>(n);
+    if (domains > 1) {
+      Kokkos::Impl::Experimental::ContributeAndResetByDomain<
+          execution_space, original_value_type, Op>(
+          exec_space, internal_view.data(), dest.data(), stride, start, n,
+          domains, internal_view.label());
+    } else {
+      Kokkos::Impl::Experimental::ContributeDuplicates<
+          execution_space, original_value_type, Op>(
+          exec_space, internal_view.data(), dest.data(), stride, start, n,
+          {0, stride, stride, 1}, true, internal_view.label());
+    }
+  }
+
   void reset(execution_space const& exec_space = execution_space()) {
     Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
                                                 original_value_type, Op>(
@@ -1186,6 +1757,17 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
   }
 
  protected:
+  template <typename dest_type>
+  static void check_destination() {
+    static_assert(
+        std::is_same_v<typename dest_type::array_layout, Kokkos::LayoutRight>,
+        "ScatterView deep_copy destination has different layout");
+    static_assert(
+        Kokkos::SpaceAccessibility<
+            execution_space, typename dest_type::memory_space>::accessible,
+        "ScatterView deep_copy destination memory space not accessible");
+  }
+
   template <typename... Args>
   KOKKOS_FORCEINLINE_FUNCTION original_reference_type at(int rank,
                                                          Args... args) const {
@@ -1371,6 +1953,57 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
         internal_view.label());
   }
 
+  // contribute only rows [rows.first, rows.second) of the first dimension
+  template <typename... RP>
+  void contribute_into(View<RP...> const& dest,
+                       std::pair<size_t, size_t> rows) const {
+    contribute_into(execution_space(), dest, rows);
+  }
+
+  template <typename... RP>
+  void contribute_into(execution_space const& exec_space,
+                       View<RP...> const& dest,
+                       std::pair<size_t, size_t> rows) const {
+    check_destination<View<RP...>>();
+    size_t start = dest.data() == internal_view.data() ? 1 : 0;
+    Kokkos::Impl::Experimental::ContributeDuplicates<execution_space,
+                                                     original_value_type, Op>(
+        exec_space, internal_view.data(), dest.data(),
+        internal_view.stride(internal_view_type::rank - 1), start,
+        internal_view.extent(internal_view_type::rank - 1),
+        Kokkos::Impl::Experimental::scatter_rows_range(rows, subview()), false,
+        internal_view.label());
+  }
+
+  // contribute_into(dest) followed by reset_except(dest) in a single pass,
+  // which first reduces the copies within every NUMA domain
+  template <typename... RP>
+  void contribute_and_reset(View<RP...> const& dest) {
+    contribute_and_reset(execution_space(), dest);
+  }
+
+  template <typename... RP>
+  void contribute_and_reset(execution_space const& exec_space,
+                            View<RP...> const& dest) {
+    check_destination<View<RP...>>();
+    size_t start   = dest.data() == internal_view.data() ? 1 : 0;
+    size_t stride  = internal_view.stride(internal_view_type::rank - 1);
+    size_t n       = internal_view.extent(internal_view_type::rank - 1);
+    size_t domains = Kokkos::Impl::Experimental::scatter_view_numa_domains<
+        execution_space>(n);
+    if (domains > 1) {
+      Kokkos::Impl::Experimental::ContributeAndResetByDomain<
+          execution_space, original_value_type, Op>(
+          exec_space, internal_view.data(), dest.data(), stride, start, n,
+          domains, internal_view.label());
+    } else {
+      Kokkos::Impl::Experimental::ContributeDuplicates<
+          execution_space, original_value_type, Op>(
+          exec_space, internal_view.data(), dest.data(), stride, start, n,
+          {0, stride, stride, 1}, true, internal_view.label());
+    }
+  }
+
   void reset(execution_space const& exec_space = execution_space()) {
     Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
                                                 original_value_type, Op>(
@@ -1427,6 +2060,21 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
   }
 
  protected:
+  template <typename dest_type>
+  static void check_destination() {
+    static_assert(
+        std::is_same_v<typename dest_type::value_type,
+                       typename original_view_type::non_const_value_type>,
+        "ScatterView deep_copy destination has wrong value_type");
+    static_assert(
+        std::is_same_v<typename dest_type::array_layout, Kokkos::LayoutLeft>,
+        "ScatterView deep_copy destination has different layout");
+    static_assert(
+        Kokkos::SpaceAccessibility<
+            execution_space, typename dest_type::memory_space>::accessible,
+        "ScatterView deep_copy destination memory space not accessible");
+  }
+
   template <typename... Args>
   KOKKOS_FORCEINLINE_FUNCTION original_reference_type at(int thread_id,
                                                          Args... args) const {
@@ -1508,6 +2156,396 @@ class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterDuplicated,
   thread_id_type thread_id;
 };
 
+// sparsely duplicated implementation
+//
+// Instead of a full copy of the target for every thread, the target is split
+// into blocks and a thread gets a private copy of a block from a pool the
+// first time it contributes to it, or in hybrid mode after it contributed
+// to it atomic_threshold times.  Contributions to blocks without a private
+// copy go to the shared target, by default with atomics.  For every thread
+// and block a table records the private copy, or as a negative number how
+// often the thread contributed to the block so far, so that contribute_into()
+// only reads the blocks that were duplicated.
+template <typename DataType, typename Op, typename DeviceType, typename Layout,
+          typename Contribution>
+class ScatterView<DataType, Layout, DeviceType, Op, ScatterSparseDuplicated,
+                  Contribution> {
+ public:
+  using execution_space         = typename DeviceType::execution_space;
+  using memory_space            = typename DeviceType::memory_space;
+  using device_type             = Kokkos::Device<execution_space, memory_space>;
+  using original_view_type      = Kokkos::View<DataType, Layout, device_type>;
+  using original_value_type     = typename original_view_type::value_type;
+  using original_reference_type = typename original_view_type::reference_type;
+  friend class ScatterAccess<DataType, Op, DeviceType, Layout,
+                             ScatterSparseDuplicated, Contribution,
+                             ScatterNonAtomic>;
+  friend class ScatterAccess<DataType, Op, DeviceType, Layout,
+                             ScatterSparseDuplicated, Contribution,
+                             ScatterAtomic>;
+  template <class, class, class, class, class, class>
+  friend class ScatterView;
+
+  using internal_view_type = original_view_type;
+  using blocks_view_type   = Kokkos::View<int**, Kokkos::LayoutRight,
+                                        device_type>;
+  using pool_view_type =
+      Kokkos::View<typename original_view_type::non_const_value_type*,
+                   device_type>;
+
+  ScatterView() = default;
+
+  template <typename RT, typename... RP>
+  ScatterView(View<RT, RP...> const& original_view)
+      : ScatterView(execution_space(), original_view) {}
+
+  template <typename RT, typename... RP>
+  ScatterView(View<RT, RP...> const& original_view,
+              ScatterSparseConfig const& config)
+      : ScatterView(execution_space(), original_view, config) {}
+
+  template <typename RT, typename... RP>
+  ScatterView(execution_space const& exec_space,
+              View<RT, RP...> const& original_view,
+              ScatterSparseConfig const& config = ScatterSparseConfig())
+      : internal_view(original_view) {
+    allocate_blocks(exec_space, config);
+  }
+
+  template <typename... Dims>
+  ScatterView(std::string const& name, Dims... dims)
+      : ScatterView(view_alloc(execution_space(), name), dims...) {}
+
+  // This overload allows specifying an execution space instance to be
+  // used by passing, e.g., Kokkos::view_alloc(exec_space, "label") as
+  // first argument.
+  template <typename... P, typename... Dims>
+  ScatterView(::Kokkos::Impl::ViewCtorProp<P...> const& arg_prop, Dims... dims)
+      : internal_view(arg_prop, dims...) {
+    using ::Kokkos::Impl::Experimental::
+        check_scatter_view_allocation_properties_argument;
+    check_scatter_view_allocation_properties_argument(arg_prop);
+
+    auto const& exec_space =
+        Kokkos::Impl::get_property<Kokkos::Impl::ExecutionSpaceTag>(arg_prop);
+    allocate_blocks(exec_space, ScatterSparseConfig());
+  }
+
+  template <typename OtherDataType, typename OtherDeviceType>
+  KOKKOS_FUNCTION ScatterView(
+      const ScatterView<OtherDataType, Layout, OtherDeviceType, Op,
+                        ScatterSparseDuplicated, Contribution>& other_view)
+      : unique_token(other_view.unique_token),
+        internal_view(other_view.internal_view),
+        blocks(other_view.blocks),
+        pool(other_view.pool),
+        pool_next(other_view.pool_next),
+        block_shift(other_view.block_shift),
+        atomic_threshold(other_view.atomic_threshold) {}
+
+  template <typename OtherDataType, typename OtherDeviceType>
+  KOKKOS_FUNCTION ScatterView& operator=(
+      const ScatterView<OtherDataType, Layout, OtherDeviceType, Op,
+                        ScatterSparseDuplicated, Contribution>& other_view) {
+    unique_token     = other_view.unique_token;
+    internal_view    = other_view.internal_view;
+    blocks           = other_view.blocks;
+    pool             = other_view.pool;
+    pool_next        = other_view.pool_next;
+    block_shift      = other_view.block_shift;
+    atomic_threshold = other_view.atomic_threshold;
+    return *this;
+  }
+
+  template <typename OverrideContribution = Contribution>
+  KOKKOS_FORCEINLINE_FUNCTION
+      ScatterAccess<DataType, Op, DeviceType, Layout, ScatterSparseDuplicated,
+                    Contribution, OverrideContribution>
+      access() const {
+    return ScatterAccess<DataType, Op, DeviceType, Layout,
+                         ScatterSparseDuplicated, Contribution,
+                         OverrideContribution>(*this);
+  }
+
+  // the shared target, which holds the contributions to blocks that were
+  // not duplicated
+  original_view_type subview() const { return internal_view; }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool is_allocated() const {
+    return internal_view.is_allocated();
+  }
+
+  // the number of blocks duplicated since the last reset
+  size_t duplicated_blocks() const {
+    unsigned result = 0;
+    Kokkos::deep_copy(result, pool_next);
+    return result < pool_capacity() ? result : pool_capacity();
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_into(View<DT, RP...> const& dest) const {
+    contribute_into(execution_space(), dest);
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_into(execution_space const& exec_space,
+                       View<DT, RP...> const& dest) const {
+    check_destination<View<DT, RP...>>();
+    const size_t span = internal_view.span();
+    reduce_into(exec_space, dest.data(), {0, span, span, 1}, false);
+  }
+
+  // contribute only rows [rows.first, rows.second) of the first dimension
+  template <typename DT, typename... RP>
+  void contribute_into(View<DT, RP...> const& dest,
+                       std::pair<size_t, size_t> rows) const {
+    contribute_into(execution_space(), dest, rows);
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_into(execution_space const& exec_space,
+                       View<DT, RP...> const& dest,
+                       std::pair<size_t, size_t> rows) const {
+    check_destination<View<DT, RP...>>();
+    reduce_into(
+        exec_space, dest.data(),
+        Kokkos::Impl::Experimental::scatter_rows_range(rows, internal_view),
+        false);
+  }
+
+  // contribute_into(dest) followed by reset_except(dest) in a single pass
+  template <typename DT, typename... RP>
+  void contribute_and_reset(View<DT, RP...> const& dest) {
+    contribute_and_reset(execution_space(), dest);
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_and_reset(execution_space const& exec_space,
+                            View<DT, RP...> const& dest) {
+    check_destination<View<DT, RP...>>();
+    const size_t span = internal_view.span();
+    reduce_into(exec_space, dest.data(), {0, span, span, 1}, true);
+    Kokkos::deep_copy(exec_space, pool_next, 0u);
+  }
+
+  void reset(execution_space const& exec_space = execution_space()) {
+    Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
+                                                original_value_type, Op>(
+        exec_space, internal_view.data(), internal_view.span(),
+        internal_view.label());
+    release_blocks(exec_space);
+  }
+
+  template <typename DT, typename... RP>
+  void reset_except(View<DT, RP...> const& view) {
+    reset_except(execution_space(), view);
+  }
+
+  template <typename DT, typename... RP>
+  void reset_except(execution_space const& exec_space,
+                    View<DT, RP...> const& view) {
+    if (view.data() != internal_view.data()) {
+      reset(exec_space);
+      return;
+    }
+    release_blocks(exec_space);
+  }
+
+  void resize(const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+              const size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+              const size_t n2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+              const size_t n3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+              const size_t n4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+              const size_t n5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+              const size_t n6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+              const size_t n7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG) {
+    ::Kokkos::resize(internal_view, n0, n1, n2, n3, n4, n5, n6, n7);
+    allocate_blocks(execution_space(), current_config());
+  }
+
+  void realloc(const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+               const size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+               const size_t n2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+               const size_t n3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+               const size_t n4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+               const size_t n5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+               const size_t n6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+               const size_t n7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG) {
+    ::Kokkos::realloc(internal_view, n0, n1, n2, n3, n4, n5, n6, n7);
+    allocate_blocks(execution_space(), current_config());
+  }
+
+ protected:
+  using value_type = Kokkos::Impl::Experimental::ScatterSparseValue<
+      original_value_type, Op, DeviceType, Contribution>;
+
+  template <typename OverrideContribution, typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+      Kokkos::Impl::Experimental::ScatterSparseValue<
+          original_value_type, Op, DeviceType, OverrideContribution>
+      at(int thread_id, Args... args) const {
+    original_reference_type ref = internal_view(args...);
+    const size_t offset         = &ref - internal_view.data();
+    int& entry                  = blocks(offset >> block_shift, thread_id);
+    if (entry < 0 && entry != pool_exhausted) entry = duplicate(entry);
+    if (entry < 0) return {ref, true};
+    const size_t mask = (size_t(1) << block_shift) - 1;
+    return {pool((size_t(entry) << block_shift) + (offset & mask)), false};
+  }
+
+ private:
+  // the table entries of blocks without private copy once the pool is empty
+  static constexpr int pool_exhausted = -1 - INT_MAX;
+
+  // Count another contribution to the block with table entry \c entry or,
+  // once there were enough, take a private copy of it from the pool.
+  KOKKOS_FUNCTION int duplicate(int entry) const {
+    if (-1 - entry < atomic_threshold) return entry - 1;
+    const unsigned slot = Kokkos::atomic_fetch_add(&pool_next(), 1u);
+    if (slot >= pool.extent(0) >> block_shift) return pool_exhausted;
+    const size_t begin = size_t(slot) << block_shift;
+    for (size_t i = begin; i < begin + (size_t(1) << block_shift); ++i) {
+      Kokkos::Impl::Experimental::ScatterValue<original_value_type, Op,
+                                               DeviceType, ScatterNonAtomic>(
+          pool(i))
+          .reset();
+    }
+    return slot;
+  }
+
+  size_t pool_capacity() const { return pool.extent(0) >> block_shift; }
+
+  template <typename dest_type>
+  static void check_destination() {
+    static_assert(std::is_same_v<typename dest_type::array_layout, Layout>,
+                  "ScatterView contribute destination has different layout");
+    static_assert(
+        Kokkos::SpaceAccessibility<
+            execution_space, typename dest_type::memory_space>::accessible,
+        "ScatterView contribute destination memory space not accessible");
+  }
+
+  void reduce_into(execution_space const& exec_space,
+                   original_value_type* dest,
+                   Kokkos::Impl::Experimental::ScatterRange range,
+                   bool reset_in) const {
+    Kokkos::Impl::Experimental::ReduceSparseDuplicates<
+        execution_space, original_value_type, Op, blocks_view_type>(
+        exec_space,
+        dest == internal_view.data() ? nullptr : internal_view.data(),
+        pool.data(), dest, blocks, size_t(1) << block_shift,
+        internal_view.span(), range, reset_in, internal_view.label());
+  }
+
+  ScatterSparseConfig current_config() const {
+    ScatterSparseConfig config;
+    config.block_size       = size_t(1) << block_shift;
+    config.max_copies       = blocks.extent(0) == 0
+                                  ? 0.0
+                                  : double(pool_capacity()) / blocks.extent(0);
+    config.atomic_threshold = atomic_threshold;
+    return config;
+  }
+
+  void allocate_blocks(execution_space const& exec_space,
+                       ScatterSparseConfig const& config) {
+    if (config.block_size == 0 ||
+        (config.block_size & (config.block_size - 1)) != 0) {
+      Kokkos::abort(
+          "ScatterView: the block size of ScatterSparseDuplicated must be a "
+          "power of two");
+    }
+    block_shift = Kokkos::countr_zero(config.block_size);
+    atomic_threshold = config.atomic_threshold;
+
+    const size_t num_blocks =
+        (internal_view.span() + config.block_size - 1) >> block_shift;
+    const size_t max_blocks = num_blocks * unique_token.size();
+    const size_t pool_blocks =
+        std::min(max_blocks, size_t(config.max_copies * num_blocks + 0.5));
+    const std::string label = internal_view.label();
+    blocks = blocks_view_type(
+        view_alloc(exec_space, WithoutInitializing, "blocks_" + label),
+        num_blocks, unique_token.size());
+    pool = pool_view_type(
+        view_alloc(exec_space, WithoutInitializing, "duplicated_" + label),
+        pool_blocks << block_shift);
+    pool_next = Kokkos::View<unsigned, device_type>(
+        view_alloc(exec_space, WithoutInitializing, "pool_next_" + label));
+    release_blocks(exec_space);
+  }
+
+  void release_blocks(execution_space const& exec_space) {
+    Kokkos::deep_copy(exec_space, blocks, -1);
+    Kokkos::deep_copy(exec_space, pool_next, 0u);
+  }
+
+  using unique_token_type = Kokkos::Experimental::UniqueToken<
+      execution_space, Kokkos::Experimental::UniqueTokenScope::Global>;
+
+  unique_token_type unique_token;
+  internal_view_type internal_view;
+  blocks_view_type blocks;
+  pool_view_type pool;
+  Kokkos::View<unsigned, device_type> pool_next;
+  int block_shift      = 0;
+  int atomic_threshold = 0;
+};
+
+template <typename DataType, typename Op, typename DeviceType, typename Layout,
+          typename Contribution, typename OverrideContribution>
+class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterSparseDuplicated,
+                    Contribution, OverrideContribution> {
+ public:
+  using view_type           = ScatterView<DataType, Layout, DeviceType, Op,
+                                ScatterSparseDuplicated, Contribution>;
+  using original_value_type = typename view_type::original_value_type;
+  using value_type          = Kokkos::Impl::Experimental::ScatterSparseValue<
+      original_value_type, Op, DeviceType, OverrideContribution>;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ScatterAccess(view_type const& view_in)
+      : view(view_in), thread_id(view_in.unique_token.acquire()) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ~ScatterAccess() {
+    if (thread_id != ~thread_id_type(0)) view.unique_token.release(thread_id);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION value_type operator()(Args... args) const {
+    return view.template at<OverrideContribution>(thread_id, args...);
+  }
+
+  template <typename Arg>
+  KOKKOS_FORCEINLINE_FUNCTION std::enable_if_t<
+      std::is_integral_v<Arg> && view_type::original_view_type::rank == 1,
+      value_type>
+  operator[](Arg arg) const {
+    return view.template at<OverrideContribution>(thread_id, arg);
+  }
+
+ private:
+  view_type const& view;
+
+  // simplify RAII by disallowing copies
+  ScatterAccess(ScatterAccess const& other)            = delete;
+  ScatterAccess& operator=(ScatterAccess const& other) = delete;
+  ScatterAccess& operator=(ScatterAccess&& other)      = delete;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION
+  ScatterAccess(ScatterAccess&& other)
+      : view(other.view), thread_id(other.thread_id) {
+    other.thread_id = ~thread_id_type(0);
+  }
+
+ private:
+  using unique_token_type = typename view_type::unique_token_type;
+  using thread_id_type    = typename unique_token_type::size_type;
+  thread_id_type thread_id;
+};
+
 template <typename Op          = Kokkos::Experimental::ScatterSum,
           typename Duplication = void, typename Contribution = void,
           typename RT, typename... RP>
@@ -1580,6 +2618,42 @@ void contribute(
   contribute(execution_space{}, dest, src);
 }
 
+template <typename DT1, typename DT2, typename LY, typename ES, typename OP,
+          typename CT, typename DP, typename... VP>
+void contribute(
+    typename ES::execution_space const& exec_space, View<DT1, VP...>& dest,
+    Kokkos::Experimental::ScatterView<DT2, LY, ES, OP, CT, DP> const& src,
+    std::pair<size_t, size_t> rows) {
+  src.contribute_into(exec_space, dest, rows);
+}
+
+template <typename DT1, typename DT2, typename LY, typename ES, typename OP,
+          typename CT, typename DP, typename... VP>
+void contribute(
+    View<DT1, VP...>& dest,
+    Kokkos::Experimental::ScatterView<DT2, LY, ES, OP, CT, DP> const& src,
+    std::pair<size_t, size_t> rows) {
+  using execution_space = typename ES::execution_space;
+  contribute(execution_space{}, dest, src, rows);
+}
+
+template <typename DT1, typename DT2, typename LY, typename ES, typename OP,
+          typename CT, typename DP, typename... VP>
+void contribute_and_reset(
+    typename ES::execution_space const& exec_space, View<DT1, VP...>& dest,
+    Kokkos::Experimental::ScatterView<DT2, LY, ES, OP, CT, DP>& src) {
+  src.contribute_and_reset(exec_space, dest);
+}
+
+template <typename DT1, typename DT2, typename LY, typename ES, typename OP,
+          typename CT, typename DP, typename... VP>
+void contribute_and_reset(
+    View<DT1, VP...>& dest,
+    Kokkos::Experimental::ScatterView<DT2, LY, ES, OP, CT, DP>& src) {
+  using execution_space = typename ES::execution_space;
+  contribute_and_reset(execution_space{}, dest, src);
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -0,0 +1,718 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_UnorderedFlatMap.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::UnorderedFlatMap.
+
+#ifndef KOKKOS_UNORDERED_FLAT_MAP_HPP
+#define KOKKOS_UNORDERED_FLAT_MAP_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_UNORDEREDFLATMAP
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_UnorderedMap.hpp>
+
+#include <impl/Kokkos_UnorderedFlatMap_impl.hpp>
+
+#include <cstdint>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class UnorderedFlatMap
+/// \brief Thread-safe lookup table using open addressing.
+///
+/// This class has the insert/find/valid_at interface of
+/// Kokkos::UnorderedMap, but instead of chaining the entries of a bucket
+/// through a linked list it stores them directly in a flat array of slots
+/// (a "Swiss table").  Every slot has a control byte that is either empty,
+/// deleted, or holds a 7 bit fingerprint of the hash of its key.  The slots
+/// are organized in groups of eight and the control bytes of a group are
+/// compared against the fingerprint all at once, so that a lookup usually
+/// reads one control word and one key instead of following a chain of
+/// dependent loads.
+///
+/// As with UnorderedMap, insert() does not reallocate memory and fails when
+/// the map is full; the caller has to rehash() and insert again.  On the
+/// device it may also fail when another insert keeps a slot of the group it
+/// probes claimed for too long, which is handled the same way.
+///
+/// erase() marks the slot of the key as deleted right away and may be called
+/// in the same kernel as insert(), there is no begin_erase()/end_erase()
+/// phase.  Deleted slots are only reclaimed by rehash(), so maps that see
+/// many erasures need to be rehashed from time to time.
+///
+/// \tparam Key Type of keys of the lookup table.  If \c const, users
+///   are not allowed to add or remove keys, though they are allowed
+///   to change values.
+///
+/// \tparam Value Type of values stored in the lookup table.  You may use
+///   \c void here, in which case the table will be a set of keys.  If
+///   \c const, users are not allowed to change entries.
+///
+/// \tparam Device The Kokkos Device type.
+///
+/// \tparam Hasher Definition of the hash function for instances of
+///   <tt>Key</tt>.  The default will calculate a bitwise hash.
+///
+/// \tparam EqualTo Definition of the equality function for instances of
+///   <tt>Key</tt>.  The default will do a bitwise equality comparison.
+///
+template <typename Key, typename Value,
+          typename Device  = Kokkos::DefaultExecutionSpace,
+          typename Hasher  = pod_hash<std::remove_const_t<Key>>,
+          typename EqualTo = pod_equal_to<std::remove_const_t<Key>>>
+class UnorderedFlatMap {
+ private:
+  using host_mirror_space =
+      typename ViewTraits<Key, Device, void, void>::host_mirror_space;
+
+ public:
+  //! \name Public types and constants
+  //@{
+  // key_types
+  using declared_key_type = Key;
+  using key_type          = std::remove_const_t<declared_key_type>;
+  using const_key_type    = std::add_const_t<key_type>;
+
+  // value_types
+  using declared_value_type = Value;
+  using value_type          = std::remove_const_t<declared_value_type>;
+  using const_value_type    = std::add_const_t<value_type>;
+
+  using device_type     = Device;
+  using execution_space = typename Device::execution_space;
+  using hasher_type     = Hasher;
+  using equal_to_type   = EqualTo;
+  using size_type       = uint32_t;
+
+  // map_types
+  using declared_map_type =
+      UnorderedFlatMap<declared_key_type, declared_value_type, device_type,
+                       hasher_type, equal_to_type>;
+  using insertable_map_type = UnorderedFlatMap<key_type, value_type,
+                                               device_type, hasher_type,
+                                               equal_to_type>;
+  using modifiable_map_type =
+      UnorderedFlatMap<const_key_type, value_type, device_type, hasher_type,
+                       equal_to_type>;
+  using const_map_type =
+      UnorderedFlatMap<const_key_type, const_value_type, device_type,
+                       hasher_type, equal_to_type>;
+
+  static constexpr bool is_set = std::is_void_v<value_type>;
+  static constexpr bool has_const_key =
+      std::is_same_v<const_key_type, declared_key_type>;
+  static constexpr bool has_const_value =
+      is_set || std::is_same_v<const_value_type, declared_value_type>;
+
+  static constexpr bool is_insertable_map =
+      !has_const_key && (is_set || !has_const_value);
+  static constexpr bool is_modifiable_map = has_const_key && !has_const_value;
+  static constexpr bool is_const_map      = has_const_key && has_const_value;
+
+  using insert_result = UnorderedMapInsertResult;
+
+  using HostMirror =
+      UnorderedFlatMap<Key, Value, host_mirror_space, Hasher, EqualTo>;
+  //@}
+
+ private:
+  enum : size_type { invalid_index = ~static_cast<size_type>(0) };
+
+  using group_type = Kokkos::Impl::UnorderedFlatMapGroup;
+  using word_type  = typename group_type::word_type;
+
+  using impl_value_type = std::conditional_t<is_set, int, declared_value_type>;
+
+  using key_type_view = std::conditional_t<
+      is_insertable_map, View<key_type *, device_type>,
+      View<const key_type *, device_type, MemoryTraits<RandomAccess>>>;
+
+  using value_type_view = std::conditional_t<
+      is_insertable_map || is_modifiable_map,
+      View<impl_value_type *, device_type>,
+      View<const impl_value_type *, device_type, MemoryTraits<RandomAccess>>>;
+
+  using ctrl_view = std::conditional_t<
+      is_insertable_map, View<word_type *, device_type>,
+      View<const word_type *, device_type, MemoryTraits<RandomAccess>>>;
+
+  enum { modified_idx = 0, failed_insert_idx = 1 };
+  enum { num_scalars = 2 };
+  using scalars_view = View<int[num_scalars], LayoutLeft, device_type>;
+
+  // Groups probed by an insert before it fails, unless the map is being
+  // rehashed.  At the load factor targeted by the capacity almost every key
+  // is found in the first two groups of its probe sequence.
+  enum : size_type { bounded_probes = 32u };
+
+  // Reads of a group with a slot claimed by another insert before an insert
+  // on the device gives up.
+  enum : size_type { max_busy_reads = 1024u };
+
+ public:
+  //! \name Public member functions
+  //@{
+  using default_op_type =
+      typename UnorderedMapInsertOpTypes<value_type_view, uint32_t>::NoOp;
+
+  /// \brief Constructor
+  ///
+  /// \param capacity_hint [in] Initial guess of how many unique keys will be
+  ///                           inserted into the map.
+  /// \param hash          [in] Hasher function for \c Key instances.  The
+  ///                           default value usually suffices.
+  /// \param equal_to      [in] The operator used for determining if two
+  ///                           keys are equal.
+  UnorderedFlatMap(size_type capacity_hint = 0,
+                   hasher_type hasher      = hasher_type(),
+                   equal_to_type equal_to  = equal_to_type())
+      : UnorderedFlatMap(Kokkos::view_alloc(), capacity_hint, hasher,
+                         equal_to) {}
+
+  template <class... P>
+  UnorderedFlatMap(const Kokkos::Impl::ViewCtorProp<P...> &arg_prop,
+                   size_type capacity_hint = 0,
+                   hasher_type hasher      = hasher_type(),
+                   equal_to_type equal_to  = equal_to_type())
+      : m_bounded_insert(true), m_hasher(hasher), m_equal_to(equal_to) {
+    if (!is_insertable_map) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Cannot construct a non-insertable (i.e. const key_type) "
+          "unordered_flat_map");
+    }
+
+    //! Ensure that allocation properties are consistent.
+    using alloc_prop_t = std::decay_t<decltype(arg_prop)>;
+    static_assert(alloc_prop_t::initialize,
+                  "Allocation property 'initialize' should be true.");
+    static_assert(
+        !alloc_prop_t::has_pointer,
+        "Allocation properties should not contain the 'pointer' property.");
+
+    /// Update allocation properties with 'label' and 'without initializing'
+    /// properties.
+    const auto prop_copy = Kokkos::Impl::with_properties_if_unset(
+        arg_prop, std::string("UnorderedFlatMap"));
+    const auto prop_copy_noinit = Kokkos::Impl::with_properties_if_unset(
+        prop_copy, Kokkos::WithoutInitializing);
+
+    //! Initialize member views.
+    m_size = shared_size_t(Kokkos::view_alloc(
+        Kokkos::DefaultHostExecutionSpace{},
+        Kokkos::Impl::get_property<Kokkos::Impl::LabelTag>(prop_copy) +
+            " - size"));
+
+    const size_type num_groups = calculate_num_groups(capacity_hint);
+
+    m_ctrl = ctrl_view(
+        Kokkos::Impl::append_to_label(prop_copy_noinit, " - control"),
+        num_groups);
+
+    m_keys = key_type_view(Kokkos::Impl::append_to_label(prop_copy, " - keys"),
+                           capacity());
+
+    m_values =
+        value_type_view(Kokkos::Impl::append_to_label(prop_copy, " - values"),
+                        is_set ? 0 : capacity());
+
+    m_scalars =
+        scalars_view(Kokkos::Impl::append_to_label(prop_copy, " - scalars"));
+
+    if constexpr (alloc_prop_t::has_execution_space) {
+      const auto &space =
+          Kokkos::Impl::get_property<Kokkos::Impl::ExecutionSpaceTag>(
+              arg_prop);
+      Kokkos::deep_copy(space, m_ctrl, group_type::empty_word);
+    } else {
+      Kokkos::deep_copy(m_ctrl, group_type::empty_word);
+    }
+  }
+
+  void reset_failed_insert_flag() { reset_flag(failed_insert_idx); }
+
+  //! Clear all entries in the table.
+  void clear() {
+    m_bounded_insert = true;
+
+    if (capacity() == 0) return;
+
+    Kokkos::deep_copy(m_ctrl, group_type::empty_word);
+    {
+      const key_type tmp = key_type();
+      Kokkos::deep_copy(m_keys, tmp);
+    }
+    Kokkos::deep_copy(m_scalars, 0);
+    m_size() = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool is_allocated() const {
+    return (m_keys.is_allocated() && (is_set || m_values.is_allocated()) &&
+            m_scalars.is_allocated());
+  }
+
+  /// \brief Change the capacity of the the map
+  ///
+  /// If there are no failed inserts the current size of the map will
+  /// be used as a lower bound for the input capacity.
+  /// If the map is not empty and does not have failed inserts
+  /// and the capacity changes then the current data is copied
+  /// into the resized / rehashed map.  Deleted slots are reclaimed.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  bool rehash(size_type requested_capacity = 0) {
+    const bool bounded_insert = (capacity() == 0) || (size() == 0u);
+    return rehash(requested_capacity, bounded_insert);
+  }
+
+  bool rehash(size_type requested_capacity, bool bounded_insert) {
+    if (!is_insertable_map) return false;
+
+    const size_type curr_size = size();
+    requested_capacity =
+        (requested_capacity < curr_size) ? curr_size : requested_capacity;
+
+    insertable_map_type tmp(requested_capacity, m_hasher, m_equal_to);
+
+    if (curr_size) {
+      tmp.m_bounded_insert = false;
+      Kokkos::Impl::UnorderedMapRehash<insertable_map_type> f(tmp, *this);
+      f.apply();
+    }
+    tmp.m_bounded_insert = bounded_insert;
+
+    *this = tmp;
+
+    return true;
+  }
+
+  /// \brief The number of entries in the table.
+  ///
+  /// Note that this is <i>not</i> a device function; it cannot be called in
+  /// a parallel kernel.  The value is not stored as a variable; it
+  /// must be computed. m_size is a mutable cache of that value.
+  size_type size() const {
+    if (capacity() == 0u) return 0u;
+    if (modified()) {
+      m_size() =
+          Kokkos::Impl::UnorderedFlatMapCount<const_map_type>(*this).apply();
+      reset_flag(modified_idx);
+    }
+    return m_size();
+  }
+
+  /// \brief The current number of failed insert() calls.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.  The value is not stored as a
+  /// variable; it must be computed.
+  bool failed_insert() const { return get_flag(failed_insert_idx); }
+
+  /// \brief The maximum number of entries that the table can hold.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_type capacity() const { return m_ctrl.extent(0) * group_type::width; }
+
+  //---------------------------------------------------------------------------
+  //---------------------------------------------------------------------------
+
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.  As discussed in the class documentation, it need not
+  /// succeed.  The return value tells you if it did.
+  ///
+  /// \param k [in] The key to attempt to insert.
+  /// \param v [in] The corresponding value to attempt to insert.  If
+  ///   using this class as a set (with Value = void), then you need not
+  ///   provide this value.
+  /// \param insert_op [in] The operator used for combining values if a
+  ///                       key already exists. See
+  ///                       Kokkos::UnorderedMapInsertOpTypes for more ops.
+  template <typename InsertOpType = default_op_type>
+  KOKKOS_INLINE_FUNCTION insert_result
+  insert(key_type const &k, impl_value_type const &v = impl_value_type(),
+         [[maybe_unused]] InsertOpType arg_insert_op = InsertOpType()) const {
+    if constexpr (is_set) {
+      static_assert(std::is_same_v<InsertOpType, default_op_type>,
+                    "Insert Operations are not supported on sets.");
+    }
+
+    insert_result result;
+
+    if (!is_insertable_map || capacity() == 0u) {
+      return result;
+    }
+
+    if (!m_scalars((int)modified_idx)) {
+      m_scalars((int)modified_idx) = true;
+    }
+
+    const size_type hash       = m_hasher(k);
+    const uint32_t h2          = group_type::fingerprint(hash);
+    const size_type mask       = m_ctrl.extent(0) - 1;
+    const size_type max_probes = (m_bounded_insert && bounded_probes <= mask)
+                                     ? size_type(bounded_probes)
+                                     : mask + 1;
+
+    size_type group = hash & mask;
+    size_type probe = 0;
+    [[maybe_unused]] size_type busy_reads = 0;
+    while (probe < max_probes) {
+      // An insert that claimed a slot of this group may be writing k, look
+      // at the group again once it published the fingerprint.  The lanes of
+      // a warp or wavefront are not guaranteed to make progress while
+      // another one spins, so on the device give up after a few reads and
+      // fail like a full map does: the caller rehashes and inserts again.
+      const word_type ctrl = Kokkos::atomic_load(&m_ctrl[group]);
+      if (group_type::match_busy(ctrl)) {
+        KOKKOS_IF_ON_DEVICE((if (++busy_reads > max_busy_reads) break;))
+        continue;
+      }
+
+      word_type matches = group_type::match(ctrl, h2);
+      if (matches) {
+        // Do not read the keys before their control bytes
+        memory_fence();
+      }
+      for (; matches; matches = group_type::clear_first(matches)) {
+        const size_type i =
+            group * group_type::width + group_type::first(matches);
+        if (m_equal_to(m_keys[i], k)) {
+          result.set_existing(i, false);
+          if constexpr (!is_set) {
+            arg_insert_op.op(m_values, i, v);
+          }
+          return result;
+        }
+      }
+
+      // Slots are only ever claimed from empty ones, so a group without
+      // any is full for good and k is not in it.
+      const word_type empties = group_type::match_empty(ctrl);
+      if (!empties) {
+        result.increment_list_position();
+        group = (group + ++probe) & mask;
+        continue;
+      }
+
+      const int slot        = group_type::first(empties);
+      const word_type claim = group_type::shift(
+          group_type::empty ^ group_type::busy, slot);
+      if (ctrl == atomic_compare_exchange(&m_ctrl[group], ctrl, ctrl ^ claim)) {
+        const size_type i = group * group_type::width + slot;
+        m_keys[i]         = k;
+        if constexpr (!is_set) {
+          m_values[i] = v;
+        }
+        // Do not publish the fingerprint until key and value are updated in
+        // global memory
+        memory_fence();
+        Kokkos::atomic_xor(&m_ctrl[group],
+                           group_type::shift(group_type::busy ^ h2, slot));
+        result.set_success(i);
+        return result;
+      }
+      // Another thread changed the group in between, look at it again.
+    }
+
+    m_scalars((int)failed_insert_idx) = true;
+    return result;
+  }
+
+  /// \brief Erase the key \c k, if it exists in the table.
+  ///
+  /// The slot of the key is marked as deleted and is not reused until the
+  /// next rehash().
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel, also in the same kernel as insert().
+  KOKKOS_INLINE_FUNCTION
+  bool erase(key_type const &k) const {
+    if (!is_insertable_map) return false;
+
+    const size_type i = find(k);
+    if (!valid_at(i)) return false;
+
+    if (!m_scalars((int)modified_idx)) {
+      m_scalars((int)modified_idx) = true;
+    }
+
+    const size_type group = i / group_type::width;
+    const int slot        = i % group_type::width;
+    const word_type byte  = group_type::shift(0xFFu, slot);
+
+    // Only one of the threads erasing the same key succeeds
+    word_type ctrl = Kokkos::atomic_load(&m_ctrl[group]);
+    while (group_type::byte(ctrl, slot) != group_type::deleted) {
+      const word_type erased =
+          (ctrl & ~byte) | group_type::shift(group_type::deleted, slot);
+      const word_type old =
+          atomic_compare_exchange(&m_ctrl[group], ctrl, erased);
+      if (old == ctrl) return true;
+      ctrl = old;
+    }
+    return false;
+  }
+
+  /// \brief Find the given key \c k, if it exists in the table.
+  ///
+  /// \return If the key exists in the table, the index of the
+  ///   value corresponding to that key; otherwise, an invalid index.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  KOKKOS_INLINE_FUNCTION
+  size_type find(const key_type &k) const {
+    if (capacity() == 0u) return invalid_index;
+
+    const size_type hash = m_hasher(k);
+    const uint32_t h2    = group_type::fingerprint(hash);
+    const size_type mask = m_ctrl.extent(0) - 1;
+
+    size_type group = hash & mask;
+    for (size_type probe = 0; probe <= mask;) {
+      const word_type ctrl = m_ctrl[group];
+      for (word_type matches = group_type::match(ctrl, h2); matches;
+           matches           = group_type::clear_first(matches)) {
+        const size_type i =
+            group * group_type::width + group_type::first(matches);
+        if (m_equal_to(m_keys[i], k)) return i;
+      }
+      // k would have been inserted into the first slot left empty
+      if (group_type::match_empty(ctrl)) break;
+      group = (group + ++probe) & mask;
+    }
+
+    return invalid_index;
+  }
+
+  /// \brief Does the key exist in the map
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  KOKKOS_INLINE_FUNCTION
+  bool exists(const key_type &k) const { return valid_at(find(k)); }
+
+  /// \brief Get the value with \c i as its direct index.
+  ///
+  /// \param i [in] Index directly into the array of entries.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  template <typename Dummy = value_type>
+  KOKKOS_FORCEINLINE_FUNCTION std::enable_if_t<
+      !std::is_void_v<Dummy>,  // !is_set
+      std::conditional_t<has_const_value, impl_value_type, impl_value_type &>>
+  value_at(size_type i) const {
+    KOKKOS_EXPECTS(i < capacity());
+    return m_values[i];
+  }
+
+  /// \brief Get the key with \c i as its direct index.
+  ///
+  /// \param i [in] Index directly into the array of entries.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  KOKKOS_FORCEINLINE_FUNCTION
+  key_type key_at(size_type i) const {
+    KOKKOS_EXPECTS(i < capacity());
+    return m_keys[i];
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool valid_at(size_type i) const {
+    // full slots are the ones with the high bit of the control byte unset
+    return i < capacity() && !(group_type::byte(m_ctrl[i / group_type::width],
+                                                i % group_type::width) &
+                               group_type::empty);
+  }
+
+  template <typename SKey, typename SValue>
+  UnorderedFlatMap(
+      UnorderedFlatMap<SKey, SValue, Device, Hasher, EqualTo> const &src,
+      std::enable_if_t<
+          Kokkos::Impl::UnorderedMapCanAssign<
+              declared_key_type, declared_value_type, SKey, SValue>::value,
+          int> = 0)
+      : m_bounded_insert(src.m_bounded_insert),
+        m_hasher(src.m_hasher),
+        m_equal_to(src.m_equal_to),
+        m_size(src.m_size),
+        m_ctrl(src.m_ctrl),
+        m_keys(src.m_keys),
+        m_values(src.m_values),
+        m_scalars(src.m_scalars) {}
+
+  template <typename SKey, typename SValue>
+  std::enable_if_t<
+      Kokkos::Impl::UnorderedMapCanAssign<declared_key_type,
+                                          declared_value_type, SKey,
+                                          SValue>::value,
+      declared_map_type &>
+  operator=(
+      UnorderedFlatMap<SKey, SValue, Device, Hasher, EqualTo> const &src) {
+    m_bounded_insert = src.m_bounded_insert;
+    m_hasher         = src.m_hasher;
+    m_equal_to       = src.m_equal_to;
+    m_size           = src.m_size;
+    m_ctrl           = src.m_ctrl;
+    m_keys           = src.m_keys;
+    m_values         = src.m_values;
+    m_scalars        = src.m_scalars;
+    return *this;
+  }
+
+  // Allocate views of the calling UnorderedFlatMap with the same capacity as
+  // the src.
+  template <typename SKey, typename SValue, typename SDevice>
+  std::enable_if_t<std::is_same_v<std::remove_const_t<SKey>, key_type> &&
+                   std::is_same_v<std::remove_const_t<SValue>, value_type>>
+  allocate_view(
+      UnorderedFlatMap<SKey, SValue, SDevice, Hasher, EqualTo> const &src) {
+    insertable_map_type tmp;
+
+    tmp.m_bounded_insert = src.m_bounded_insert;
+    tmp.m_hasher         = src.m_hasher;
+    tmp.m_equal_to       = src.m_equal_to;
+    tmp.m_size()         = src.m_size();
+    tmp.m_ctrl           = typename insertable_map_type::ctrl_view(
+        view_alloc(WithoutInitializing, "UnorderedFlatMap control"),
+        src.m_ctrl.extent(0));
+    tmp.m_keys = typename insertable_map_type::key_type_view(
+        view_alloc(WithoutInitializing, "UnorderedFlatMap keys"),
+        src.m_keys.extent(0));
+    tmp.m_values = typename insertable_map_type::value_type_view(
+        view_alloc(WithoutInitializing, "UnorderedFlatMap values"),
+        src.m_values.extent(0));
+    tmp.m_scalars = scalars_view("UnorderedFlatMap scalars");
+
+    *this = tmp;
+  }
+
+  // Deep copy view data from src. This requires that the src capacity is
+  // identical to the capacity of the calling UnorderedFlatMap.
+  template <typename SKey, typename SValue, typename SDevice>
+  std::enable_if_t<std::is_same_v<std::remove_const_t<SKey>, key_type> &&
+                   std::is_same_v<std::remove_const_t<SValue>, value_type>>
+  deep_copy_view(
+      UnorderedFlatMap<SKey, SValue, SDevice, Hasher, EqualTo> const &src) {
+    KOKKOS_EXPECTS(capacity() == src.capacity());
+
+    if (m_ctrl.data() != src.m_ctrl.data()) {
+      typename device_type::execution_space exec_space{};
+
+      Kokkos::deep_copy(exec_space, m_ctrl, src.m_ctrl);
+      Kokkos::deep_copy(exec_space, m_keys, src.m_keys);
+      if (!is_set) {
+        Kokkos::deep_copy(exec_space, m_values, src.m_values);
+      }
+      Kokkos::deep_copy(exec_space, m_scalars, src.m_scalars);
+
+      Kokkos::fence(
+          "Kokkos::UnorderedFlatMap::deep_copy_view: fence after copy to "
+          "dst.");
+    }
+  }
+
+  //@}
+ private:  // private member functions
+  bool modified() const { return get_flag(modified_idx); }
+
+  void reset_flag(int flag) const {
+    auto scalar = Kokkos::subview(m_scalars, flag);
+    Kokkos::deep_copy(typename device_type::execution_space{}, scalar,
+                      static_cast<int>(false));
+    Kokkos::fence(
+        "Kokkos::UnorderedFlatMap::reset_flag: fence after copying flag from "
+        "HostSpace");
+  }
+
+  bool get_flag(int flag) const {
+    const auto scalar = Kokkos::subview(m_scalars, flag);
+    int result;
+    Kokkos::deep_copy(typename device_type::execution_space{}, result, scalar);
+    Kokkos::fence(
+        "Kokkos::UnorderedFlatMap::get_flag: fence after copy to return value "
+        "in HostSpace");
+    return result;
+  }
+
+  static size_type calculate_num_groups(size_type capacity_hint) {
+    // keep the load factor below 7/8 and use a power of two number of
+    // groups, so that the triangular probe sequence visits all of them
+    const uint64_t min_slots = (8ull * capacity_hint + 6u) / 7u;
+    uint64_t num_groups      = 16u;
+    while (num_groups * group_type::width < min_slots) num_groups *= 2u;
+    return static_cast<size_type>(num_groups);
+  }
+
+ private:  // private members
+  bool m_bounded_insert;
+  hasher_type m_hasher;
+  equal_to_type m_equal_to;
+  using shared_size_t = View<size_type, Kokkos::DefaultHostExecutionSpace>;
+  shared_size_t m_size;
+  ctrl_view m_ctrl;
+  key_type_view m_keys;
+  value_type_view m_values;
+  scalars_view m_scalars;
+
+  template <typename KKey, typename VValue, typename DDevice, typename HHash,
+            typename EEqualTo>
+  friend class UnorderedFlatMap;
+
+  template <typename UMap>
+  friend struct Kokkos::Impl::UnorderedFlatMapCount;
+};
+
+}  // namespace Experimental
+
+// Specialization of deep_copy() for two UnorderedFlatMap objects.
+template <typename DKey, typename DT, typename DDevice, typename SKey,
+          typename ST, typename SDevice, typename Hasher, typename EqualTo>
+inline void deep_copy(
+    Experimental::UnorderedFlatMap<DKey, DT, DDevice, Hasher, EqualTo> &dst,
+    const Experimental::UnorderedFlatMap<SKey, ST, SDevice, Hasher, EqualTo>
+        &src) {
+  dst.deep_copy_view(src);
+}
+
+// Specialization of create_mirror() for an UnorderedFlatMap object.
+template <typename Key, typename ValueType, typename Device, typename Hasher,
+          typename EqualTo>
+typename Experimental::UnorderedFlatMap<Key, ValueType, Device, Hasher,
+                                        EqualTo>::HostMirror
+create_mirror(const Experimental::UnorderedFlatMap<Key, ValueType, Device,
+                                                   Hasher, EqualTo> &src) {
+  typename Experimental::UnorderedFlatMap<Key, ValueType, Device, Hasher,
+                                          EqualTo>::HostMirror dst;
+  dst.allocate_view(src);
+  return dst;
+}
+
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_UNORDEREDFLATMAP
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_UNORDEREDFLATMAP
+#endif
+#endif  // KOKKOS_UNORDERED_FLAT_MAP_HPP
@@ -36,7 +36,9 @@
 #include <impl/Kokkos_UnorderedMap_impl.hpp>
 #include <View/Kokkos_ViewCtor.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <utility>
 
 #ifndef KOKKOS_ENABLE_DEPRECATED_CODE_4
 #if defined(KOKKOS_COMPILER_GNU) && !defined(__PGIC__) && \
@@ -203,6 +205,13 @@ struct UnorderedMapInsertOpTypes {
 ///      ignored and the old value was left in place. </li>
 /// </ol>
 ///
+/// erase() leaves a tombstone in the entry of the key, so that erase()
+/// and insert() may be called in the same kernel.  Inserting an erased
+/// key again reuses its entry: the first insert writes its value before
+/// the entry becomes visible again, the concurrent ones are combined with
+/// it by the insert operator.  The entries of erased keys are reclaimed
+/// by rehash() and by end_erase().
+///
 /// \tparam Key Type of keys of the lookup table.  If \c const, users
 ///   are not allowed to add or remove keys, though they are allowed
 ///   to change values.  In that case, the implementation may make
@@ -362,6 +371,11 @@ class UnorderedMap {
         bitset_type(Kokkos::Impl::append_to_label(prop_copy, " - bitset"),
                     calculate_capacity(capacity_hint));
 
+    m_tombstones = bitset_type(
+        Kokkos::Impl::append_to_label(prop_copy, " - tombstones"), capacity());
+    m_revivals = bitset_type(
+        Kokkos::Impl::append_to_label(prop_copy, " - revivals"), capacity());
+
     m_hash_lists = size_type_view(
         Kokkos::Impl::append_to_label(prop_copy_noinit, " - hash list"),
         Impl::find_hash_size(capacity()));
@@ -408,6 +422,7 @@ class UnorderedMap {
     if (capacity() == 0) return;
 
     m_available_indexes.clear();
+    m_tombstones.clear();
 
     Kokkos::deep_copy(m_hash_lists, invalid_index);
     Kokkos::deep_copy(m_next_index, invalid_index);
@@ -430,7 +445,11 @@ class UnorderedMap {
   /// be used as a lower bound for the input capacity.
   /// If the map is not empty and does not have failed inserts
   /// and the capacity changes then the current data is copied
-  /// into the resized / rehashed map.
+  /// into the resized / rehashed map.  Erased entries are dropped.
+  ///
+  /// The entries are moved in bulk: they are counted per hash list of the
+  /// new map and then copied to consecutive entries, list after list, so
+  /// that no insert has to search for a free entry or append to a list.
   ///
   /// This is <i>not</i> a device function; it may <i>not</i> be
   /// called in a parallel kernel.
@@ -440,18 +459,35 @@ class UnorderedMap {
   }
 
   bool rehash(size_type requested_capacity, bool bounded_insert) {
+    return rehash(execution_space{}, requested_capacity, bounded_insert);
+  }
+
+  /// \brief Change the capacity of the map, allocating the new map and
+  /// moving the entries on the execution space instance \c exec.
+  template <class ExecSpace>
+  std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> rehash(
+      ExecSpace const &exec, size_type requested_capacity) {
+    const bool bounded_insert = (capacity() == 0) || (size() == 0u);
+    return rehash(exec, requested_capacity, bounded_insert);
+  }
+
+  template <class ExecSpace>
+  std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> rehash(
+      ExecSpace const &exec, size_type requested_capacity,
+      bool bounded_insert) {
     if (!is_insertable_map) return false;
 
     const size_type curr_size = size();
     requested_capacity =
         (requested_capacity < curr_size) ? curr_size : requested_capacity;
 
-    insertable_map_type tmp(requested_capacity, m_hasher, m_equal_to);
+    insertable_map_type tmp(view_alloc(exec), requested_capacity, m_hasher,
+                            m_equal_to);
 
     if (curr_size) {
-      tmp.m_bounded_insert = false;
-      Impl::UnorderedMapRehash<insertable_map_type> f(tmp, *this);
-      f.apply();
+      Impl::UnorderedMapBulkRehash<insertable_map_type, ExecSpace> f(
+          exec, tmp, *this);
+      tmp.m_size() = f.apply();
     }
     tmp.m_bounded_insert = bounded_insert;
 
@@ -460,9 +496,7 @@ class UnorderedMap {
     return true;
   }
 
-  /// \brief The number of entries in the table.
-  ///
-  /// This method has undefined behavior when erasable() is true.
+  /// \brief The number of entries in the table, not counting erased keys.
   ///
   /// Note that this is <i>not</i> a device function; it cannot be called in
   /// a parallel kernel.  The value is not stored as a variable; it
@@ -470,7 +504,7 @@ class UnorderedMap {
   size_type size() const {
     if (capacity() == 0u) return 0u;
     if (modified()) {
-      m_size() = m_available_indexes.count();
+      m_size() = m_available_indexes.count() - m_tombstones.count();
       reset_flag(modified_idx);
     }
     return m_size();
@@ -498,6 +532,10 @@ class UnorderedMap {
     return result;
   }
 
+  /// \brief Leave the erase phase and reclaim the entries of erased keys.
+  ///
+  /// erase() does not require begin_erase() anymore; the erase phase
+  /// remains as a way to reclaim the entries without a rehash.
   bool end_erase() {
     bool result = erasable();
     if (is_insertable_map && result) {
@@ -587,7 +625,8 @@ class UnorderedMap {
             ? bounded_find_attempts
             : m_available_indexes.max_hint();
 
-    bool not_done = true;
+    bool not_done       = true;
+    bool freed_existing = false;
 
 #if defined(__MIC__)
 #pragma noprefetch
@@ -632,20 +671,49 @@ class UnorderedMap {
       //------------------------------------------------------------
       // If key already present then return that index.
       if (curr != invalid_index) {
-        const bool free_existing = new_index != invalid_index;
-        if (free_existing) {
+        if (new_index != invalid_index) {
           // Previously claimed an unused entry that was not inserted.
           // Release this unused entry immediately.
           if (!m_available_indexes.reset(new_index)) {
             Kokkos::printf("Unable to free existing\n");
           }
+          new_index      = invalid_index;
+          freed_existing = true;
         }
 
-        result.set_existing(curr, free_existing);
-        if constexpr (!is_set) {
-          arg_insert_op.op(m_values, curr, v);
+        if (m_tombstones.test(curr)) {
+          // The key was erased.  The thread that claims the entry writes the
+          // new value and clears the tombstone only then, within this pass.
+          // The others search again until it is done and then combine their
+          // value with the new one.
+          if (m_revivals.set(curr)) {
+            const bool revived = m_tombstones.test(curr);
+            if (revived) {
+              if constexpr (!is_set) {
+#ifdef KOKKOS_ENABLE_SYCL
+                Kokkos::atomic_store(&m_values[curr], v);
+#else
+                m_values[curr] = v;
+                // Do not publish the entry before its value
+                memory_fence();
+#endif
+              }
+              m_tombstones.reset(curr);
+              result.set_success(curr);
+              not_done = false;
+            }
+#ifndef KOKKOS_ENABLE_SYCL
+            memory_fence();
+#endif
+            m_revivals.reset(curr);
+          }
+        } else {
+          result.set_existing(curr, freed_existing);
+          if constexpr (!is_set) {
+            arg_insert_op.op(m_values, curr, v);
+          }
+          not_done = false;
         }
-        not_done = false;
       }
       //------------------------------------------------------------
       // Key is not currently in the map.
@@ -709,19 +777,61 @@ class UnorderedMap {
     return result;
   }
 
+  /// \brief Insert all the keys in \c keys, with the corresponding
+  ///   entries of \c values as their values.
+  ///
+  /// Unlike insert() this does not fail when the map runs out of space.  If
+  /// the map cannot hold all the keys, it is first rehashed for an estimate
+  /// of the number of distinct keys.  Whenever inserts fail anyway, the map
+  /// is grown and only the keys that failed are inserted again.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  ///
+  /// \param exec      [in] The execution space instance to insert on.
+  /// \param keys      [in] Rank-1 view of the keys to insert.
+  /// \param values    [in] Rank-1 view of the values, as long as \c keys.
+  /// \param insert_op [in] The operator used for combining values if a
+  ///                       key already exists.
+  template <typename ExecSpace, typename KeysView, typename ValuesView,
+            typename InsertOpType = default_op_type>
+  void bulk_insert(ExecSpace const &exec, KeysView const &keys,
+                   ValuesView const &values,
+                   InsertOpType const &insert_op = InsertOpType()) {
+    static_assert(!is_set, "Use bulk_insert(exec, keys) on sets.");
+    static_assert(Kokkos::is_view_v<ValuesView> && ValuesView::rank() == 1,
+                  "UnorderedMap::bulk_insert: values must be a rank-1 view");
+    KOKKOS_EXPECTS(values.extent(0) >= keys.extent(0));
+    bulk_insert_impl(exec, keys, values, insert_op);
+  }
+
+  /// \brief Insert all the keys in \c keys into the set.
+  template <typename ExecSpace, typename KeysView>
+  void bulk_insert(ExecSpace const &exec, KeysView const &keys) {
+    static_assert(is_set, "Use bulk_insert(exec, keys, values) on maps.");
+    bulk_insert_impl(exec, keys, keys, default_op_type());
+  }
+
+  /// \brief Erase the key \c k, if it exists in the table.
+  ///
+  /// The entry of the key is marked with a tombstone, it stays in its list
+  /// until the next rehash() or end_erase().
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel, also in the same kernel as insert().
   KOKKOS_INLINE_FUNCTION
   bool erase(key_type const &k) const {
     bool result = false;
 
-    if (is_insertable_map && 0u < capacity() && m_scalars((int)erasable_idx)) {
+    if (is_insertable_map && 0u < capacity()) {
       if (!m_scalars((int)modified_idx)) {
         m_scalars((int)modified_idx) = true;
       }
 
       size_type index = find(k);
       if (valid_at(index)) {
-        m_available_indexes.reset(index);
-        result = true;
+        // only one of the threads erasing the same key succeeds
+        result = m_tombstones.set(index);
       }
     }
 
@@ -752,6 +862,62 @@ class UnorderedMap {
     return curr;
   }
 
+  /// \brief Find all the keys in \c keys and write the results of find()
+  ///   to \c indices.
+  ///
+  /// On host backends the keys are looked up in groups: the hash lists of
+  /// all the keys of a group are prefetched before any of them is read and
+  /// the lists are then walked one step per key in turn, so that the cache
+  /// misses of a group overlap instead of being paid one after another.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  ///
+  /// \param exec    [in]  The execution space instance to search on.
+  /// \param keys    [in]  Rank-1 view of the keys to find.
+  /// \param indices [out] Rank-1 view, as long as \c keys, of the indices
+  ///                      of the keys; an invalid index for missing keys.
+  template <typename ExecSpace, typename KeysView, typename IndicesView,
+            std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, int> = 0>
+  void find_batch(ExecSpace const &exec, KeysView const &keys,
+                  IndicesView const &indices) const {
+    static_assert(Kokkos::is_view_v<KeysView> && KeysView::rank() == 1 &&
+                      Kokkos::is_view_v<IndicesView> &&
+                      IndicesView::rank() == 1,
+                  "UnorderedMap::find_batch: keys and indices must be rank-1 "
+                  "views");
+    KOKKOS_EXPECTS(indices.extent(0) >= keys.extent(0));
+
+    using find_batch_type =
+        Impl::UnorderedMapFindBatch<const_map_type, KeysView, IndicesView,
+                                    ExecSpace>;
+    find_batch_type f(*this, keys, indices);
+    parallel_for("Kokkos::UnorderedMap::find_batch",
+                 RangePolicy<ExecSpace>(exec, 0, f.num_groups()), f);
+  }
+
+  /// \brief Find all the keys in \c keys with the threads of \c team.
+  ///
+  /// Same as the other overload, but called by all the threads of a team
+  /// in a parallel kernel, which split the keys among them.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  template <typename TeamMember, typename KeysView, typename IndicesView,
+            std::enable_if_t<!Kokkos::is_execution_space_v<TeamMember>, int> =
+                0>
+  KOKKOS_INLINE_FUNCTION void find_batch(TeamMember const &team,
+                                         KeysView const &keys,
+                                         IndicesView const &indices) const {
+    constexpr size_type group_size = Impl::unordered_map_find_group_size<
+        typename TeamMember::execution_space>();
+    const size_type num_keys   = keys.extent(0);
+    const size_type num_groups = (num_keys + group_size - 1) / group_size;
+    parallel_for(TeamThreadRange(team, num_groups), [&](size_type group) {
+      find_group<group_size>(keys, indices, group * group_size, num_keys);
+    });
+  }
+
   /// \brief Does the key exist in the map
   ///
   /// This <i>is</i> a device function; it may be called in a parallel
@@ -789,7 +955,9 @@ class UnorderedMap {
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
-  bool valid_at(size_type i) const { return m_available_indexes.test(i); }
+  bool valid_at(size_type i) const {
+    return m_available_indexes.test(i) && !m_tombstones.test(i);
+  }
 
   template <typename SKey, typename SValue>
   UnorderedMap(
@@ -803,6 +971,8 @@ class UnorderedMap {
         m_equal_to(src.m_equal_to),
         m_size(src.m_size),
         m_available_indexes(src.m_available_indexes),
+        m_tombstones(src.m_tombstones),
+        m_revivals(src.m_revivals),
         m_hash_lists(src.m_hash_lists),
         m_next_index(src.m_next_index),
         m_keys(src.m_keys),
@@ -820,6 +990,8 @@ class UnorderedMap {
     m_equal_to          = src.m_equal_to;
     m_size              = src.m_size;
     m_available_indexes = src.m_available_indexes;
+    m_tombstones        = src.m_tombstones;
+    m_revivals          = src.m_revivals;
     m_hash_lists        = src.m_hash_lists;
     m_next_index        = src.m_next_index;
     m_keys              = src.m_keys;
@@ -855,6 +1027,8 @@ class UnorderedMap {
     tmp.m_equal_to          = src.m_equal_to;
     tmp.m_size()            = src.m_size();
     tmp.m_available_indexes = bitset_type(src.capacity());
+    tmp.m_tombstones        = bitset_type(src.capacity());
+    tmp.m_revivals          = bitset_type(src.capacity());
     tmp.m_hash_lists        = size_type_view(
         view_alloc(WithoutInitializing, "UnorderedMap hash list"),
         src.m_hash_lists.extent(0));
@@ -896,6 +1070,7 @@ class UnorderedMap {
 
     if (m_hash_lists.data() != src.m_hash_lists.data()) {
       Kokkos::deep_copy(m_available_indexes, src.m_available_indexes);
+      Kokkos::deep_copy(m_tombstones, src.m_tombstones);
 
       // do the other deep copies asynchronously if possible
       typename device_type::execution_space exec_space{};
@@ -945,6 +1120,135 @@ class UnorderedMap {
     return result;
   }
 
+  template <typename ExecSpace, typename KeysView, typename ValuesView,
+            typename InsertOpType>
+  void bulk_insert_impl(ExecSpace const &exec, KeysView const &keys,
+                        ValuesView const &values,
+                        InsertOpType const &insert_op) {
+    static_assert(is_insertable_map,
+                  "UnorderedMap::bulk_insert: the map must be insertable");
+    static_assert(Kokkos::is_execution_space_v<ExecSpace>,
+                  "UnorderedMap::bulk_insert: exec must be an execution space "
+                  "instance");
+    static_assert(Kokkos::is_view_v<KeysView> && KeysView::rank() == 1,
+                  "UnorderedMap::bulk_insert: keys must be a rank-1 view");
+    static_assert(
+        SpaceAccessibility<ExecSpace, typename KeysView::memory_space>::
+                accessible &&
+            SpaceAccessibility<ExecSpace,
+                               typename device_type::memory_space>::accessible,
+        "UnorderedMap::bulk_insert: the keys and the map must be accessible "
+        "from exec");
+
+    if (erasable()) {
+      Kokkos::Impl::throw_runtime_exception(
+          "UnorderedMap::bulk_insert: cannot insert between begin_erase() and "
+          "end_erase()");
+    }
+
+    const size_type num_keys = keys.extent(0);
+    if (num_keys == 0u) return;
+
+    // Make room for the new keys up front, unless the map can take all of
+    // them anyway.  Duplicate keys are common (e.g. the nodes shared by
+    // elements), so estimate how many distinct keys there are.
+    const uint64_t curr_size = size();
+    if (capacity() < curr_size + num_keys) {
+      const double distinct =
+          Impl::UnorderedMapCardinality<KeysView, hasher_type, ExecSpace>(
+              keys, m_hasher)
+              .apply(exec);
+      // leave room for the error of the estimate
+      const uint64_t num_new =
+          std::min<uint64_t>(num_keys, static_cast<uint64_t>(1.1 * distinct));
+      if (capacity() < curr_size + num_new)
+        rehash(exec, curr_size + num_new);
+    }
+
+    using bulk_insert_type =
+        Impl::UnorderedMapBulkInsert<declared_map_type, KeysView, ValuesView,
+                                     InsertOpType, ExecSpace>;
+    using index_view = typename bulk_insert_type::index_view;
+    using count_view = typename bulk_insert_type::count_view;
+
+    bulk_insert_type f(*this, keys, values, insert_op);
+    count_view num_failed(
+        view_alloc(exec, "UnorderedMap::bulk_insert - number failed"));
+    index_view retry;
+    index_view failed(view_alloc(exec, WithoutInitializing,
+                                 "UnorderedMap::bulk_insert - failed"),
+                      num_keys);
+
+    size_type num_retry = num_keys;
+    while ((num_retry = f.apply(exec, retry, num_retry, failed, num_failed)) >
+           0u) {
+      // The keys inserted so far are moved over, so only the ones that
+      // failed need to be inserted again.
+      rehash(exec, capacity() + num_retry);
+      f.m_map = *this;
+      if (retry.extent(0) == 0u) {
+        retry = index_view(view_alloc(exec, WithoutInitializing,
+                                      "UnorderedMap::bulk_insert - failed"),
+                           num_keys);
+      }
+      std::swap(retry, failed);
+    }
+  }
+
+  // Look up the keys in [begin, min(begin + N, end)) of \c keys, walking
+  // their hash lists in lockstep.
+  template <int N, typename KeysView, typename IndicesView>
+  KOKKOS_INLINE_FUNCTION void find_group(KeysView const &keys,
+                                         IndicesView const &indices,
+                                         size_type begin,
+                                         size_type end) const {
+    if constexpr (N == 1) {
+      indices(begin) = find(keys(begin));
+    } else {
+      const int num_keys = end - begin < size_type(N) ? int(end - begin) : N;
+      if (capacity() == 0u) {
+        for (int g = 0; g < num_keys; ++g) indices(begin + g) = invalid_index;
+        return;
+      }
+
+      size_type curr[N];
+      for (int g = 0; g < num_keys; ++g) {
+        curr[g] = m_hasher(keys(begin + g)) % m_hash_lists.extent(0);
+        KOKKOS_IMPL_NONTEMPORAL_PREFETCH_LOAD(&m_hash_lists(curr[g]));
+      }
+      for (int g = 0; g < num_keys; ++g) {
+        curr[g] = m_hash_lists(curr[g]);
+        if (curr[g] == invalid_index) {
+          indices(begin + g) = invalid_index;
+        } else {
+          KOKKOS_IMPL_NONTEMPORAL_PREFETCH_LOAD(&m_keys[curr[g]]);
+          KOKKOS_IMPL_NONTEMPORAL_PREFETCH_LOAD(&m_next_index[curr[g]]);
+        }
+      }
+
+      // every pass moves each key still searching one entry further
+      for (bool searching = true; searching;) {
+        searching = false;
+        for (int g = 0; g < num_keys; ++g) {
+          if (curr[g] == invalid_index) continue;
+          if (m_equal_to(m_keys[curr[g]], keys(begin + g))) {
+            indices(begin + g) = curr[g];
+            curr[g]            = invalid_index;
+            continue;
+          }
+          curr[g] = m_next_index[curr[g]];
+          if (curr[g] == invalid_index) {
+            indices(begin + g) = invalid_index;
+          } else {
+            KOKKOS_IMPL_NONTEMPORAL_PREFETCH_LOAD(&m_keys[curr[g]]);
+            KOKKOS_IMPL_NONTEMPORAL_PREFETCH_LOAD(&m_next_index[curr[g]]);
+            searching = true;
+          }
+        }
+      }
+    }
+  }
+
   static uint32_t calculate_capacity(uint32_t capacity_hint) {
     // increase by 16% and round to nears multiple of 128
     return capacity_hint
@@ -961,6 +1265,9 @@ class UnorderedMap {
   using shared_size_t = View<size_type, Kokkos::DefaultHostExecutionSpace>;
   shared_size_t m_size;
   bitset_type m_available_indexes;
+  bitset_type m_tombstones;
+  // claims on erased entries while an insert brings them back
+  bitset_type m_revivals;
   size_type_view m_hash_lists;
   size_type_view m_next_index;
   key_type_view m_keys;
@@ -974,6 +1281,13 @@ class UnorderedMap {
   template <typename UMap>
   friend struct Impl::UnorderedMapErase;
 
+  template <typename UMap, typename ExecSpace>
+  friend struct Impl::UnorderedMapBulkRehash;
+
+  template <typename UMap, typename KeysView, typename IndicesView,
+            typename ExecSpace>
+  friend struct Impl::UnorderedMapFindBatch;
+
   template <typename UMap>
   friend struct Impl::UnorderedMapHistogram;
 
@@ -0,0 +1,250 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_ORDERED_MAP_IMPL_HPP
+#define KOKKOS_ORDERED_MAP_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace Kokkos {
+namespace Impl {
+
+//! Index of the first key in [begin, end) of the sorted \c keys that is not
+//! less than \c k.
+template <typename KeysView, typename Key>
+KOKKOS_INLINE_FUNCTION uint32_t ordered_map_lower_bound(KeysView const& keys,
+                                                        uint32_t begin,
+                                                        uint32_t end,
+                                                        Key const& k) {
+  while (begin < end) {
+    const uint32_t mid = begin + (end - begin) / 2;
+    if (keys(mid) < k) {
+      begin = mid + 1;
+    } else {
+      end = mid;
+    }
+  }
+  return begin;
+}
+
+/// \brief A sorted range [begin, begin + size) of keys and values.
+template <typename KeysView, typename ValuesView>
+struct OrderedMapRun {
+  KeysView keys;
+  ValuesView values;
+  uint32_t begin;
+  uint32_t size;
+};
+
+/// \brief Write \c count elements of the stable merge of the runs \c a and
+///   \c b, starting with element \c d, to \c out.
+///
+/// Where the merge path crosses diagonal \c d is found by a binary search,
+/// so that any number of threads can merge disjoint parts of the output
+/// independently.  On equal keys the elements of \c a come first.
+template <typename InRun, typename OutRun>
+KOKKOS_INLINE_FUNCTION void ordered_map_merge_path(InRun const& a,
+                                                   InRun const& b,
+                                                   OutRun const& out,
+                                                   uint32_t d,
+                                                   uint32_t count) {
+  uint32_t lo = d > b.size ? d - b.size : 0;
+  uint32_t hi = d < a.size ? d : a.size;
+  while (lo < hi) {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    if (b.keys(b.begin + d - mid - 1) < a.keys(a.begin + mid)) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+
+  uint32_t i = lo;
+  uint32_t j = d - lo;
+  for (uint32_t o = out.begin + d; o < out.begin + d + count; ++o) {
+    if (j >= b.size ||
+        (i < a.size && !(b.keys(b.begin + j) < a.keys(a.begin + i)))) {
+      out.keys(o)   = a.keys(a.begin + i);
+      out.values(o) = a.values(a.begin + i);
+      ++i;
+    } else {
+      out.keys(o)   = b.keys(b.begin + j);
+      out.values(o) = b.values(b.begin + j);
+      ++j;
+    }
+  }
+}
+
+/// \brief Stable parallel merge sort of keys and values.
+///
+/// Runs of \c run_size elements are sorted by insertion sort, then pairs of
+/// sorted runs are merged along their merge path until a single run is
+/// left.  Each round reads one array and writes the other.
+template <typename KeysView, typename ValuesView, typename ExecSpace>
+struct OrderedMapSort {
+  using run_type = OrderedMapRun<KeysView, ValuesView>;
+
+  static constexpr uint32_t run_size  = 16;
+  static constexpr uint32_t tile_size = 256;
+
+  struct RunTag {};
+  struct MergeTag {};
+
+  KeysView m_src_keys;
+  ValuesView m_src_values;
+  KeysView m_dst_keys;
+  ValuesView m_dst_values;
+  uint32_t m_size;
+  uint32_t m_width;
+  uint32_t m_tile;
+
+  /// Sort \c keys and \c values, which may be swapped with the buffers the
+  /// merge rounds write to.
+  static void apply(ExecSpace const& exec, KeysView& keys,
+                    ValuesView& values) {
+    OrderedMapSort f;
+    f.m_size       = keys.extent(0);
+    f.m_src_keys   = keys;
+    f.m_src_values = values;
+    parallel_for("Kokkos::Impl::OrderedMapSort::runs",
+                 RangePolicy<ExecSpace, RunTag>(
+                     exec, 0, (f.m_size + run_size - 1) / run_size),
+                 f);
+    if (f.m_size <= run_size) return;
+
+    f.m_dst_keys   = KeysView(view_alloc(exec, WithoutInitializing,
+                                         "Kokkos::Impl::OrderedMapSort::keys"),
+                              f.m_size);
+    f.m_dst_values = ValuesView(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::Impl::OrderedMapSort::values"),
+        f.m_size);
+    for (f.m_width = run_size; f.m_width < f.m_size; f.m_width *= 2) {
+      // the tiles must not straddle two pairs of runs
+      f.m_tile = std::min<uint64_t>(tile_size, 2ull * f.m_width);
+      parallel_for("Kokkos::Impl::OrderedMapSort::merge",
+                   RangePolicy<ExecSpace, MergeTag>(
+                       exec, 0, (f.m_size + f.m_tile - 1) / f.m_tile),
+                   f);
+      std::swap(f.m_src_keys, f.m_dst_keys);
+      std::swap(f.m_src_values, f.m_dst_values);
+    }
+    keys   = f.m_src_keys;
+    values = f.m_src_values;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(RunTag, uint32_t run) const {
+    const uint32_t begin = run * run_size;
+    const uint32_t end = begin + run_size < m_size ? begin + run_size : m_size;
+    for (uint32_t i = begin + 1; i < end; ++i) {
+      const auto k = m_src_keys(i);
+      const auto v = m_src_values(i);
+      uint32_t j   = i;
+      for (; j > begin && k < m_src_keys(j - 1); --j) {
+        m_src_keys(j)   = m_src_keys(j - 1);
+        m_src_values(j) = m_src_values(j - 1);
+      }
+      m_src_keys(j)   = k;
+      m_src_values(j) = v;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(MergeTag, uint32_t tile) const {
+    const uint64_t pos   = uint64_t(tile) * m_tile;
+    const uint64_t first = pos - pos % (2ull * m_width);
+    const uint64_t mid   = first + m_width < m_size ? first + m_width : m_size;
+    const uint64_t last =
+        first + 2ull * m_width < m_size ? first + 2ull * m_width : m_size;
+    const run_type a{m_src_keys, m_src_values, uint32_t(first),
+                     uint32_t(mid - first)};
+    const run_type b{m_src_keys, m_src_values, uint32_t(mid),
+                     uint32_t(last - mid)};
+    const run_type out{m_dst_keys, m_dst_values, uint32_t(first), 0};
+    const uint64_t count = pos + m_tile < last ? m_tile : last - pos;
+    ordered_map_merge_path(a, b, out, uint32_t(pos - first), uint32_t(count));
+  }
+};
+
+/// \brief Merge two sorted runs into \c out with one thread per tile.
+template <typename InRun, typename OutRun, typename ExecSpace>
+struct OrderedMapMerge {
+  static constexpr uint32_t tile_size = 256;
+
+  InRun m_a;
+  InRun m_b;
+  OutRun m_out;
+
+  static void apply(ExecSpace const& exec, InRun const& a, InRun const& b,
+                    OutRun const& out) {
+    const uint64_t size = uint64_t(a.size) + b.size;
+    parallel_for("Kokkos::Impl::OrderedMapMerge",
+                 RangePolicy<ExecSpace>(exec, 0,
+                                        (size + tile_size - 1) / tile_size),
+                 OrderedMapMerge{a, b, out});
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(uint32_t tile) const {
+    const uint32_t d    = tile * tile_size;
+    const uint32_t size = m_a.size + m_b.size;
+    ordered_map_merge_path(m_a, m_b, m_out, d,
+                           d + tile_size < size ? tile_size : size - d);
+  }
+};
+
+/// \brief Copy the last of every run of equal keys of the sorted \c in to
+///   the front of \c out and return how many keys there are.
+template <typename KeysView, typename ValuesView, typename ExecSpace>
+struct OrderedMapUnique {
+  KeysView m_in_keys;
+  ValuesView m_in_values;
+  KeysView m_out_keys;
+  ValuesView m_out_values;
+
+  static uint32_t apply(ExecSpace const& exec, KeysView const& in_keys,
+                        ValuesView const& in_values, KeysView const& out_keys,
+                        ValuesView const& out_values) {
+    uint32_t count = 0;
+    parallel_scan("Kokkos::Impl::OrderedMapUnique",
+                  RangePolicy<ExecSpace>(exec, 0, in_keys.extent(0)),
+                  OrderedMapUnique{in_keys, in_values, out_keys, out_values},
+                  count);
+    return count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(uint32_t i, uint32_t& offset, bool final) const {
+    if (i + 1 < m_in_keys.extent(0) && !(m_in_keys(i) < m_in_keys(i + 1))) {
+      return;
+    }
+    if (final) {
+      m_out_keys(offset)   = m_in_keys(i);
+      m_out_values(offset) = m_in_values(i);
+    }
+    ++offset;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_ORDERED_MAP_IMPL_HPP
@@ -174,6 +174,141 @@ inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
   return output;
 }
 
+//----------------------------------------------------------------------------
+
+/// \brief Build a graph with \c nrows rows from the edges
+///   <tt>(rows(i), cols(i))</tt> in parallel on \c exec.
+///
+/// The edges are counted per row, the counts scanned into the row map and
+/// the columns scattered into their rows, all on \c exec, which must be able
+/// to access \c rows, \c cols and the memory space of the graph.  Every
+/// row index must be less than \c nrows.
+///
+/// The order of the entries within a row is unspecified, unless
+/// \c sort_and_merge is true: then each row is sorted in ascending order and
+/// repeated edges are stored once.
+template <class StaticCrsGraphType, class ExecutionSpace, class RowsType,
+          class ColsType>
+typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph_from_coo(
+    const std::string& label, const ExecutionSpace& exec,
+    const RowsType& rows, const ColsType& cols, const size_t nrows,
+    const bool sort_and_merge = false) {
+  using output_type  = StaticCrsGraphType;
+  using entries_type = typename output_type::entries_type;
+  using size_type    = typename output_type::size_type;
+  using work_type    = View<size_type*, typename output_type::array_layout,
+                         typename output_type::device_type>;
+  using policy_type  = RangePolicy<ExecutionSpace, IndexType<size_t> >;
+
+  static_assert(entries_type::rank == 1, "Graph entries view must be rank one");
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename entries_type::memory_space>::accessible,
+      "create_staticcrsgraph_from_coo: the execution space must be able to "
+      "access the graph");
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename RowsType::memory_space>::accessible &&
+          SpaceAccessibility<ExecutionSpace,
+                             typename ColsType::memory_space>::accessible,
+      "create_staticcrsgraph_from_coo: the execution space must be able to "
+      "access the edges");
+
+  if (rows.extent(0) != cols.extent(0)) {
+    Impl::throw_runtime_exception(
+        "create_staticcrsgraph_from_coo: rows and cols differ in length");
+  }
+  const size_t nnz = rows.extent(0);
+
+  // Count the entries of every row, in place of the row map
+  work_type row_map(view_alloc(exec, label + "::row_map"), nrows + 1);
+  parallel_for(
+      "Kokkos::create_staticcrsgraph_from_coo::count",
+      policy_type(exec, 0, nnz), KOKKOS_LAMBDA(const size_t i) {
+        atomic_inc(&row_map(static_cast<size_t>(rows(i))));
+      });
+  parallel_scan(
+      "Kokkos::create_staticcrsgraph_from_coo::scan",
+      policy_type(exec, 0, nrows + 1),
+      KOKKOS_LAMBDA(const size_t i, size_type& update, const bool final) {
+        const size_type count = row_map(i);
+        if (final) row_map(i) = update;
+        update += count;
+      });
+
+  // Scatter the columns, each row filled from its start on
+  work_type cursor(view_alloc(exec, WithoutInitializing, label + "::cursor"),
+                   nrows);
+  deep_copy(exec, cursor, subview(row_map, std::make_pair(size_t(0), nrows)));
+  entries_type entries(view_alloc(exec, WithoutInitializing, label), nnz);
+  parallel_for(
+      "Kokkos::create_staticcrsgraph_from_coo::fill",
+      policy_type(exec, 0, nnz), KOKKOS_LAMBDA(const size_t i) {
+        const size_type entry =
+            atomic_fetch_add(&cursor(static_cast<size_t>(rows(i))), 1);
+        entries(entry) = cols(i);
+      });
+
+  if (sort_and_merge) {
+    parallel_for(
+        "Kokkos::create_staticcrsgraph_from_coo::sort",
+        policy_type(exec, 0, nrows), KOKKOS_LAMBDA(const size_t i) {
+          Impl::sort_crs_row(entries, row_map(i), row_map(i + 1));
+        });
+
+    // Count the distinct entries of every row and compact them, unless
+    // there are no duplicates
+    work_type merged_row_map(
+        view_alloc(exec, WithoutInitializing, label + "::row_map"), nrows + 1);
+    size_type merged_nnz = 0;
+    parallel_scan(
+        "Kokkos::create_staticcrsgraph_from_coo::count_distinct",
+        policy_type(exec, 0, nrows + 1),
+        KOKKOS_LAMBDA(const size_t i, size_type& update, const bool final) {
+          if (final) merged_row_map(i) = update;
+          if (i == nrows) return;
+          const size_type begin = row_map(i);
+          const size_type end   = row_map(i + 1);
+          for (size_type j = begin; j < end; ++j) {
+            if (j == begin || entries(j - 1) < entries(j)) ++update;
+          }
+        },
+        merged_nnz);
+
+    if (merged_nnz != nnz) {
+      entries_type merged_entries(view_alloc(exec, WithoutInitializing, label),
+                                  merged_nnz);
+      parallel_for(
+          "Kokkos::create_staticcrsgraph_from_coo::merge",
+          policy_type(exec, 0, nrows), KOKKOS_LAMBDA(const size_t i) {
+            const size_type begin = row_map(i);
+            const size_type end   = row_map(i + 1);
+            size_type entry       = merged_row_map(i);
+            for (size_type j = begin; j < end; ++j) {
+              if (j == begin || entries(j - 1) < entries(j)) {
+                merged_entries(entry++) = entries(j);
+              }
+            }
+          });
+      entries = merged_entries;
+      row_map = merged_row_map;
+    }
+  }
+  exec.fence("Kokkos::create_staticcrsgraph_from_coo: fence after fill");
+
+  return output_type(entries, row_map);
+}
+
+template <class StaticCrsGraphType, class ExecutionSpace, class RowsType,
+          class ColsType>
+typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph_from_coo(
+    const ExecutionSpace& exec, const RowsType& rows, const ColsType& cols,
+    const size_t nrows, const bool sort_and_merge = false) {
+  return create_staticcrsgraph_from_coo<StaticCrsGraphType>(
+      "Kokkos::StaticCrsGraph::entries", exec, rows, cols, nrows,
+      sort_and_merge);
+}
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,129 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_UNORDERED_FLAT_MAP_IMPL_HPP
+#define KOKKOS_UNORDERED_FLAT_MAP_IMPL_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_BitManipulation.hpp>
+#include <cstdint>
+
+namespace Kokkos {
+namespace Impl {
+
+/// \brief Control bytes of a group of slots of UnorderedFlatMap.
+///
+/// Every slot of the map has a control byte. A full slot stores the 7 bit
+/// fingerprint of the hash of its key with the high bit unset, the other
+/// states have the high bit set. The control bytes of eight consecutive
+/// slots form the 64-bit control word of a group, byte j of the word (in
+/// bits [8j, 8j + 8)) belonging to slot j of the group. All the queries
+/// below handle the eight slots of a group at once with integer arithmetic
+/// and return a mask with the high bit of the byte of every matching slot
+/// set.
+struct UnorderedFlatMapGroup {
+  using word_type = uint64_t;
+
+  enum : int { width = 8 };
+
+  enum : uint32_t { empty = 0x80u, deleted = 0xFEu, busy = 0xFFu };
+
+  static constexpr word_type lsbs       = 0x0101010101010101ull;
+  static constexpr word_type msbs       = 0x8080808080808080ull;
+  static constexpr word_type empty_word = lsbs * empty;
+
+  /// The fingerprint stored in the control byte of a full slot
+  KOKKOS_FORCEINLINE_FUNCTION
+  static uint32_t fingerprint(uint32_t hash) { return hash >> 25; }
+
+  /// Full slots whose fingerprint is \c h2. A slot right above a match may
+  /// be reported as well, so the keys still need to be compared.
+  KOKKOS_FORCEINLINE_FUNCTION
+  static word_type match(word_type ctrl, uint32_t h2) {
+    const word_type x = ctrl ^ (lsbs * h2);
+    return (x - lsbs) & ~x & msbs;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static word_type match_full(word_type ctrl) { return ~ctrl & msbs; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static word_type match_empty(word_type ctrl) {
+    return ctrl & ~(ctrl << 1) & msbs;
+  }
+
+  /// Slots claimed by an insert that is still writing the key
+  KOKKOS_FORCEINLINE_FUNCTION
+  static word_type match_busy(word_type ctrl) {
+    return ctrl & (ctrl << 1) & (ctrl << 7) & msbs;
+  }
+
+  /// The lowest slot in a non-empty mask
+  KOKKOS_FORCEINLINE_FUNCTION
+  static int first(word_type mask) {
+    return Kokkos::Experimental::countr_zero_builtin(mask) / 8;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static word_type clear_first(word_type mask) { return mask & (mask - 1); }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static uint32_t byte(word_type ctrl, int slot) {
+    return static_cast<uint32_t>(ctrl >> (8 * slot)) & 0xFFu;
+  }
+
+  /// The control word with \c value in the byte of \c slot and zero elsewhere
+  KOKKOS_FORCEINLINE_FUNCTION
+  static word_type shift(uint32_t value, int slot) {
+    return static_cast<word_type>(value) << (8 * slot);
+  }
+};
+
+template <typename Map>
+struct UnorderedFlatMapCount {
+  using map_type        = Map;
+  using execution_space = typename map_type::execution_space;
+  using size_type       = typename map_type::size_type;
+  using value_type      = size_type;
+
+  map_type m_map;
+
+  UnorderedFlatMapCount(map_type const& map) : m_map(map) {}
+
+  size_type apply() const {
+    size_type count = 0u;
+    parallel_reduce("Kokkos::Impl::UnorderedFlatMapCount::apply",
+                    m_map.m_ctrl.extent(0), *this, count);
+    return count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& count) const { count = 0u; }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& count, const size_type& incr) const { count += incr; }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i, value_type& count) const {
+    count += Kokkos::Experimental::popcount_builtin(
+        UnorderedFlatMapGroup::match_full(m_map.m_ctrl[i]));
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_UNORDERED_FLAT_MAP_IMPL_HPP
@@ -18,8 +18,10 @@
 #define KOKKOS_UNORDERED_MAP_IMPL_HPP
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_BitManipulation.hpp>
 #include <cstdint>
 
+#include <cmath>
 #include <cstdio>
 #include <climits>
 #include <iomanip>
@@ -69,6 +71,265 @@ struct UnorderedMapRehash {
   }
 };
 
+/// \brief Estimate the number of distinct keys in a view (HyperLogLog).
+///
+/// Every key is hashed, the top bits of the hash select one of the
+/// registers and the register keeps the largest number of leading zeros
+/// seen in the remaining bits.  The estimate has a relative standard error
+/// of about 1.04 / sqrt(num_registers), i.e. 3%.
+template <typename KeysView, typename Hasher, typename ExecSpace>
+struct UnorderedMapCardinality {
+  using execution_space = ExecSpace;
+  using size_type       = uint32_t;
+  using registers_view  = View<uint32_t*, typename KeysView::memory_space>;
+
+  enum : uint32_t { register_bits = 10, num_registers = 1u << register_bits };
+
+  KeysView m_keys;
+  Hasher m_hasher;
+  registers_view m_registers;
+
+  UnorderedMapCardinality(KeysView const& keys, Hasher const& hasher)
+      : m_keys(keys),
+        m_hasher(hasher),
+        m_registers("Kokkos::Impl::UnorderedMapCardinality::registers",
+                    num_registers) {}
+
+  double apply(ExecSpace const& exec) const {
+    parallel_for("Kokkos::Impl::UnorderedMapCardinality::apply",
+                 RangePolicy<ExecSpace>(exec, 0, m_keys.extent(0)), *this);
+    auto registers = create_mirror_view_and_copy(
+        view_alloc(exec, Kokkos::HostSpace{}), m_registers);
+    exec.fence(
+        "Kokkos::Impl::UnorderedMapCardinality::apply: fence after copying "
+        "registers to host");
+
+    double sum              = 0.0;
+    size_type zero_register = 0;
+    for (size_type j = 0; j < num_registers; ++j) {
+      sum += std::ldexp(1.0, -static_cast<int>(registers(j)));
+      if (registers(j) == 0u) ++zero_register;
+    }
+    const double m        = num_registers;
+    const double estimate = 0.7213 / (1.0 + 1.079 / m) * m * m / sum;
+    // few distinct keys leave registers untouched, count those instead
+    if (estimate <= 2.5 * m && zero_register > 0) {
+      return m * std::log(m / zero_register);
+    }
+    return estimate;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i) const {
+    const uint32_t hash = m_hasher(m_keys(i));
+    const uint32_t j    = hash >> (32 - register_bits);
+    // the marker bit bounds the rank by the number of remaining bits
+    const uint32_t rank =
+        Kokkos::Experimental::countl_zero_builtin(
+            (hash << register_bits) | (1u << (register_bits - 1))) +
+        1;
+    // most keys do not raise their register, skip the atomic for them
+    if (m_registers(j) < rank) atomic_max(&m_registers(j), rank);
+  }
+};
+
+/// \brief Insert the keys of a view, or the keys at the indices of a retry
+/// list, and record the indices of the keys that failed.
+template <typename Map, typename KeysView, typename ValuesView,
+          typename InsertOp, typename ExecSpace>
+struct UnorderedMapBulkInsert {
+  using map_type        = Map;
+  using execution_space = ExecSpace;
+  using size_type       = typename map_type::size_type;
+  using index_view =
+      View<size_type*, typename map_type::device_type::memory_space>;
+  using count_view =
+      View<size_type, typename map_type::device_type::memory_space>;
+
+  map_type m_map;
+  KeysView m_keys;
+  ValuesView m_values;
+  InsertOp m_insert_op;
+  index_view m_retry;
+  index_view m_failed;
+  count_view m_num_failed;
+
+  UnorderedMapBulkInsert(map_type const& map, KeysView const& keys,
+                         ValuesView const& values, InsertOp const& insert_op)
+      : m_map(map), m_keys(keys), m_values(values), m_insert_op(insert_op) {}
+
+  /// Insert the keys at the indices in \c retry, all of them if \c retry
+  /// is empty, and return the number of keys that failed.  Their indices
+  /// are written to the front of \c failed.
+  size_type apply(ExecSpace const& exec, index_view const& retry,
+                  size_type num_retry, index_view const& failed,
+                  count_view const& num_failed) {
+    m_retry      = retry;
+    m_failed     = failed;
+    m_num_failed = num_failed;
+    Kokkos::deep_copy(exec, m_num_failed, 0u);
+    parallel_for("Kokkos::Impl::UnorderedMapBulkInsert::apply",
+                 RangePolicy<ExecSpace>(exec, 0, num_retry), *this);
+    size_type result = 0;
+    Kokkos::deep_copy(exec, result, m_num_failed);
+    exec.fence(
+        "Kokkos::Impl::UnorderedMapBulkInsert::apply: fence after copying "
+        "number of failed inserts to host");
+    return result;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i) const {
+    const size_type index = m_retry.extent(0) ? m_retry(i) : i;
+    bool failed;
+    if constexpr (map_type::is_set) {
+      failed = m_map.insert(m_keys(index)).failed();
+    } else {
+      failed = m_map.insert(m_keys(index), m_values(index), m_insert_op)
+                   .failed();
+    }
+    if (failed) m_failed(atomic_fetch_add(&m_num_failed(), 1u)) = index;
+  }
+};
+
+/// \brief Number of keys UnorderedMap::find_batch() looks up together.
+///
+/// Host threads have to overlap the cache misses of several lookups
+/// themselves, while GPUs hide them by switching between warps.
+template <typename ExecSpace>
+KOKKOS_FUNCTION constexpr uint32_t unordered_map_find_group_size() {
+  return SpaceAccessibility<HostSpace,
+                            typename ExecSpace::memory_space>::accessible
+             ? 16
+             : 1;
+}
+
+template <typename Map, typename KeysView, typename IndicesView,
+          typename ExecSpace>
+struct UnorderedMapFindBatch {
+  using map_type  = Map;
+  using size_type = typename map_type::size_type;
+  static constexpr size_type group_size =
+      unordered_map_find_group_size<ExecSpace>();
+
+  map_type m_map;
+  KeysView m_keys;
+  IndicesView m_indices;
+
+  UnorderedMapFindBatch(map_type const& map, KeysView const& keys,
+                        IndicesView const& indices)
+      : m_map(map), m_keys(keys), m_indices(indices) {}
+
+  size_type num_groups() const {
+    return (m_keys.extent(0) + group_size - 1) / group_size;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type group) const {
+    m_map.template find_group<group_size>(m_keys, m_indices,
+                                          group * group_size,
+                                          m_keys.extent(0));
+  }
+};
+
+/// \brief Move the entries of a map into a new, empty one.
+///
+/// The entries are counted per hash list of the new map and the counts are
+/// scanned into offsets.  Every entry is then copied to the next free entry
+/// of its list, so that the lists of the new map consist of consecutive
+/// entries and can be linked without any search or atomic append.
+template <typename Map,
+          typename ExecSpace = typename Map::execution_space>
+struct UnorderedMapBulkRehash {
+  using map_type        = Map;
+  using const_map_type  = typename map_type::const_map_type;
+  using execution_space = ExecSpace;
+  using size_type       = typename map_type::size_type;
+  using offsets_view    = View<size_type*, typename map_type::device_type>;
+
+  struct CountTag {};
+  struct ScanTag {};
+  struct MoveTag {};
+  struct LinkTag {};
+
+  execution_space m_exec;
+  map_type m_dst;
+  const_map_type m_src;
+  offsets_view m_offsets;
+
+  UnorderedMapBulkRehash(execution_space const& exec, map_type const& dst,
+                         const_map_type const& src)
+      : m_exec(exec),
+        m_dst(dst),
+        m_src(src),
+        m_offsets(
+            view_alloc(exec, "Kokkos::Impl::UnorderedMapBulkRehash::offsets"),
+            dst.m_hash_lists.extent(0)) {}
+
+  //! Move the entries and return how many there are.
+  size_type apply() const {
+    const size_type num_lists = m_offsets.extent(0);
+    parallel_for(
+        "Kokkos::Impl::UnorderedMapBulkRehash::count",
+        RangePolicy<execution_space, CountTag>(m_exec, 0, m_src.capacity()),
+        *this);
+    size_type num_entries = 0;
+    parallel_scan(
+        "Kokkos::Impl::UnorderedMapBulkRehash::scan",
+        RangePolicy<execution_space, ScanTag>(m_exec, 0, num_lists), *this,
+        num_entries);
+    parallel_for(
+        "Kokkos::Impl::UnorderedMapBulkRehash::move",
+        RangePolicy<execution_space, MoveTag>(m_exec, 0, m_src.capacity()),
+        *this);
+    parallel_for("Kokkos::Impl::UnorderedMapBulkRehash::link",
+                 RangePolicy<execution_space, LinkTag>(m_exec, 0, num_lists),
+                 *this);
+    return num_entries;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_type list_of(size_type i) const {
+    return m_dst.m_hasher(m_src.key_at(i)) % m_offsets.extent(0);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(CountTag, size_type i) const {
+    if (m_src.valid_at(i)) atomic_inc(&m_offsets(list_of(i)));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(ScanTag, size_type list, size_type& offset,
+                  bool final) const {
+    const size_type count = m_offsets(list);
+    if (final) m_offsets(list) = offset;
+    offset += count;
+  }
+
+  // Afterwards every offset points to the end of its list.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(MoveTag, size_type i) const {
+    if (!m_src.valid_at(i)) return;
+    const size_type j = atomic_fetch_add(&m_offsets(list_of(i)), 1u);
+    m_dst.m_keys[j]   = m_src.key_at(i);
+    if constexpr (!map_type::is_set) {
+      m_dst.m_values[j] = m_src.value_at(i);
+    }
+    m_dst.m_available_indexes.set(j);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(LinkTag, size_type list) const {
+    const size_type begin = list ? m_offsets(list - 1) : 0u;
+    const size_type end   = m_offsets(list);
+    if (begin == end) return;
+    m_dst.m_hash_lists(list) = begin;
+    for (size_type j = begin; j + 1 < end; ++j) {
+      m_dst.m_next_index[j] = j + 1;
+    }
+  }
+};
+
 template <typename UMap>
 struct UnorderedMapErase {
   using map_type        = UMap;
@@ -86,6 +347,16 @@ struct UnorderedMapErase {
                  m_map.m_hash_lists.extent(0), *this);
   }
 
+  // Free the entry of an erased key that was removed from its list.
+  KOKKOS_INLINE_FUNCTION
+  void release(size_type curr) const {
+    m_map.m_next_index[curr] = map_type::invalid_index;
+    m_map.m_keys[curr]       = key_type();
+    if constexpr (!map_type::is_set) m_map.m_values[curr] = value_type();
+    m_map.m_tombstones.reset(curr);
+    m_map.m_available_indexes.reset(curr);
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(size_type i) const {
     const size_type invalid_index = map_type::invalid_index;
@@ -95,10 +366,8 @@ struct UnorderedMapErase {
 
     // remove erased head of the linked-list
     while (curr != invalid_index && !m_map.valid_at(curr)) {
-      next                     = m_map.m_next_index[curr];
-      m_map.m_next_index[curr] = invalid_index;
-      m_map.m_keys[curr]       = key_type();
-      if (m_map.is_set) m_map.m_values[curr] = value_type();
+      next = m_map.m_next_index[curr];
+      release(curr);
       curr                  = next;
       m_map.m_hash_lists(i) = next;
     }
@@ -115,9 +384,7 @@ struct UnorderedMapErase {
         } else {
           // remove curr from list
           m_map.m_next_index[prev] = next;
-          m_map.m_next_index[curr] = invalid_index;
-          m_map.m_keys[curr]       = key_type();
-          if (map_type::is_set) m_map.m_values[curr] = value_type();
+          release(curr);
         }
         curr = next;
       }
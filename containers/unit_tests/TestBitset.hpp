@@ -21,7 +21,10 @@
 #include <iostream>
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Bitset.hpp>
+#include <Kokkos_Bitset64.hpp>
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include <../../core/unit_test/tools/include/ToolTestingUtilities.hpp>
 
@@ -243,6 +246,122 @@ void test_bitset() {
 
 TEST(TEST_CATEGORY, bitset) { test_bitset<TEST_EXECSPACE>(); }
 
+// the bits set in a Bitset64, read with test() on the device
+template <typename Device>
+std::vector<bool> bitset64_bits(
+    Kokkos::Experimental::Bitset64<Device> const& bitset) {
+  using execution_space = typename Device::execution_space;
+  Kokkos::View<int*, Device> bits("bits", bitset.size());
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, bitset.size()),
+      KOKKOS_LAMBDA(size_t i) { bits(i) = bitset.test(i); });
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bits);
+  return std::vector<bool>(host.data(), host.data() + host.extent(0));
+}
+
+// the number of bits set, found by iterating over chunks of bits in parallel
+template <typename Device>
+size_t bitset64_iterate(Kokkos::Experimental::Bitset64<Device> const& bitset,
+                        size_t chunk) {
+  using execution_space = typename Device::execution_space;
+  size_t count          = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(
+          0, (bitset.size() + chunk - 1) / chunk),
+      KOKKOS_LAMBDA(size_t c, size_t & partial) {
+        const size_t end = Kokkos::min((c + 1) * chunk, bitset.size());
+        for (size_t i = bitset.find_next(c * chunk, end); i < end;
+             i      = bitset.find_next(i + 1, end)) {
+          if (!bitset.test(i)) Kokkos::abort("find_next found an unset bit");
+          ++partial;
+        }
+      },
+      count);
+  return count;
+}
+
+template <typename Device>
+void test_bitset64(size_t n) {
+  using execution_space = typename Device::execution_space;
+  using bitset_type     = Kokkos::Experimental::Bitset64<Device>;
+  bitset_type bitset(n);
+  ASSERT_EQ(bitset.size(), n);
+  ASSERT_EQ(bitset.count(), 0u);
+  ASSERT_EQ(bitset.find_first_set(), n);
+
+  // every third bit, starting at 2
+  size_t newly_set = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, n + 10),
+      KOKKOS_LAMBDA(size_t i, size_t & partial) {
+        if (i % 3 == 2 && bitset.set(i)) ++partial;
+      },
+      newly_set);
+  const size_t expected_count = n / 3;
+  ASSERT_EQ(newly_set, expected_count);
+  ASSERT_EQ(bitset.count(), expected_count);
+  ASSERT_EQ(bitset.find_first_set(), n > 2 ? 2 : n);
+  ASSERT_EQ(bitset64_iterate(bitset, 100), expected_count);
+  ASSERT_EQ(bitset64_iterate(bitset, 7), expected_count);
+
+  Kokkos::View<size_t*, Device> indices;
+  ASSERT_EQ(bitset.to_indices(execution_space(), indices), expected_count);
+  ASSERT_EQ(indices.extent(0), expected_count);
+  auto host_indices =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), indices);
+  for (size_t k = 0; k < expected_count; ++k) {
+    ASSERT_EQ(host_indices(k), 3 * k + 2);
+  }
+  // too large views are not reallocated
+  Kokkos::View<int*, Device> large("large", expected_count + 5);
+  ASSERT_EQ(bitset.to_indices(execution_space(), large), expected_count);
+  ASSERT_EQ(large.extent(0), expected_count + 5);
+
+  // ranges within a block, across blocks and past the end
+  std::vector<bool> expected(n);
+  for (size_t i = 2; i < n; i += 3) expected[i] = true;
+  const std::pair<size_t, size_t> set_ranges[] = {
+      {3, 5}, {60, 70}, {100, 300}, {n / 2, n + 100}, {5, 5}};
+  for (auto range : set_ranges) {
+    bitset.set(execution_space(), range.first, range.second);
+    for (size_t i = range.first; i < std::min(range.second, n); ++i) {
+      expected[i] = true;
+    }
+  }
+  bitset.reset(execution_space(), 64, 128);
+  for (size_t i = 64; i < std::min<size_t>(128, n); ++i) expected[i] = false;
+  ASSERT_EQ(bitset64_bits(bitset), expected);
+  const auto expected_set =
+      size_t(std::count(expected.begin(), expected.end(), true));
+  ASSERT_EQ(bitset.count(), expected_set);
+  ASSERT_EQ(bitset64_iterate(bitset, 64), expected_set);
+
+  bitset_type copy(n);
+  Kokkos::Experimental::deep_copy(copy, bitset);
+  ASSERT_EQ(bitset64_bits(copy), expected);
+
+  bitset.set();
+  ASSERT_EQ(bitset.count(), n);
+  ASSERT_EQ(bitset.find_first_set(), n > 0 ? 0 : n);
+  size_t newly_reset = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, n),
+      KOKKOS_LAMBDA(size_t i, size_t & partial) {
+        if (i % 2 == 0 && bitset.reset(i)) ++partial;
+      },
+      newly_reset);
+  ASSERT_EQ(newly_reset, (n + 1) / 2);
+  ASSERT_EQ(bitset.count(), n / 2);
+  bitset.reset();
+  ASSERT_EQ(bitset.count(), 0u);
+}
+
+TEST(TEST_CATEGORY, bitset64) {
+  for (size_t n : {0, 1, 2, 3, 63, 64, 65, 1000, 100003}) {
+    test_bitset64<TEST_EXECSPACE>(n);
+  }
+}
+
 TEST(TEST_CATEGORY, bitset_default_constructor_no_alloc) {
   using namespace Kokkos::Test::Tools;
   listen_tool_events(Config::DisableAll(), Config::EnableAllocs());
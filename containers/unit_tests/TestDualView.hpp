@@ -21,6 +21,10 @@
 #include <iostream>
 #include <cstdlib>
 #include <cstdio>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
 #include <Kokkos_Timer.hpp>
 #include <Kokkos_DualView.hpp>
 
@@ -776,6 +780,242 @@ TEST(TEST_CATEGORY, dualview_default_constructed) {
   dv.sync_device();
 }
 }  // anonymous namespace
+
+// Copies the blocks marked in a record of 1000 entries in blocks of 16 from
+// a host span into one on DstDevice and returns the copy.
+template <class DstDevice>
+std::vector<int> copy_dirty_blocks(
+    std::vector<std::pair<size_t, size_t>> const& ranges) {
+  using host_device =
+      Kokkos::Device<Kokkos::DefaultHostExecutionSpace, Kokkos::HostSpace>;
+  const size_t span = 1000;
+  Kokkos::View<int*, host_device> src("src", span);
+  for (size_t i = 0; i < span; ++i) src(i) = i + 1;
+  Kokkos::View<int*, DstDevice> dst("dst", span);
+
+  auto dirty = Kokkos::Impl::dual_view_create_dirty_blocks(span, 16);
+  for (auto range : ranges) {
+    Kokkos::Impl::dual_view_mark_dirty(dirty, range.first, range.second);
+  }
+  Kokkos::Impl::dual_view_copy_dirty_blocks<DstDevice, host_device>(
+      dst.data(), src.data(), dirty);
+
+  auto host_dst = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dst);
+  return std::vector<int>(host_dst.data(), host_dst.data() + span);
+}
+
+template <class DstDevice>
+void test_dualview_copy_dirty_blocks() {
+  // [5, 20) covers the blocks [0, 32), the last block is partial
+  const std::vector<std::pair<size_t, size_t>> ranges[] = {
+      {},
+      {{5, 20}},
+      {{5, 20}, {100, 101}, {990, 2000}},
+      {{0, 600}, {700, 701}},
+      {{17, 17}}};
+  const std::vector<std::pair<size_t, size_t>> copied[] = {
+      {},
+      {{0, 32}},
+      {{0, 32}, {96, 112}, {976, 1000}},
+      {{0, 1000}},
+      {}};
+  for (int k = 0; k < 5; ++k) {
+    auto dst = copy_dirty_blocks<DstDevice>(ranges[k]);
+    for (size_t i = 0; i < dst.size(); ++i) {
+      bool is_copied = false;
+      for (auto range : copied[k]) {
+        is_copied |= range.first <= i && i < range.second;
+      }
+      ASSERT_EQ(dst[i], is_copied ? int(i + 1) : 0) << k << ", " << i;
+    }
+  }
+}
+
+TEST(TEST_CATEGORY, dualview_copy_dirty_blocks) {
+  test_dualview_copy_dirty_blocks<
+      Kokkos::Device<Kokkos::DefaultHostExecutionSpace, Kokkos::HostSpace>>();
+  test_dualview_copy_dirty_blocks<typename TEST_EXECSPACE::device_type>();
+}
+
+// fills the entries [begin, end) of the first dimension on the device
+template <class ViewType>
+void fill_dualview_rows(ViewType const& view, size_t begin, size_t end,
+                        int value) {
+  using execution_space = typename ViewType::execution_space;
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(begin, end),
+      KOKKOS_LAMBDA(size_t i) {
+        for (size_t j = 0; j < view.extent(1); ++j) view(i, j) = value;
+      });
+  Kokkos::fence();
+}
+
+template <class Layout>
+void test_dualview_dirty_tracking() {
+  using dual_view_type = Kokkos::DualView<int**, Layout, TEST_EXECSPACE>;
+  const size_t n = 3000;
+  dual_view_type dv("dv", n, 3);
+  dv.enable_dirty_tracking(64);
+  // a DualView with a single device neither syncs nor tracks anything
+  const bool is_tracking = !dual_view_type::impl_dualview_is_single_device;
+  ASSERT_EQ(dv.is_tracking_dirty_blocks(), is_tracking);
+  auto h = dv.view_host();
+  auto d = dv.view_device();
+
+  Kokkos::deep_copy(h, 1);
+  dv.modify_host();
+  dv.sync_device();
+
+  // Written on the device without marking them, so only a full copy from
+  // the host overwrites them.
+  fill_dualview_rows(d, 0, 64, 7);
+
+  for (size_t i = 640; i < 700; ++i) {
+    for (size_t j = 0; j < 3; ++j) h(i, j) = 2;
+  }
+  dv.modify_host({640, 700});
+  dual_view_type sub(dv, std::make_pair(2000, 2100), Kokkos::ALL);
+  for (size_t i = 2010; i < 2020; ++i) {
+    for (size_t j = 0; j < 3; ++j) h(i, j) = 3;
+  }
+  sub.template modify<typename dual_view_type::t_host::memory_space>({10, 20});
+  ASSERT_EQ(dv.need_sync_device(), is_tracking);
+  dv.sync_device();
+  ASSERT_FALSE(dv.need_sync_device());
+
+  auto check = [&](auto const& view, size_t begin, size_t end, int value) {
+    auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+    for (size_t i = begin; i < end; ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        if (host(i, j) != value) return false;
+      }
+    }
+    return true;
+  };
+  // with LayoutLeft the rows cover most of the span, which is copied whole
+  if constexpr (std::is_same_v<Layout, Kokkos::LayoutRight>) {
+    ASSERT_TRUE(check(d, 0, 64, 7));
+  }
+  ASSERT_TRUE(check(d, 64, 640, 1));
+  ASSERT_TRUE(check(d, 640, 700, 2));
+  ASSERT_TRUE(check(d, 700, 2010, 1));
+  ASSERT_TRUE(check(d, 2010, 2020, 3));
+  ASSERT_TRUE(check(d, 2020, n, 1));
+
+  // and back from the device
+  fill_dualview_rows(d, 100, 110, 4);
+  dv.modify_device({100, 110});
+  dv.sync_host();
+  ASSERT_TRUE(check(h, 100, 110, 4));
+  ASSERT_TRUE(check(h, 640, 700, 2));
+
+  // a full modification after a partial one copies everything
+  fill_dualview_rows(d, 0, n, 5);
+  dv.modify_device({0, 1});
+  dv.modify_device();
+  dv.sync_host();
+  ASSERT_TRUE(check(h, 0, n, 5));
+
+  // the record follows reallocations
+  dv.realloc(n / 2, 3);
+  ASSERT_EQ(dv.is_tracking_dirty_blocks(), is_tracking);
+  fill_dualview_rows(dv.view_device(), 0, n / 2, 6);
+  dv.modify_device({0, n / 2});
+  dv.sync_host();
+  ASSERT_TRUE(check(dv.view_host(), 0, n / 2, 6));
+}
+
+TEST(TEST_CATEGORY, dualview_dirty_tracking) {
+  test_dualview_dirty_tracking<Kokkos::LayoutRight>();
+  test_dualview_dirty_tracking<Kokkos::LayoutLeft>();
+}
+
+template <class DualViewType>
+void fill_dualview_async(DualViewType const& dv, int value) {
+  auto d = dv.view_device();
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, d.extent(0)),
+      KOKKOS_LAMBDA(int i) { d(i) = value + i; });
+}
+
+inline std::atomic<int>& dualview_sync_async_fences() {
+  static std::atomic<int> count{0};
+  return count;
+}
+
+void test_dualview_sync_async() {
+  using dual_view_type = Kokkos::DualView<int*, TEST_EXECSPACE>;
+  const int n          = 10000;
+  dual_view_type dv("dv", n);
+  dual_view_type copy = dv;
+  // fences the DualView issues to wait for a sync_async, none when there is
+  // a single memory space and the syncs are no-ops
+  const int pending = dual_view_type::impl_dualview_is_single_device ? 0 : 1;
+  dualview_sync_async_fences() = 0;
+  Kokkos::Tools::Experimental::set_begin_fence_callback(
+      [](const char* name, const uint32_t, uint64_t*) {
+        if (std::string(name).find("DualView::sync_async") !=
+            std::string::npos)
+          ++dualview_sync_async_fences();
+      });
+
+  // host to device, submitting the kernel that reads the data right away
+  auto h = dv.view_host();
+  for (int i = 0; i < n; ++i) h(i) = i;
+  dv.modify_host();
+  TEST_EXECSPACE exec;
+  dv.sync_device_async(exec);
+  ASSERT_FALSE(dv.need_sync_device());
+  auto d = dv.view_device();
+  auto e = dv.view<typename dual_view_type::t_dev::device_type>();
+  Kokkos::View<int, TEST_EXECSPACE> errors("errors");
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(exec, 0, n),
+      KOKKOS_LAMBDA(int i) {
+        if (d(i) != i || e(i) != i) Kokkos::atomic_inc(&errors());
+      });
+  EXPECT_EQ(dualview_sync_async_fences(), 0);
+  int errors_h = 0;
+  Kokkos::deep_copy(exec, errors_h, errors);
+  exec.fence();
+  ASSERT_EQ(errors_h, 0);
+
+  // device to host, where only reading the host View waits, exactly once
+  // even when several host threads get it through copies
+  fill_dualview_async(dv, 5);
+  dv.modify_device();
+  // marking the data modified waits for the pending copy to the device
+  EXPECT_EQ(dualview_sync_async_fences(), pending);
+  dualview_sync_async_fences() = 0;
+  using host_device_type = typename dual_view_type::t_host::device_type;
+  dv.sync_async<host_device_type>(exec);
+  ASSERT_FALSE(copy.need_sync_host());
+  EXPECT_EQ(dualview_sync_async_fences(), 0);
+  std::vector<std::thread> threads;
+  std::atomic<int> host_errors{0};
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&host_errors, copy, n]() {
+      auto copy_h = copy.view_host();
+      for (int i = 0; i < n; ++i) host_errors += (copy_h(i) != 5 + i);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(host_errors, 0);
+  EXPECT_EQ(dualview_sync_async_fences(), pending);
+  auto copy_h = copy.view<host_device_type>();
+  ASSERT_EQ(copy_h(n - 1), 5 + n - 1);
+  EXPECT_EQ(dualview_sync_async_fences(), pending);
+
+  // nothing to do when both sides are in sync
+  dv.sync_host_async(exec);
+  dv.sync_device_async(exec);
+  ASSERT_FALSE(dv.need_sync_host());
+  ASSERT_FALSE(dv.need_sync_device());
+  Kokkos::Tools::Experimental::set_begin_fence_callback(nullptr);
+}
+
+TEST(TEST_CATEGORY, dualview_sync_async) { test_dualview_sync_async(); }
+
 }  // namespace Test
 
 #endif  // KOKKOS_TEST_DUALVIEW_HPP
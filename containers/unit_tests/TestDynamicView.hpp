@@ -283,6 +283,93 @@ TEST(TEST_CATEGORY, dynamic_view) {
   }
 }
 
+// Appends n entries in parallel and checks that every value ended up at the
+// index its push_back returned.
+template <class ExecSpace>
+void test_dynamic_view_push_back(
+    Kokkos::Experimental::DynamicView<int*, ExecSpace> const& view, int n,
+    int expected_appended) {
+  const size_t initial_size = view.size();
+  Kokkos::View<size_t*, ExecSpace> indices("indices", n);
+  int appended = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecSpace>(0, n),
+      KOKKOS_LAMBDA(int i, int& partial) {
+        indices(i) = view.push_back(i);
+        if (indices(i) != view.invalid_index) ++partial;
+      },
+      appended);
+  ASSERT_EQ(appended, expected_appended);
+  ASSERT_EQ(view.sync_extent(), initial_size + expected_appended);
+
+  auto flat = view.flatten(ExecSpace());
+  ASSERT_EQ(flat.extent(0), view.size());
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecSpace>(0, n),
+      KOKKOS_LAMBDA(int i, int& partial) {
+        const size_t k = indices(i);
+        if (k == view.invalid_index) return;
+        if (k < initial_size || flat(k) != i || view(k) != i) ++partial;
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+}
+
+// Appends blocks of three entries, each block holding consecutive values.
+template <class ExecSpace>
+void test_dynamic_view_grow_by(
+    Kokkos::Experimental::DynamicView<int*, ExecSpace> const& view, int n) {
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, n), KOKKOS_LAMBDA(int i) {
+        const size_t k = view.grow_by(3);
+        if (k == view.invalid_index) Kokkos::abort("grow_by failed");
+        for (int j = 0; j < 3; ++j) view(k + j) = 3 * i + j;
+      });
+  ASSERT_EQ(view.sync_extent(), size_t(3 * n));
+
+  auto flat = view.flatten();
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecSpace>(0, n),
+      KOKKOS_LAMBDA(int b, int& partial) {
+        if (flat(3 * b) % 3 != 0 || flat(3 * b + 1) != flat(3 * b) + 1 ||
+            flat(3 * b + 2) != flat(3 * b) + 2) {
+          ++partial;
+        }
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+}
+
+TEST(TEST_CATEGORY, dynamic_view_parallel_growth) {
+  using view_type = Kokkos::Experimental::DynamicView<int*, TEST_EXECSPACE>;
+
+  // chunks reserved up front can be filled on every backend
+  view_type reserved("reserved", 128, 51200);
+  reserved.reserve(51200);
+  ASSERT_EQ(reserved.size(), 0u);
+  test_dynamic_view_push_back(reserved, 30000, 30000);
+  test_dynamic_view_push_back(reserved, 30000, 21200);
+  ASSERT_EQ(reserved.size(), 51200u);
+
+  view_type blocks("blocks", 64, 3000);
+  blocks.reserve(3000);
+  test_dynamic_view_grow_by(blocks, 1000);
+
+  // host threads allocate the chunks themselves up to the maximum extent
+  if constexpr (Kokkos::SpaceAccessibility<
+                    Kokkos::HostSpace,
+                    typename TEST_EXECSPACE::memory_space>::accessible) {
+    view_type grown("grown", 128, 1000);
+    test_dynamic_view_push_back(grown, 2000, 1024);
+    ASSERT_EQ(grown.allocation_extent(), 1024u);
+    grown.resize_serial(10);
+    ASSERT_EQ(grown.allocation_extent(), 128u);
+    test_dynamic_view_push_back(grown, 100, 100);
+  }
+}
+
 }  // namespace Test
 
 #endif /* #ifndef KOKKOS_TEST_DYNAMICVIEW_HPP */
@@ -0,0 +1,170 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_ORDERED_MAP_HPP
+#define KOKKOS_TEST_ORDERED_MAP_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_OrderedMap.hpp>
+
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace Test {
+
+namespace Impl {
+
+// The keys and values at the indices, -1 for invalid indices
+template <typename MapType, typename IndicesView>
+auto gather_ordered_map_entries(MapType const &map,
+                                IndicesView const &indices) {
+  using execution_space = typename MapType::execution_space;
+  Kokkos::View<int *, typename MapType::device_type> keys("keys",
+                                                          indices.extent(0));
+  Kokkos::View<int *, typename MapType::device_type> values(
+      "values", indices.extent(0));
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, indices.extent(0)),
+      KOKKOS_LAMBDA(int i) {
+        const bool valid = map.valid_at(indices(i));
+        keys(i)          = valid ? map.key_at(indices(i)) : -1;
+        values(i)        = valid ? map.value_at(indices(i)) : -1;
+      });
+  return std::make_pair(
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, keys),
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, values));
+}
+
+template <typename Device>
+Kokkos::View<int *, Device> create_ordered_map_view(
+    std::vector<int> const &values) {
+  Kokkos::View<int *, Device> view("view", values.size());
+  Kokkos::deep_copy(view,
+                    Kokkos::View<const int *, Kokkos::HostSpace,
+                                 Kokkos::MemoryUnmanaged>(values.data(),
+                                                          values.size()));
+  return view;
+}
+
+// Compare the point and range queries with the reference for all the keys
+// in [-1, num_keys]
+template <typename MapType>
+void check_ordered_map(MapType const &map, std::map<int, int> const &ref,
+                       int num_keys) {
+  using device_type = typename MapType::device_type;
+  using index_view  = Kokkos::View<uint32_t *, device_type>;
+  ASSERT_EQ(ref.size(), map.size());
+
+  std::vector<int> queries;
+  for (int k = -1; k <= num_keys; ++k) queries.push_back(k);
+  index_view indices("indices", queries.size());
+  map.find_batch(typename MapType::execution_space{},
+                 create_ordered_map_view<device_type>(queries), indices);
+  auto found = gather_ordered_map_entries(map, indices);
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    const auto it = ref.find(queries[i]);
+    const int key = it == ref.end() ? -1 : it->first;
+    const int val = it == ref.end() ? -1 : it->second;
+    ASSERT_EQ(key, found.first(i)) << queries[i];
+    ASSERT_EQ(val, found.second(i)) << queries[i];
+  }
+
+  // ranges of all lengths, including empty and inverted ones
+  std::vector<int> lower;
+  std::vector<int> upper;
+  std::mt19937 gen(num_keys);
+  std::uniform_int_distribution<int> dist(-2, num_keys + 2);
+  for (int r = 0; r < 200; ++r) {
+    lower.push_back(dist(gen));
+    upper.push_back(r % 4 == 0 ? lower.back() + r : dist(gen));
+  }
+  auto lower_view = create_ordered_map_view<device_type>(lower);
+  auto upper_view = create_ordered_map_view<device_type>(upper);
+  index_view counts("counts", lower.size());
+  map.count_batch(typename MapType::execution_space{}, lower_view, upper_view,
+                  counts);
+  index_view offsets("offsets", lower.size() + 1);
+  index_view range_indices;
+  map.find_ranges(typename MapType::execution_space{}, lower_view, upper_view,
+                  offsets, range_indices);
+  auto counts_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                       counts);
+  auto offsets_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                       offsets);
+  auto in_range  = gather_ordered_map_entries(map, range_indices);
+  for (std::size_t r = 0; r < lower.size(); ++r) {
+    uint32_t pos = offsets_h(r);
+    if (lower[r] < upper[r]) {
+      for (auto it = ref.lower_bound(lower[r]);
+           it != ref.end() && it->first < upper[r]; ++it, ++pos) {
+        ASSERT_LT(pos, offsets_h(r + 1));
+        ASSERT_EQ(it->first, in_range.first(pos));
+        ASSERT_EQ(it->second, in_range.second(pos));
+      }
+    }
+    ASSERT_EQ(offsets_h(r + 1), pos) << lower[r] << ", " << upper[r];
+    ASSERT_EQ(offsets_h(r + 1) - offsets_h(r), counts_h(r));
+  }
+}
+
+}  // namespace Impl
+
+// The map is built from the first batch of random keys with duplicates and
+// the other batches are inserted, with the later values taking precedence.
+template <typename Device>
+void test_ordered_map(int num_keys, int build_size, int insert_size,
+                      int num_inserts) {
+  using map_type = Kokkos::Experimental::OrderedMap<int, int, Device>;
+  using execution_space = typename Device::execution_space;
+
+  map_type map;
+  std::map<int, int> ref;
+  std::mt19937 gen(num_keys + build_size);
+  std::uniform_int_distribution<int> dist(0, num_keys - 1);
+  for (int batch = 0; batch <= num_inserts; ++batch) {
+    std::vector<int> keys(batch == 0 ? build_size : insert_size);
+    std::vector<int> values(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      keys[i]      = dist(gen);
+      values[i]    = batch * build_size + i;
+      ref[keys[i]] = values[i];
+    }
+    auto keys_view   = Impl::create_ordered_map_view<Device>(keys);
+    auto values_view = Impl::create_ordered_map_view<Device>(values);
+    if (batch == 0) {
+      map.build(execution_space{}, keys_view, values_view);
+    } else {
+      map.insert(execution_space{}, keys_view, values_view);
+    }
+    Impl::check_ordered_map(map, ref, num_keys);
+  }
+
+  map.merge(execution_space{});
+  ASSERT_EQ(0u, map.num_pending());
+  Impl::check_ordered_map(map, ref, num_keys);
+}
+
+TEST(TEST_CATEGORY, OrderedMap) {
+  test_ordered_map<TEST_EXECSPACE>(10, 0, 5, 3);
+  test_ordered_map<TEST_EXECSPACE>(1000, 3000, 50, 10);
+  test_ordered_map<TEST_EXECSPACE>(100000, 70000, 1000, 6);
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_ORDERED_MAP_HPP
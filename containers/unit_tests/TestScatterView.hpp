@@ -20,6 +20,8 @@
 #include <Kokkos_ScatterView.hpp>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 namespace Test {
 
 template <typename DeviceType, typename Layout, typename Duplication,
@@ -674,6 +676,18 @@ struct TestDuplicatedScatterView {
         Kokkos::Experimental::ScatterNonAtomic, ScatterType, NumberType>
         test_sv_left_config;
     test_sv_left_config.run_test(n);
+    test_scatter_view_config<DeviceType, Kokkos::LayoutRight,
+                             Kokkos::Experimental::ScatterSparseDuplicated,
+                             Kokkos::Experimental::ScatterAtomic, ScatterType,
+                             NumberType>
+        test_sparse_right_config;
+    test_sparse_right_config.run_test(n);
+    test_scatter_view_config<DeviceType, Kokkos::LayoutLeft,
+                             Kokkos::Experimental::ScatterSparseDuplicated,
+                             Kokkos::Experimental::ScatterAtomic, ScatterType,
+                             NumberType>
+        test_sparse_left_config;
+    test_sparse_left_config.run_test(n);
   }
 };
 
@@ -797,6 +811,318 @@ TEST(TEST_CATEGORY, scatterview) {
   test_scatter_view<TEST_EXECSPACE, Kokkos::Experimental::ScatterMax>(big_n);
 }
 
+template <typename ExecSpace>
+void test_sparse_scatter_view(
+    Kokkos::Experimental::ScatterSparseConfig const& config, int n,
+    int touched, std::size_t min_duplicated, std::size_t max_duplicated) {
+  using scatter_view_type =
+      Kokkos::Experimental::ScatterView<int*, Kokkos::LayoutRight, ExecSpace,
+                                        Kokkos::Experimental::ScatterSum,
+                                        Kokkos::Experimental::
+                                            ScatterSparseDuplicated>;
+  Kokkos::View<int*, ExecSpace> original("original", n);
+  Kokkos::deep_copy(original, 1);
+  scatter_view_type scatter(original, config);
+
+  // every index i < touched receives i % 7 + 1 contributions of i
+  for (int pass = 0; pass < 2; ++pass) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecSpace>(0, 7 * touched),
+        KOKKOS_LAMBDA(int k) {
+          auto access = scatter.access();
+          const int i = k / 7;
+          if (k % 7 <= i % 7) access(i) += i;
+        });
+    std::size_t const duplicated = scatter.duplicated_blocks();
+    EXPECT_LE(min_duplicated, duplicated);
+    EXPECT_LE(duplicated, max_duplicated);
+    Kokkos::Experimental::contribute(original, scatter);
+    scatter.reset_except(original);
+    EXPECT_EQ(scatter.duplicated_blocks(), 0u);
+  }
+
+  auto host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), original);
+  for (int i = 0; i < n; ++i) {
+    int const expected = i < touched ? 1 + 2 * (i % 7 + 1) * i : 1;
+    ASSERT_EQ(host(i), expected) << "at index " << i;
+  }
+}
+
+TEST(TEST_CATEGORY, scatterview_sparse) {
+#ifdef KOKKOS_ENABLE_CUDA
+  // UniqueToken does not support the duplicated ScatterViews with CUDA
+  if (std::is_same_v<TEST_EXECSPACE, Kokkos::Cuda>) GTEST_SKIP();
+#endif
+  Kokkos::Experimental::ScatterSparseConfig config;
+  config.block_size = 64;
+
+  // a thread duplicates every block it touches, only the touched blocks
+  // are duplicated and reduced
+  test_sparse_scatter_view<TEST_EXECSPACE>(config, 100000, 1000, 16,
+                                           16 * TEST_EXECSPACE().concurrency());
+
+  // no more than one copy of a block on average, the rest goes to the
+  // target with atomics
+  config.max_copies = 0.01;
+  test_sparse_scatter_view<TEST_EXECSPACE>(config, 100000, 100000, 16, 16);
+
+  // the blocks are only duplicated after three contributions from a thread
+  config.max_copies       = 2.0;
+  config.atomic_threshold = 1000;
+  test_sparse_scatter_view<TEST_EXECSPACE>(config, 10000, 5000, 0, 0);
+  config.atomic_threshold = 3;
+  test_sparse_scatter_view<TEST_EXECSPACE>(config, 10000, 5000, 1,
+                                           2 * 157);
+}
+
+template <typename ScatterType, typename ViewType>
+void fill_scatter_view_rows(ScatterType const& scatter, ViewType const& view) {
+  using execution_space = typename ViewType::execution_space;
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, view.extent(0)),
+      KOKKOS_LAMBDA(int i) {
+        auto access = scatter.access();
+        for (int j = 0; j < 3; ++j) access(i, j) += i + j;
+      });
+}
+
+template <typename ViewType>
+void check_scatter_view_rows(ViewType const& view, int factor,
+                             std::pair<size_t, size_t> rows) {
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+  for (size_t i = 0; i < host.extent(0); ++i) {
+    for (int j = 0; j < 3; ++j) {
+      double const expected =
+          rows.first <= i && i < rows.second ? factor * double(i + j) : 0;
+      ASSERT_EQ(host(i, j), expected) << "at " << i << ", " << j;
+    }
+  }
+}
+
+template <typename ExecSpace, typename Layout, typename Duplication,
+          typename Contribution>
+void test_scatter_view_contribute_and_reset(size_t n) {
+  using view_type = Kokkos::View<double* [3], Layout, ExecSpace>;
+  using scatter_type =
+      Kokkos::Experimental::ScatterView<double* [3], Layout, ExecSpace,
+                                        Kokkos::Experimental::ScatterSum,
+                                        Duplication, Contribution>;
+  view_type original("original", n);
+  scatter_type scatter(original);
+  fill_scatter_view_rows(scatter, original);
+
+  std::pair<size_t, size_t> rows(n / 4, n / 2);
+  view_type partial("partial", n);
+  Kokkos::Experimental::contribute(partial, scatter, rows);
+  check_scatter_view_rows(partial, 1, rows);
+
+  Kokkos::Experimental::contribute_and_reset(original, scatter);
+  check_scatter_view_rows(original, 1, {0, n});
+  fill_scatter_view_rows(scatter, original);
+  Kokkos::Experimental::contribute_and_reset(original, scatter);
+  check_scatter_view_rows(original, 2, {0, n});
+}
+
+template <typename ExecSpace>
+void test_scatter_view_reduce_by_domain(size_t copies, size_t domains,
+                                        bool into_first) {
+  using reduce_type =
+      Kokkos::Impl::Experimental::ContributeAndResetByDomain<
+          ExecSpace, double, Kokkos::Experimental::ScatterSum>;
+  const size_t n = 1000;
+  Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace> duplicates(
+      "duplicates", copies, n);
+  Kokkos::View<double*, ExecSpace> separate("separate", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, copies * n), KOKKOS_LAMBDA(int k) {
+        duplicates(k / n, k % n) = k / n + k % n;
+      });
+  double* dest = into_first ? duplicates.data() : separate.data();
+  reduce_type(ExecSpace(), duplicates.data(), dest, n, into_first ? 1 : 0,
+              copies, domains, "test");
+
+  auto host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), duplicates);
+  auto host_separate =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), separate);
+  for (size_t i = 0; i < n; ++i) {
+    double const result = into_first ? host(0, i) : host_separate(i);
+    ASSERT_EQ(result, double(copies * i + copies * (copies - 1) / 2));
+    for (size_t c = into_first ? 1 : 0; c < copies; ++c) {
+      ASSERT_EQ(host(c, i), 0.) << "copy " << c << " at " << i;
+    }
+  }
+}
+
+TEST(TEST_CATEGORY, scatterview_contribute_and_reset) {
+  using namespace Kokkos::Experimental;
+  for (size_t copies : {1, 2, 5, 16}) {
+    for (size_t domains : {1, 2, 3, 4}) {
+      test_scatter_view_reduce_by_domain<TEST_EXECSPACE>(copies, domains,
+                                                         false);
+      test_scatter_view_reduce_by_domain<TEST_EXECSPACE>(copies, domains,
+                                                         true);
+    }
+  }
+
+  for (size_t n : {0, 1, 13, 1000}) {
+    if (TEST_EXECSPACE().concurrency() == 1) {
+      test_scatter_view_contribute_and_reset<
+          TEST_EXECSPACE, Kokkos::LayoutRight, ScatterNonDuplicated,
+          ScatterNonAtomic>(n);
+    }
+    test_scatter_view_contribute_and_reset<TEST_EXECSPACE, Kokkos::LayoutLeft,
+                                           ScatterNonDuplicated,
+                                           ScatterAtomic>(n);
+  }
+
+#ifdef KOKKOS_ENABLE_CUDA
+  // UniqueToken does not support the duplicated ScatterViews with CUDA
+  if (std::is_same_v<TEST_EXECSPACE, Kokkos::Cuda>) GTEST_SKIP();
+#endif
+  for (size_t n : {0, 1, 13, 1000}) {
+    test_scatter_view_contribute_and_reset<
+        TEST_EXECSPACE, Kokkos::LayoutRight, ScatterDuplicated,
+        ScatterNonAtomic>(n);
+    test_scatter_view_contribute_and_reset<TEST_EXECSPACE, Kokkos::LayoutLeft,
+                                           ScatterDuplicated,
+                                           ScatterNonAtomic>(n);
+    test_scatter_view_contribute_and_reset<
+        TEST_EXECSPACE, Kokkos::LayoutRight, ScatterSparseDuplicated,
+        ScatterAtomic>(n);
+    test_scatter_view_contribute_and_reset<
+        TEST_EXECSPACE, Kokkos::LayoutLeft, ScatterSparseDuplicated,
+        ScatterAtomic>(n);
+  }
+}
+
+// the smallest value with the smallest index, packed in 8 bytes so that
+// ScatterAtomic can use a compare-and-swap loop
+struct ScatterMinLoc {
+  struct alignas(8) value_type {
+    float value;
+    int index;
+  };
+  KOKKOS_FUNCTION static void join(value_type& dest, value_type const& src) {
+    if (src.value < dest.value ||
+        (src.value == dest.value && src.index < dest.index)) {
+      dest = src;
+    }
+  }
+  KOKKOS_FUNCTION static void init(value_type& value) {
+    value = {Kokkos::Experimental::finite_max_v<float>,
+             Kokkos::Experimental::finite_max_v<int>};
+  }
+  KOKKOS_FUNCTION static value_type generate(int i) {
+    return {float((i * 7919) % 1000), i};
+  }
+  static bool equal(value_type const& a, value_type const& b) {
+    return a.value == b.value && a.index == b.index;
+  }
+};
+
+struct ScatterBitOr {
+  using value_type = unsigned;
+  KOKKOS_FUNCTION static void join(unsigned& dest, unsigned const& src) {
+    dest |= src;
+  }
+  KOKKOS_FUNCTION static void atomic_join(unsigned& dest,
+                                          unsigned const& src) {
+    Kokkos::atomic_or(&dest, src);
+  }
+  KOKKOS_FUNCTION static void init(unsigned& value) { value = 0; }
+  KOKKOS_FUNCTION static unsigned generate(int i) { return 1u << (i % 32); }
+  static bool equal(unsigned a, unsigned b) { return a == b; }
+};
+
+// the predefined sum on compound values
+template <typename ValueType>
+struct ScatterCompoundSum {
+  using value_type = ValueType;
+  using components = Kokkos::Impl::Experimental::ScatterComponents<ValueType>;
+  static void join(value_type& dest, value_type const& src) {
+    for (int c = 0; c < components::size; ++c) {
+      components::get(dest, c) += components::get(src, c);
+    }
+  }
+  static void init(value_type& value) {
+    for (int c = 0; c < components::size; ++c) components::get(value, c) = 0;
+  }
+  KOKKOS_FUNCTION static value_type generate(int i) {
+    value_type value{};
+    for (int c = 0; c < components::size; ++c) {
+      components::get(value, c) = (i + c) % 7 - 3;
+    }
+    return value;
+  }
+  static bool equal(value_type const& a, value_type const& b) {
+    for (int c = 0; c < components::size; ++c) {
+      if (components::get(a, c) != components::get(b, c)) return false;
+    }
+    return true;
+  }
+};
+
+template <typename ExecSpace, typename Op, typename Policy,
+          typename Duplication, typename Contribution>
+void test_scatter_view_op_config(int n, int m) {
+  using value_type = typename Policy::value_type;
+  Kokkos::View<value_type*, ExecSpace> target("target", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, n), KOKKOS_LAMBDA(int i) {
+        Kokkos::Impl::Experimental::ScatterValue<
+            value_type, Op, ExecSpace, Kokkos::Experimental::ScatterNonAtomic>(
+            target(i))
+            .reset();
+      });
+  Kokkos::Experimental::ScatterView<value_type*, Kokkos::LayoutRight,
+                                    ExecSpace, Op, Duplication, Contribution>
+      scatter(target);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, m), KOKKOS_LAMBDA(int i) {
+        auto access = scatter.access();
+        access(i % n).update(Policy::generate(i));
+      });
+  Kokkos::Experimental::contribute(target, scatter);
+
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), target);
+  std::vector<value_type> expected(n);
+  for (auto& value : expected) Policy::init(value);
+  for (int i = 0; i < m; ++i) {
+    Policy::join(expected[i % n], Policy::generate(i));
+  }
+  for (int i = 0; i < n; ++i) {
+    ASSERT_TRUE(Policy::equal(host(i), expected[i])) << "at index " << i;
+  }
+}
+
+template <typename ExecSpace, typename Op, typename Policy = Op>
+void test_scatter_view_op(int n, int m) {
+  using namespace Kokkos::Experimental;
+  test_scatter_view_op_config<ExecSpace, Op, Policy, ScatterNonDuplicated,
+                              ScatterAtomic>(n, m);
+#ifdef KOKKOS_ENABLE_CUDA
+  if (std::is_same_v<ExecSpace, Kokkos::Cuda>) return;
+#endif
+  test_scatter_view_op_config<ExecSpace, Op, Policy, ScatterDuplicated,
+                              ScatterNonAtomic>(n, m);
+  test_scatter_view_op_config<ExecSpace, Op, Policy, ScatterSparseDuplicated,
+                              ScatterAtomic>(n, m);
+}
+
+TEST(TEST_CATEGORY, scatterview_custom_op) {
+  using Kokkos::Experimental::ScatterSum;
+  test_scatter_view_op<TEST_EXECSPACE, ScatterMinLoc>(100, 100000);
+  test_scatter_view_op<TEST_EXECSPACE, ScatterBitOr>(100, 100000);
+  test_scatter_view_op<TEST_EXECSPACE, ScatterSum,
+                       ScatterCompoundSum<Kokkos::complex<double>>>(100,
+                                                                    100000);
+  test_scatter_view_op<TEST_EXECSPACE, ScatterSum,
+                       ScatterCompoundSum<Kokkos::Array<double, 3>>>(100,
+                                                                     100000);
+}
+
 TEST(TEST_CATEGORY, scatterview_devicetype) {
   using device_type =
       Kokkos::Device<TEST_EXECSPACE, typename TEST_EXECSPACE::memory_space>;
@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
 #include <vector>
 
 #define KOKKOS_IMPL_DO_NOT_WARN_INCLUDE_STATIC_CRS_GRAPH
@@ -249,6 +251,48 @@ void run_test_graph4() {
                               Kokkos::MemoryUnmanaged>));
 }
 
+template <class Space>
+void run_test_graph_from_coo(size_t nrows, size_t nnz, bool sort_and_merge) {
+  using dView = Kokkos::StaticCrsGraph<int, Space>;
+
+  // few columns per row, so that some edges are repeated
+  std::mt19937 gen(nrows + nnz);
+  std::uniform_int_distribution<size_t> row_dist(0, nrows ? nrows - 1 : 0);
+  std::uniform_int_distribution<int> col_dist(0, 20);
+  Kokkos::View<int*, Space> rows("rows", nnz);
+  Kokkos::View<int*, Space> cols("cols", nnz);
+  auto h_rows = Kokkos::create_mirror_view(rows);
+  auto h_cols = Kokkos::create_mirror_view(cols);
+  std::vector<std::vector<int> > expected(nrows);
+  for (size_t i = 0; i < nnz; ++i) {
+    h_rows(i) = row_dist(gen);
+    h_cols(i) = col_dist(gen);
+    expected[h_rows(i)].push_back(h_cols(i));
+  }
+  Kokkos::deep_copy(rows, h_rows);
+  Kokkos::deep_copy(cols, h_cols);
+  for (auto& row : expected) {
+    std::sort(row.begin(), row.end());
+    if (sort_and_merge) {
+      row.erase(std::unique(row.begin(), row.end()), row.end());
+    }
+  }
+
+  dView dx = Kokkos::create_staticcrsgraph_from_coo<dView>(
+      typename Space::execution_space(), rows, cols, nrows, sort_and_merge);
+  auto hx = Kokkos::create_mirror(dx);
+
+  ASSERT_EQ(hx.numRows(), nrows);
+  ASSERT_EQ(hx.row_map(0), 0u);
+  for (size_t i = 0; i < nrows; ++i) {
+    std::vector<int> row(hx.entries.data() + hx.row_map(i),
+                         hx.entries.data() + hx.row_map(i + 1));
+    if (!sort_and_merge) std::sort(row.begin(), row.end());
+    ASSERT_EQ(row, expected[i]) << "row " << i;
+  }
+  ASSERT_EQ(hx.entries.extent(0), hx.row_map(nrows));
+}
+
 } /* namespace TestStaticCrsGraph */
 
 TEST(TEST_CATEGORY, staticcrsgraph) {
@@ -268,4 +312,18 @@ TEST(TEST_CATEGORY, staticcrsgraph) {
   TestStaticCrsGraph::run_test_graph3<TEST_EXECSPACE>(75, 100000);
   TestStaticCrsGraph::run_test_graph4<TEST_EXECSPACE>();
 }
+
+TEST(TEST_CATEGORY, staticcrsgraph_from_coo) {
+  for (bool sort_and_merge : {false, true}) {
+    TestStaticCrsGraph::run_test_graph_from_coo<TEST_EXECSPACE>(
+        0, 0, sort_and_merge);
+    TestStaticCrsGraph::run_test_graph_from_coo<TEST_EXECSPACE>(
+        1, 100, sort_and_merge);
+    // short rows are sorted by insertion, long ones by heap sort
+    TestStaticCrsGraph::run_test_graph_from_coo<TEST_EXECSPACE>(
+        1000, 10, sort_and_merge);
+    TestStaticCrsGraph::run_test_graph_from_coo<TEST_EXECSPACE>(
+        1000, 50000, sort_and_merge);
+  }
+}
 }  // namespace Test
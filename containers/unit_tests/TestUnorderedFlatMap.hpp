@@ -0,0 +1,213 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_UNORDERED_FLAT_MAP_HPP
+#define KOKKOS_TEST_UNORDERED_FLAT_MAP_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_UnorderedFlatMap.hpp>
+
+namespace Test {
+
+namespace Impl {
+
+// Insert keys with duplicates; with Erase every other key inserted is erased
+// again in the same kernel.
+template <typename MapType, bool Erase = false>
+struct TestFlatMapInsert {
+  using map_type        = MapType;
+  using execution_space = typename map_type::execution_space;
+  using value_type      = uint32_t;
+
+  map_type m_map;
+  uint32_t m_num_inserts;
+  uint32_t m_num_duplicates;
+
+  TestFlatMapInsert(map_type map, uint32_t num_inserts,
+                    uint32_t num_duplicates)
+      : m_map(map),
+        m_num_inserts(num_inserts),
+        m_num_duplicates(num_duplicates) {}
+
+  uint32_t testit() {
+    uint32_t failed_count = 0;
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<execution_space>(
+                                0, m_num_inserts),
+                            *this, failed_count);
+    return failed_count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(uint32_t i, value_type &failed_count) const {
+    const uint32_t key = i / m_num_duplicates;
+    if (m_map.insert(key, key + 1).failed()) ++failed_count;
+    if (Erase && key % 2 == 1) m_map.erase(key);
+  }
+};
+
+// Count the keys in [0, m_max_key + 10) for which the map disagrees with
+// the expected content
+template <typename MapType>
+struct TestFlatMapFind {
+  using map_type        = MapType;
+  using execution_space = typename map_type::execution_space;
+  using value_type      = uint32_t;
+
+  map_type m_map;
+  uint32_t m_max_key;
+  uint32_t m_stride;
+
+  TestFlatMapFind(map_type map, uint32_t max_key, uint32_t stride)
+      : m_map(map), m_max_key(max_key), m_stride(stride) {}
+
+  uint32_t testit() {
+    uint32_t errors = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<execution_space>(0, m_max_key + 10), *this,
+        errors);
+    return errors;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(uint32_t key, value_type &errors) const {
+    const bool expected = key < m_max_key && key % m_stride == 0;
+    const uint32_t i    = m_map.find(key);
+    if (expected != m_map.valid_at(i)) ++errors;
+    if (expected != m_map.exists(key)) ++errors;
+    if (expected &&
+        (m_map.key_at(i) != key || m_map.value_at(i) != key + 1)) {
+      ++errors;
+    }
+  }
+};
+
+}  // namespace Impl
+
+template <typename Device>
+void test_flat_map_insert(uint32_t num_inserts, uint32_t num_duplicates) {
+  using map_type       = Kokkos::Experimental::UnorderedFlatMap<uint32_t,
+                                                          uint32_t, Device>;
+  using const_map_type =
+      Kokkos::Experimental::UnorderedFlatMap<const uint32_t, const uint32_t,
+                                             Device>;
+
+  const uint32_t num_keys =
+      (num_inserts + num_duplicates - 1) / num_duplicates;
+
+  // start way too small to go through a rehash
+  map_type map(num_keys / 16);
+  uint32_t failed_count = 0;
+  while ((failed_count = Impl::TestFlatMapInsert<map_type>(
+              map, num_inserts, num_duplicates)
+                             .testit()) > 0) {
+    ASSERT_TRUE(map.failed_insert());
+    map.rehash(map.capacity() + failed_count);
+  }
+  ASSERT_EQ(num_keys, map.size());
+
+  const_map_type cmap = map;
+  EXPECT_EQ(0u, Impl::TestFlatMapFind<const_map_type>(cmap, num_keys, 1)
+                    .testit());
+
+  // erasing all the odd keys leaves their slots deleted until the rehash,
+  // a key inserted again after it was erased takes up a new slot
+  map_type emap(num_inserts);
+  Impl::TestFlatMapInsert<map_type, true> insert_and_erase(emap, num_inserts,
+                                                           num_duplicates);
+  ASSERT_EQ(0u, insert_and_erase.testit());
+  ASSERT_FALSE(emap.failed_insert());
+  EXPECT_EQ((num_keys + 1) / 2, emap.size());
+  EXPECT_EQ(0u, Impl::TestFlatMapFind<map_type>(emap, num_keys, 2).testit());
+  emap.rehash();
+  EXPECT_EQ((num_keys + 1) / 2, emap.size());
+  EXPECT_EQ(0u, Impl::TestFlatMapFind<map_type>(emap, num_keys, 2).testit());
+}
+
+TEST(TEST_CATEGORY, UnorderedFlatMap_insert) {
+  test_flat_map_insert<TEST_EXECSPACE>(100000, 1);
+  test_flat_map_insert<TEST_EXECSPACE>(100000, 7);
+  test_flat_map_insert<TEST_EXECSPACE>(1000, 100);
+}
+
+TEST(TEST_CATEGORY, UnorderedFlatMap_failed_insert) {
+  using map_type =
+      Kokkos::Experimental::UnorderedFlatMap<uint32_t, uint32_t,
+                                             TEST_EXECSPACE>;
+
+  map_type map(1000);
+  EXPECT_LT(0u, Impl::TestFlatMapInsert<map_type>(map, 2 * map.capacity(), 1)
+                    .testit());
+  EXPECT_TRUE(map.failed_insert());
+  EXPECT_LE(map.size(), map.capacity());
+
+  map.reset_failed_insert_flag();
+  EXPECT_FALSE(map.failed_insert());
+}
+
+template <typename Device>
+void test_flat_map_atomic_add(uint32_t num_keys, uint32_t num_duplicates) {
+  using map_type = Kokkos::Experimental::UnorderedFlatMap<uint32_t, uint32_t,
+                                                          Device>;
+  using atomic_add_type = typename Kokkos::UnorderedMapInsertOpTypes<
+      Kokkos::View<uint32_t *, Device>, uint32_t>::AtomicAdd;
+
+  map_type map(num_keys);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<typename Device::execution_space>(
+          0, num_keys * num_duplicates),
+      KOKKOS_LAMBDA(uint32_t i) {
+        map.insert(i % num_keys, 1, atomic_add_type());
+      });
+
+  auto hmap = Kokkos::create_mirror(map);
+  Kokkos::deep_copy(hmap, map);
+  ASSERT_EQ(num_keys, hmap.size());
+  for (uint32_t key = 0; key < num_keys; ++key) {
+    const uint32_t i = hmap.find(key);
+    ASSERT_TRUE(hmap.valid_at(i));
+    EXPECT_EQ(num_duplicates, hmap.value_at(i));
+  }
+}
+
+template <typename Device>
+void test_flat_map_set() {
+  using set_type = Kokkos::Experimental::UnorderedFlatMap<int, void, Device>;
+
+  set_type set(11);
+  ASSERT_EQ(0u, set.size());
+  ASSERT_EQ(128u, set.capacity());
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<typename Device::execution_space>(0, 100),
+      KOKKOS_LAMBDA(int i) { set.insert(i % 4); });
+  ASSERT_EQ(4u, set.size());
+
+  set.clear();
+  ASSERT_EQ(0u, set.size());
+  ASSERT_TRUE(set.is_allocated());
+}
+
+TEST(TEST_CATEGORY, UnorderedFlatMap_atomic_add) {
+  test_flat_map_atomic_add<TEST_EXECSPACE>(1000, 10);
+}
+
+TEST(TEST_CATEGORY, UnorderedFlatMap_set) {
+  test_flat_map_set<TEST_EXECSPACE>();
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_UNORDERED_FLAT_MAP_HPP
@@ -560,6 +560,274 @@ TEST(TEST_CATEGORY, UnorderedMap_constructor_view_alloc) {
   ASSERT_TRUE(map.is_allocated());
 }
 
+template <typename Device>
+void test_bulk_insert(uint32_t num_keys, uint32_t num_duplicates,
+                      uint32_t capacity_hint) {
+  using execution_space = typename Device::execution_space;
+  using map_type        = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using set_type        = Kokkos::UnorderedMap<uint32_t, void, Device>;
+  using atomic_add_type = typename Kokkos::UnorderedMapInsertOpTypes<
+      Kokkos::View<uint32_t *, Device>, uint32_t>::AtomicAdd;
+
+  const uint32_t n = num_keys * num_duplicates;
+  Kokkos::View<uint32_t *, Device> keys("keys", n);
+  Kokkos::View<uint32_t *, Device> values("values", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, n), KOKKOS_LAMBDA(uint32_t i) {
+        keys(i)   = 7 * (i % num_keys);
+        values(i) = i % num_keys;
+      });
+
+  map_type map(capacity_hint);
+  map.bulk_insert(execution_space{}, keys, values);
+  ASSERT_FALSE(map.failed_insert());
+  ASSERT_EQ(num_keys, map.size());
+
+  // the values of the keys inserted again are added to the existing ones
+  map.bulk_insert(execution_space{}, keys, values, atomic_add_type());
+  ASSERT_EQ(num_keys, map.size());
+
+  uint32_t errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t key, uint32_t &err) {
+        const uint32_t i = map.find(7 * key);
+        if (!map.valid_at(i) ||
+            map.value_at(i) != key * (num_duplicates + 1)) {
+          ++err;
+        }
+      },
+      errors);
+  EXPECT_EQ(0u, errors);
+
+  set_type set(capacity_hint);
+  set.bulk_insert(execution_space{}, keys);
+  ASSERT_EQ(num_keys, set.size());
+}
+
+// Count the keys in [0, num_keys) whose presence in the map or value is
+// wrong, when the odd keys are erased or not
+template <typename MapType>
+uint32_t count_insert_and_erase_errors(MapType const &map, uint32_t num_keys,
+                                       bool odd_erased) {
+  uint32_t errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<typename MapType::execution_space>(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t key, uint32_t &err) {
+        const uint32_t i  = map.find(key);
+        const bool exists = !(odd_erased && key % 2 == 1);
+        if (exists && (!map.valid_at(i) || map.value_at(i) != key)) ++err;
+        if (!exists && map.exists(key)) ++err;
+      },
+      errors);
+  return errors;
+}
+
+template <typename Device>
+void test_insert_and_erase(uint32_t num_keys) {
+  using execution_space = typename Device::execution_space;
+  using map_type        = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using range_policy    = Kokkos::RangePolicy<execution_space>;
+
+  const uint32_t num_odd = num_keys / 2;
+
+  map_type map(num_keys);
+  // every thread inserts its key and erases the odd key before it, which
+  // may not have been inserted yet
+  Kokkos::parallel_for(
+      range_policy(0, num_keys), KOKKOS_LAMBDA(uint32_t i) {
+        map.insert(i, i);
+        if (i % 2 == 0 && i > 0) map.erase(i - 1);
+      });
+  ASSERT_FALSE(map.failed_insert());
+
+  uint32_t survived = 0;
+  Kokkos::parallel_reduce(
+      range_policy(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t key, uint32_t &count) {
+        if (key % 2 == 1 && map.exists(key)) ++count;
+      },
+      survived);
+  EXPECT_EQ(num_keys - num_odd + survived, map.size());
+
+  // erasing the rest and inserting them again reuses their entries
+  Kokkos::parallel_for(
+      range_policy(0, num_keys), KOKKOS_LAMBDA(uint32_t i) {
+        if (i % 2 == 1) map.erase(i);
+      });
+  EXPECT_EQ(num_keys - num_odd, map.size());
+  EXPECT_EQ(0u, count_insert_and_erase_errors(map, num_keys, true));
+
+  uint32_t inserted = 0;
+  Kokkos::parallel_reduce(
+      range_policy(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t i, uint32_t &count) {
+        if (i % 2 == 1 && map.insert(i, i).success()) ++count;
+      },
+      inserted);
+  EXPECT_EQ(num_odd, inserted);
+  EXPECT_EQ(num_keys, map.size());
+  EXPECT_EQ(0u, count_insert_and_erase_errors(map, num_keys, false));
+
+  // both the rehash and the erase phase reclaim the erased entries
+  Kokkos::parallel_for(
+      range_policy(0, num_keys), KOKKOS_LAMBDA(uint32_t i) {
+        if (i % 2 == 1) map.erase(i);
+      });
+  map.rehash(map.capacity());
+  EXPECT_EQ(num_keys - num_odd, map.size());
+  EXPECT_EQ(0u, count_insert_and_erase_errors(map, num_keys, true));
+
+  map.begin_erase();
+  Kokkos::parallel_for(
+      range_policy(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t i) { map.erase(i); });
+  map.end_erase();
+  EXPECT_EQ(0u, map.size());
+  Kokkos::parallel_for(
+      range_policy(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t i) { map.insert(i, i); });
+  EXPECT_FALSE(map.failed_insert());
+  EXPECT_EQ(0u, count_insert_and_erase_errors(map, num_keys, false));
+}
+
+// Many threads insert each erased key again and add up their values, while
+// others read them: the value of the first insert is never lost or seen
+// before it is written.
+template <typename Device>
+void test_revive_with_atomic_add(uint32_t num_keys, uint32_t num_inserts) {
+  using execution_space = typename Device::execution_space;
+  using map_type        = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using range_policy    = Kokkos::RangePolicy<execution_space>;
+  using atomic_add_type = typename Kokkos::UnorderedMapInsertOpTypes<
+      Kokkos::View<uint32_t *, Device>, uint32_t>::AtomicAdd;
+  const uint32_t stale_value = 1u << 30;
+
+  map_type map(num_keys);
+  for (int round = 0; round < 3; ++round) {
+    Kokkos::parallel_for(
+        range_policy(0, num_keys),
+        KOKKOS_LAMBDA(uint32_t i) { map.insert(i, stale_value); });
+    Kokkos::parallel_for(
+        range_policy(0, num_keys), KOKKOS_LAMBDA(uint32_t i) {
+          if (!map.erase(i)) Kokkos::abort("key not erased");
+        });
+    ASSERT_EQ(0u, map.size());
+
+    uint32_t stale = 0;
+    Kokkos::parallel_reduce(
+        range_policy(0, num_inserts),
+        KOKKOS_LAMBDA(uint32_t i, uint32_t &err) {
+          const uint32_t key = i % num_keys;
+          if ((i / num_keys) % 4 == 3) {
+            // a live entry never shows the value from before the erase
+            const uint32_t index = map.find(key);
+            if (map.valid_at(index) && map.value_at(index) >= stale_value)
+              ++err;
+          } else {
+            map.insert(key, 1, atomic_add_type());
+          }
+        },
+        stale);
+    ASSERT_FALSE(map.failed_insert());
+    EXPECT_EQ(0u, stale);
+    ASSERT_EQ(num_keys, map.size());
+
+    uint32_t errors = 0;
+    Kokkos::parallel_reduce(
+        range_policy(0, num_keys),
+        KOKKOS_LAMBDA(uint32_t key, uint32_t &err) {
+          uint32_t expected = 0;
+          for (uint32_t i = key; i < num_inserts; i += num_keys) {
+            if ((i / num_keys) % 4 != 3) ++expected;
+          }
+          const uint32_t index = map.find(key);
+          if (!map.valid_at(index) || map.value_at(index) != expected) ++err;
+        },
+        errors);
+    EXPECT_EQ(0u, errors);
+
+    Kokkos::parallel_for(
+        range_policy(0, num_keys), KOKKOS_LAMBDA(uint32_t i) { map.erase(i); });
+  }
+}
+
+template <typename Device>
+void test_find_batch(uint32_t num_keys, uint32_t num_queries) {
+  using execution_space = typename Device::execution_space;
+  using map_type        = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using range_policy    = Kokkos::RangePolicy<execution_space>;
+  using team_policy     = Kokkos::TeamPolicy<execution_space>;
+  using member_type     = typename team_policy::member_type;
+
+  // the keys are the multiples of 3, half of the queries miss
+  map_type map(num_keys);
+  Kokkos::parallel_for(
+      range_policy(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t i) { map.insert(3 * i, i); });
+  Kokkos::View<uint32_t *, Device> queries("queries", num_queries);
+  Kokkos::parallel_for(
+      range_policy(0, num_queries), KOKKOS_LAMBDA(uint32_t i) {
+        queries(i) = (i * 7919u) % (6 * num_keys + 1);
+      });
+
+  Kokkos::View<uint32_t *, Device> indices("indices", num_queries);
+  map.find_batch(execution_space{}, queries, indices);
+
+  // the team version looks up a chunk of the queries per team
+  constexpr uint32_t chunk = 100;
+  Kokkos::View<uint32_t *, Device> team_indices("team_indices", num_queries);
+  Kokkos::parallel_for(
+      team_policy((num_queries + chunk - 1) / chunk, Kokkos::AUTO),
+      KOKKOS_LAMBDA(member_type const &team) {
+        const uint32_t begin = team.league_rank() * chunk;
+        const uint32_t end =
+            begin + chunk < num_queries ? begin + chunk : num_queries;
+        const Kokkos::pair<uint32_t, uint32_t> range(begin, end);
+        map.find_batch(team, Kokkos::subview(queries, range),
+                       Kokkos::subview(team_indices, range));
+      });
+
+  uint32_t errors = 0;
+  Kokkos::parallel_reduce(
+      range_policy(0, num_queries),
+      KOKKOS_LAMBDA(uint32_t i, uint32_t &err) {
+        const uint32_t key = queries(i);
+        if (indices(i) != map.find(key) || team_indices(i) != indices(i)) {
+          ++err;
+        }
+        const bool found = key % 3 == 0 && key / 3 < num_keys;
+        if (map.valid_at(indices(i)) != found) ++err;
+        if (found && map.value_at(indices(i)) != key / 3) ++err;
+      },
+      errors);
+  EXPECT_EQ(0u, errors);
+}
+
+TEST(TEST_CATEGORY, UnorderedMap_insert_and_erase) {
+  test_insert_and_erase<TEST_EXECSPACE>(1);
+  test_insert_and_erase<TEST_EXECSPACE>(10000);
+}
+
+TEST(TEST_CATEGORY, UnorderedMap_revive_with_atomic_add) {
+  test_revive_with_atomic_add<TEST_EXECSPACE>(1, 100000);
+  test_revive_with_atomic_add<TEST_EXECSPACE>(7, 100000);
+  test_revive_with_atomic_add<TEST_EXECSPACE>(1000, 100000);
+}
+
+TEST(TEST_CATEGORY, UnorderedMap_bulk_insert) {
+  // grows from the estimate, from failed inserts, or not at all
+  test_bulk_insert<TEST_EXECSPACE>(10000, 1, 0);
+  test_bulk_insert<TEST_EXECSPACE>(100000, 5, 100);
+  test_bulk_insert<TEST_EXECSPACE>(1000, 20, 30000);
+}
+
+TEST(TEST_CATEGORY, UnorderedMap_find_batch) {
+  test_find_batch<TEST_EXECSPACE>(0, 10);
+  test_find_batch<TEST_EXECSPACE>(10, 7);
+  test_find_batch<TEST_EXECSPACE>(10000, 50000);
+}
+
 }  // namespace Test
 
 #endif  // KOKKOS_TEST_UNORDERED_MAP_HPP
@@ -25,6 +25,8 @@ static_assert(false,
 #include <Kokkos_View.hpp>
 #include <Kokkos_CopyViews.hpp>
 
+#include <algorithm>
+
 namespace Kokkos {
 
 /// \class Crs
@@ -122,9 +124,16 @@ template <class OutCounts, class InCrs>
 typename OutCounts::value_type get_crs_row_map_from_counts(
     OutCounts& out, InCrs const& in, std::string const& name = "row_map");
 
+/// \brief Transpose \c in into \c out.
+///
+/// On host execution spaces the transpose takes per-thread histograms and
+/// no atomics unless they would need much more memory than \c in, and the
+/// entries of every transposed row come out sorted.  Elsewhere their order
+/// is unspecified unless \c sort_rows is true.
 template <class DataType, class Arg1Type, class Arg2Type, class SizeType>
 void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
-                   Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in);
+                   Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in,
+                   bool sort_rows = false);
 
 }  // namespace Kokkos
 
@@ -135,6 +144,54 @@ void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
 namespace Kokkos {
 namespace Impl {
 
+template <class EntriesType, class SizeType>
+KOKKOS_INLINE_FUNCTION void crs_sift_down(const EntriesType& entries,
+                                          const SizeType begin, SizeType root,
+                                          const SizeType count) {
+  const typename EntriesType::non_const_value_type value =
+      entries(begin + root);
+  for (SizeType child = 2 * root + 1; child < count; child = 2 * root + 1) {
+    if (child + 1 < count &&
+        entries(begin + child) < entries(begin + child + 1)) {
+      ++child;
+    }
+    if (!(value < entries(begin + child))) break;
+    entries(begin + root) = entries(begin + child);
+    root                  = child;
+  }
+  entries(begin + root) = value;
+}
+
+// Sorts the entries [begin, end) of a row in place: insertion sort for the
+// short rows that make up most graphs, heap sort to bound the long ones.
+template <class EntriesType, class SizeType>
+KOKKOS_INLINE_FUNCTION void sort_crs_row(const EntriesType& entries,
+                                         const SizeType begin,
+                                         const SizeType end) {
+  using value_type    = typename EntriesType::non_const_value_type;
+  const SizeType size = end - begin;
+  if (size <= 16) {
+    for (SizeType i = begin + 1; i < end; ++i) {
+      const value_type value = entries(i);
+      SizeType j             = i;
+      for (; j > begin && value < entries(j - 1); --j) {
+        entries(j) = entries(j - 1);
+      }
+      entries(j) = value;
+    }
+    return;
+  }
+  for (SizeType i = size / 2; i-- > 0;) {
+    crs_sift_down(entries, begin, i, size);
+  }
+  for (SizeType i = size; i-- > 1;) {
+    const value_type value = entries(begin);
+    entries(begin)         = entries(begin + i);
+    entries(begin + i)     = value;
+    crs_sift_down(entries, begin, SizeType(0), i);
+  }
+}
+
 template <class InCrs, class OutCounts>
 class GetCrsTransposeCounts {
  public:
@@ -246,6 +303,138 @@ class FillCrsTransposeEntries {
   }
 };
 
+// Transposes a Crs on a host execution space without atomics. The rows are
+// split into contiguous chunks, each of which counts its entries per column
+// into its own histogram. Scanning the histograms of every column over the
+// chunks gives each chunk its own range of every transposed row, which it
+// then fills in order, so the transposed rows come out sorted. There is a
+// chunk per thread, and the histograms take num_chunks * num_rows entries,
+// so graphs with too few entries per row are left to the atomic transpose.
+template <class InCrs, class OutCrs>
+class TransposeCrsHost {
+ public:
+  using execution_space = typename InCrs::execution_space;
+  using memory_space    = typename InCrs::memory_space;
+  using index_type      = typename InCrs::size_type;
+  struct Count {};
+  struct Offsets {};
+  struct Fill {};
+
+ private:
+  using offsets_type = View<index_type**, LayoutRight, memory_space>;
+  using counts_type  = View<index_type*, memory_space>;
+  InCrs in;
+  OutCrs out;
+  offsets_type offsets;
+  counts_type counts;
+  index_type num_rows;
+  index_type num_chunks;
+
+  // Histogram entries allowed per entry of the graph
+  static constexpr std::size_t max_histogram_ratio = 8;
+
+  static index_type get_num_chunks(InCrs const& in) {
+    return static_cast<index_type>(
+        std::clamp<std::size_t>(in.numRows(), 1,
+                                execution_space().concurrency()));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  index_type chunk_begin(index_type chunk) const {
+    return static_cast<index_type>(std::size_t(num_rows) * chunk / num_chunks);
+  }
+
+ public:
+  // Whether the histograms take at most a few times the memory of the graph
+  static bool fits_in_memory(InCrs const& in) {
+    return std::size_t(get_num_chunks(in)) * in.numRows() <=
+           max_histogram_ratio * in.entries.size();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Count, index_type chunk) const {
+    for (auto i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+      for (auto j = in.row_map(i); j < in.row_map(i + 1); ++j) {
+        ++offsets(chunk, in.entries(j));
+      }
+    }
+  }
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Offsets, index_type ti) const {
+    index_type sum = 0;
+    for (index_type chunk = 0; chunk < num_chunks; ++chunk) {
+      auto count         = offsets(chunk, ti);
+      offsets(chunk, ti) = sum;
+      sum += count;
+    }
+    counts(ti) = sum;
+  }
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Fill, index_type chunk) const {
+    for (auto i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+      for (auto j = in.row_map(i); j < in.row_map(i + 1); ++j) {
+        auto ti = in.entries(j);
+        out.entries(out.row_map(ti) + offsets(chunk, ti)++) = i;
+      }
+    }
+  }
+  TransposeCrsHost(InCrs const& arg_in, OutCrs& arg_out)
+      : in(arg_in),
+        num_rows(arg_in.numRows()),
+        num_chunks(get_num_chunks(arg_in)) {
+    const std::size_t nentries = in.entries.size();
+    offsets = offsets_type("transpose_offsets", num_chunks, num_rows);
+    counts  = counts_type(view_alloc(WithoutInitializing, "transpose_counts"),
+                          num_rows);
+    Kokkos::parallel_for(
+        "Kokkos::Impl::TransposeCrsHost::count",
+        RangePolicy<execution_space, Count, IndexType<index_type>>(0,
+                                                                   num_chunks),
+        *this);
+    Kokkos::parallel_for(
+        "Kokkos::Impl::TransposeCrsHost::offsets",
+        RangePolicy<execution_space, Offsets, IndexType<index_type>>(0,
+                                                                     num_rows),
+        *this);
+    Kokkos::get_crs_row_map_from_counts(out.row_map, counts,
+                                        "tranpose_row_map");
+    out.entries = typename OutCrs::entries_type(
+        view_alloc(WithoutInitializing, "transpose_entries"), nentries);
+    Kokkos::parallel_for(
+        "Kokkos::Impl::TransposeCrsHost::fill",
+        RangePolicy<execution_space, Fill, IndexType<index_type>>(0,
+                                                                  num_chunks),
+        *this);
+    execution_space().fence(
+        "Kokkos::Impl::TransposeCrsHost::TransposeCrsHost: fence after fill");
+    arg_out = out;
+  }
+};
+
+template <class CrsType>
+class SortCrsRows {
+ public:
+  using execution_space = typename CrsType::execution_space;
+  using index_type      = typename CrsType::size_type;
+
+ private:
+  CrsType crs;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  void operator()(index_type i) const {
+    sort_crs_row(crs.entries, crs.row_map(i), crs.row_map(i + 1));
+  }
+  SortCrsRows(CrsType const& arg_crs) : crs(arg_crs) {
+    Kokkos::parallel_for(
+        "Kokkos::Impl::SortCrsRows",
+        RangePolicy<execution_space, IndexType<index_type>>(0, crs.numRows()),
+        *this);
+    execution_space().fence(
+        "Kokkos::Impl::SortCrsRows::SortCrsRows: fence after sort");
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -275,10 +464,21 @@ typename OutRowMap::value_type get_crs_row_map_from_counts(
 
 template <class DataType, class Arg1Type, class Arg2Type, class SizeType>
 void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
-                   Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in) {
-  using crs_type     = Crs<DataType, Arg1Type, Arg2Type, SizeType>;
-  using memory_space = typename crs_type::memory_space;
-  using counts_type  = View<SizeType*, memory_space>;
+                   Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in,
+                   bool sort_rows) {
+  using crs_type        = Crs<DataType, Arg1Type, Arg2Type, SizeType>;
+  using memory_space    = typename crs_type::memory_space;
+  using execution_space = typename crs_type::execution_space;
+  using counts_type     = View<SizeType*, memory_space>;
+  if constexpr (SpaceAccessibility<execution_space, HostSpace>::accessible) {
+    using transposer_type = Kokkos::Impl::TransposeCrsHost<crs_type, crs_type>;
+    if (transposer_type::fits_in_memory(in)) {
+      transposer_type transposer(in, out);
+      return;
+    }
+    // the rows still come out sorted on the host
+    sort_rows = true;
+  }
   {
     counts_type counts;
     Kokkos::get_crs_transpose_counts(counts, in);
@@ -288,6 +488,9 @@ void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
   out.entries = decltype(out.entries)("transpose_entries", in.entries.size());
   Kokkos::Impl::FillCrsTransposeEntries<crs_type, crs_type> entries_functor(
       in, out);
+  if (sort_rows) {
+    Kokkos::Impl::SortCrsRows<crs_type> sorter(out);
+  }
 }
 
 template <class CrsType, class Functor,
@@ -365,6 +568,176 @@ void count_and_fill_crs(CrsType& crs, typename CrsType::size_type nrows,
   Kokkos::CountAndFill<CrsType, Functor>(crs, nrows, f);
 }
 
+/*--------------------------------------------------------------------------*/
+
+namespace Experimental {
+
+/// \class CrsRowPolicy
+/// \brief Iterate over the rows of a compressed row storage graph with the
+///   work split evenly by entries instead of by rows.
+///
+/// <tt>parallel_for(label, policy, functor)</tt> calls
+/// <tt>functor(row, entry_begin, entry_end)</tt> for the entries
+/// <tt>[entry_begin, entry_end)</tt> of every row, from as many work items
+/// as set with set_num_chunks (the concurrency of the execution space by
+/// default).  Every work item covers the same number of rows plus entries,
+/// found by a binary search along its diagonal of the merge path of the row
+/// map with the entries, so a few long rows no longer serialize the
+/// iteration the way they do with a RangePolicy over the rows.
+///
+/// As a consequence a row longer than a work item is split over several
+/// calls, which may run concurrently: a functor that reduces a row, like a
+/// sparse matrix-vector product, has to combine the partial results
+/// atomically when <tt>[entry_begin, entry_end)</tt> is not the whole row.
+/// Every row, including the empty ones, is part of at least one call.
+///
+/// Given the row block offsets of a StaticCrsGraph (see
+/// create_block_partitioning), the policy runs one work item per block
+/// instead, and every row is called exactly once with all its entries.
+template <class ExecutionSpace, class RowMapType>
+class CrsRowPolicy {
+ public:
+  using execution_space = ExecutionSpace;
+  using row_map_type    = RowMapType;
+  using size_type = std::remove_const_t<typename RowMapType::value_type>;
+  using row_block_type =
+      View<const size_type*, typename RowMapType::device_type>;
+
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename RowMapType::memory_space>::accessible,
+      "Kokkos::Experimental::CrsRowPolicy: the execution space must be able "
+      "to access the row map");
+
+  CrsRowPolicy(const ExecutionSpace& space, const RowMapType& row_map)
+      : m_space(space),
+        m_row_map(row_map),
+        m_num_chunks(space.concurrency()) {}
+
+  template <class RowBlockType>
+  CrsRowPolicy(const ExecutionSpace& space, const RowMapType& row_map,
+               const RowBlockType& row_block_offsets)
+      : m_space(space),
+        m_row_map(row_map),
+        m_row_blocks(row_block_offsets),
+        m_num_chunks(row_block_offsets.extent(0) > 0
+                         ? row_block_offsets.extent(0) - 1
+                         : 0) {}
+
+  /// Set the number of work items of the merge path iteration.
+  CrsRowPolicy& set_num_chunks(const size_t num_chunks) {
+    if (m_row_blocks.data() == nullptr) m_num_chunks = num_chunks;
+    return *this;
+  }
+
+  const ExecutionSpace& space() const { return m_space; }
+  const RowMapType& row_map() const { return m_row_map; }
+  const row_block_type& row_block_offsets() const { return m_row_blocks; }
+  size_t num_chunks() const { return m_num_chunks; }
+
+ private:
+  ExecutionSpace m_space;
+  RowMapType m_row_map;
+  row_block_type m_row_blocks;
+  size_t m_num_chunks;
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+template <class PolicyType, class FunctorType>
+class CrsRowPolicyFunctor {
+ public:
+  using execution_space = typename PolicyType::execution_space;
+  using size_type       = typename PolicyType::size_type;
+
+ private:
+  typename PolicyType::row_map_type m_row_map;
+  typename PolicyType::row_block_type m_row_blocks;
+  size_t m_num_chunks;
+  FunctorType m_functor;
+
+  // number of rows completed before the diagonal of the merge path at
+  // *diagonal*, with the end of row i ordered before entry row_map(i + 1)
+  KOKKOS_INLINE_FUNCTION
+  size_t merge_path_search(const size_t diagonal, const size_t num_rows,
+                           const size_t num_entries) const {
+    size_t lower = diagonal > num_entries ? diagonal - num_entries : 0;
+    size_t upper = diagonal < num_rows ? diagonal : num_rows;
+    while (lower < upper) {
+      const size_t pivot = lower + (upper - lower) / 2;
+      if (size_t(m_row_map(pivot + 1) - m_row_map(0)) <= diagonal - pivot - 1)
+        lower = pivot + 1;
+      else
+        upper = pivot;
+    }
+    return lower;
+  }
+
+ public:
+  CrsRowPolicyFunctor(const PolicyType& policy, const FunctorType& functor)
+      : m_row_map(policy.row_map()),
+        m_row_blocks(policy.row_block_offsets()),
+        m_num_chunks(policy.num_chunks()),
+        m_functor(functor) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t chunk) const {
+    if (m_row_blocks.data() != nullptr) {
+      for (size_type row = m_row_blocks(chunk); row < m_row_blocks(chunk + 1);
+           ++row) {
+        m_functor(row, m_row_map(row), m_row_map(row + 1));
+      }
+      return;
+    }
+
+    const size_t num_rows = m_row_map.extent(0) - 1;
+    const size_t first    = m_row_map(0);
+    const size_t length   = num_rows + (m_row_map(num_rows) - first);
+    const size_t begin    = length * chunk / m_num_chunks;
+    const size_t end      = length * (chunk + 1) / m_num_chunks;
+    const size_t num_entries = length - num_rows;
+
+    const size_t row_end = merge_path_search(end, num_rows, num_entries);
+    size_t row           = merge_path_search(begin, num_rows, num_entries);
+    size_t entry         = first + (begin - row);
+    for (; row < row_end; ++row) {
+      const size_t next = m_row_map(row + 1);
+      m_functor(size_type(row), size_type(entry), size_type(next));
+      entry = next;
+    }
+    const size_t entry_end = first + (end - row_end);
+    if (entry < entry_end) {
+      m_functor(size_type(row), size_type(entry), size_type(entry_end));
+    }
+  }
+};
+
+}  // namespace Impl
+
+template <class ExecutionSpace, class RowMapType, class FunctorType>
+void parallel_for(
+    const std::string& label,
+    const Experimental::CrsRowPolicy<ExecutionSpace, RowMapType>& policy,
+    const FunctorType& functor) {
+  using policy_type  = Experimental::CrsRowPolicy<ExecutionSpace, RowMapType>;
+  using functor_type = Impl::CrsRowPolicyFunctor<policy_type, FunctorType>;
+  // the merge path needs the end of the last row
+  if (policy.row_map().extent(0) == 0 || policy.num_chunks() == 0) return;
+  Kokkos::parallel_for(label,
+                       RangePolicy<ExecutionSpace, IndexType<size_t>>(
+                           policy.space(), 0, policy.num_chunks()),
+                       functor_type(policy, functor));
+}
+
+template <class ExecutionSpace, class RowMapType, class FunctorType>
+void parallel_for(
+    const Experimental::CrsRowPolicy<ExecutionSpace, RowMapType>& policy,
+    const FunctorType& functor) {
+  Kokkos::parallel_for("", policy, functor);
+}
+
 }  // namespace Kokkos
 
 #endif /* #define KOKKOS_CRS_HPP */
@@ -19,6 +19,7 @@
 
 #include <omp.h>
 #include <OpenMP/Kokkos_OpenMP_Instance.hpp>
+#include <impl/Kokkos_HostLookBackScan.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -42,6 +43,8 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
   using pointer_type   = typename Analysis::pointer_type;
   using reference_type = typename Analysis::reference_type;
 
+  using LookBackScan = HostLookBackScan<typename Analysis::Reducer, Member>;
+
   OpenMPInternal* m_instance;
   const FunctorType m_functor;
   const Policy m_policy;
@@ -92,7 +95,28 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
       return;
     }
 
-#pragma omp parallel num_threads(m_instance->thread_pool_size())
+    const int pool_size = m_instance->thread_pool_size();
+    if (LookBackScan::is_profitable(m_policy.end() - m_policy.begin(),
+                                    pool_size)) {
+      typename Analysis::Reducer final_reducer(m_functor);
+      LookBackScan scan(final_reducer, m_policy.begin(), m_policy.end(),
+                        pool_size);
+
+#pragma omp parallel num_threads(pool_size)
+      {
+        HostThreadTeamData& data = *(m_instance->get_thread_data());
+        scan.execute(reinterpret_cast<pointer_type>(data.pool_reduce_local()),
+                     [&](const Member ibeg, const Member iend,
+                         reference_type update, const bool final) {
+                       ParallelScan::template exec_range<WorkTag>(
+                           m_functor, ibeg, iend, update, final);
+                     });
+      }
+
+      return;
+    }
+
+#pragma omp parallel num_threads(pool_size)
     {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
       typename Analysis::Reducer final_reducer(m_functor);
@@ -167,6 +191,8 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
   using pointer_type   = typename Analysis::pointer_type;
   using reference_type = typename Analysis::reference_type;
 
+  using LookBackScan = HostLookBackScan<typename Analysis::Reducer, Member>;
+
   OpenMPInternal* m_instance;
   const FunctorType m_functor;
   const Policy m_policy;
@@ -220,7 +246,30 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
       return;
     }
 
-#pragma omp parallel num_threads(m_instance->thread_pool_size())
+    const int pool_size = m_instance->thread_pool_size();
+    if (LookBackScan::is_profitable(m_policy.end() - m_policy.begin(),
+                                    pool_size)) {
+      typename Analysis::Reducer final_reducer(m_functor);
+      LookBackScan scan(final_reducer, m_policy.begin(), m_policy.end(),
+                        pool_size);
+
+#pragma omp parallel num_threads(pool_size)
+      {
+        HostThreadTeamData& data = *(m_instance->get_thread_data());
+        scan.execute(reinterpret_cast<pointer_type>(data.pool_reduce_local()),
+                     [&](const Member ibeg, const Member iend,
+                         reference_type update, const bool final) {
+                       ParallelScanWithTotal::template exec_range<WorkTag>(
+                           m_functor, ibeg, iend, update, final);
+                     });
+      }
+
+      *m_result_ptr = final_reducer.reference(scan.total());
+
+      return;
+    }
+
+#pragma omp parallel num_threads(pool_size)
     {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
       typename Analysis::Reducer final_reducer(m_functor);
@@ -18,6 +18,9 @@
 #define KOKKOS_THREADS_PARALLEL_SCAN_RANGE_HPP
 
 #include <Kokkos_Parallel.hpp>
+#include <impl/Kokkos_HostLookBackScan.hpp>
+
+#include <utility>
 
 namespace Kokkos {
 namespace Impl {
@@ -35,6 +38,9 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
   using pointer_type   = typename Analysis::pointer_type;
   using reference_type = typename Analysis::reference_type;
 
+  using LookBackScan = HostLookBackScan<typename Analysis::Reducer, Member>;
+  using LookBackArg  = std::pair<const ParallelScan *, LookBackScan *>;
+
   const FunctorType m_functor;
   const Policy m_policy;
 
@@ -87,9 +93,35 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
     instance.fan_in();
   }
 
+  static void exec_look_back(ThreadsInternal &instance, const void *arg) {
+    const auto &[self, scan] = *((const LookBackArg *)arg);
+
+    scan->execute(static_cast<pointer_type>(instance.reduce_memory()),
+                  [&](const Member ibeg, const Member iend,
+                      reference_type update, const bool final) {
+                    ParallelScan::template exec_range<WorkTag>(
+                        self->m_functor, ibeg, iend, update, final);
+                  });
+
+    instance.fan_in();
+  }
+
  public:
   inline void execute() const {
     ThreadsInternal::resize_scratch(2 * Analysis::value_size(m_functor), 0);
+
+    const int pool_size = Threads::impl_thread_pool_size();
+    if (LookBackScan::is_profitable(m_policy.end() - m_policy.begin(),
+                                    pool_size)) {
+      typename Analysis::Reducer final_reducer(m_functor);
+      LookBackScan scan(final_reducer, m_policy.begin(), m_policy.end(),
+                        pool_size);
+      const LookBackArg arg(this, &scan);
+      ThreadsInternal::start(&ParallelScan::exec_look_back, &arg);
+      ThreadsInternal::fence();
+      return;
+    }
+
     ThreadsInternal::start(&ParallelScan::exec, this);
     ThreadsInternal::fence();
   }
@@ -114,6 +146,9 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
   using pointer_type   = typename Analysis::pointer_type;
   using reference_type = typename Analysis::reference_type;
 
+  using LookBackScan = HostLookBackScan<typename Analysis::Reducer, Member>;
+  using LookBackArg  = std::pair<const ParallelScanWithTotal *, LookBackScan *>;
+
   const FunctorType m_functor;
   const Policy m_policy;
   const pointer_type m_result_ptr;
@@ -171,9 +206,36 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
     }
   }
 
+  static void exec_look_back(ThreadsInternal &instance, const void *arg) {
+    const auto &[self, scan] = *((const LookBackArg *)arg);
+
+    scan->execute(static_cast<pointer_type>(instance.reduce_memory()),
+                  [&](const Member ibeg, const Member iend,
+                      reference_type update, const bool final) {
+                    ParallelScanWithTotal::template exec_range<WorkTag>(
+                        self->m_functor, ibeg, iend, update, final);
+                  });
+
+    instance.fan_in();
+  }
+
  public:
   inline void execute() const {
     ThreadsInternal::resize_scratch(2 * Analysis::value_size(m_functor), 0);
+
+    const int pool_size = Threads::impl_thread_pool_size();
+    if (LookBackScan::is_profitable(m_policy.end() - m_policy.begin(),
+                                    pool_size)) {
+      typename Analysis::Reducer final_reducer(m_functor);
+      LookBackScan scan(final_reducer, m_policy.begin(), m_policy.end(),
+                        pool_size);
+      const LookBackArg arg(this, &scan);
+      ThreadsInternal::start(&ParallelScanWithTotal::exec_look_back, &arg);
+      ThreadsInternal::fence();
+      *m_result_ptr = final_reducer.reference(scan.total());
+      return;
+    }
+
     ThreadsInternal::start(&ParallelScanWithTotal::exec, this);
     ThreadsInternal::fence();
   }
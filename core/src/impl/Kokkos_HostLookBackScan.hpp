@@ -0,0 +1,168 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HOST_LOOK_BACK_SCAN_HPP
+#define KOKKOS_HOST_LOOK_BACK_SCAN_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace Kokkos {
+namespace Impl {
+
+// class HostLookBackScan
+//
+// single-pass range scan shared by the host backends
+//
+// The two-pass scan reduces the range of each thread, scans the per-thread
+// partial results and then runs over the range again. For ranges that do not
+// fit in cache this reads the input twice from memory.
+//
+// Here the range is cut into chunks small enough to stay in cache, which the
+// threads claim in increasing order. A thread reduces its chunk, publishes
+// the aggregate and then looks back at the preceding chunks until it finds
+// one whose inclusive prefix is already known (decoupled look-back, Merrill &
+// Garland 2016). The final pass over the chunk then reads it from cache.
+//
+// Since chunks are claimed in order, the owner of every chunk a thread waits
+// for is already running and only waits for chunks before its own, so the
+// look-back always makes progress.
+//
+// *execute* must be called by every thread of the pool with *local* pointing
+// to value_count values private to the calling thread.
+template <class Reducer, class Member>
+class HostLookBackScan {
+ public:
+  using value_type   = typename Reducer::value_type;
+  using pointer_type = typename Reducer::pointer_type;
+
+  // with 8 byte values read and written this is 128KB per chunk
+  static constexpr Member max_chunk_size = 8192;
+  // at least that many chunks per thread so that the work is balanced
+  static constexpr Member min_chunks_per_thread = 4;
+
+  // The two-pass scan already reads from cache when every thread has less
+  // than a chunk to work on. Values with an alignment larger than what new
+  // guarantees for the chunk states are also left to the two-pass scan.
+  static bool is_profitable(const Member num_iterations,
+                            const int num_threads) {
+    return alignof(value_type) <= alignof(std::max_align_t) &&
+           num_iterations > Member(num_threads) * max_chunk_size;
+  }
+
+  HostLookBackScan(const Reducer& reducer, const Member begin,
+                   const Member end, const int num_threads)
+      : m_reducer(reducer),
+        m_value_count(reducer.value_count()),
+        m_begin(begin),
+        m_end(end) {
+    const Member num_iterations = end - begin;
+    m_chunk_size                = std::clamp<Member>(
+        num_iterations / (Member(num_threads) * min_chunks_per_thread), 1,
+        max_chunk_size);
+    m_num_chunks = (num_iterations + m_chunk_size - 1) / m_chunk_size;
+
+    // every chunk stores its aggregate followed by its inclusive prefix
+    m_values = std::make_unique<char[]>(m_num_chunks * 2 * m_value_count *
+                                        sizeof(value_type));
+    m_status = std::make_unique<std::atomic<int>[]>(m_num_chunks);
+  }
+
+  template <class ExecRange>
+  void execute(const pointer_type local, const ExecRange& exec_range) {
+    for (Member chunk = m_next_chunk.fetch_add(1, std::memory_order_relaxed);
+         chunk < m_num_chunks;
+         chunk = m_next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+      const Member chunk_begin = m_begin + chunk * m_chunk_size;
+      const Member chunk_end   = std::min(chunk_begin + m_chunk_size, m_end);
+
+      exec_range(chunk_begin, chunk_end, m_reducer.init(aggregate(chunk)),
+                 false);
+      if (chunk > 0) {
+        m_status[chunk].store(aggregate_available, std::memory_order_release);
+      }
+
+      // walk back to the closest chunk with a known inclusive prefix and
+      // then join the aggregates of the chunks in between in order
+      m_reducer.init(local);
+      if (chunk > 0) {
+        Member look_back = chunk - 1;
+        while (wait_for_status(look_back) != prefix_available) {
+          --look_back;
+        }
+        m_reducer.copy(local, inclusive_prefix(look_back));
+        for (Member i = look_back + 1; i < chunk; ++i) {
+          m_reducer.join(local, aggregate(i));
+        }
+      }
+
+      // publish the inclusive prefix before the final pass so that the
+      // following chunks do not wait for it
+      m_reducer.copy(inclusive_prefix(chunk), local);
+      m_reducer.join(inclusive_prefix(chunk), aggregate(chunk));
+      m_status[chunk].store(prefix_available, std::memory_order_release);
+
+      exec_range(chunk_begin, chunk_end, m_reducer.reference(local), true);
+    }
+  }
+
+  // the result of the scan over the whole range, once all threads are done
+  pointer_type total() const { return inclusive_prefix(m_num_chunks - 1); }
+
+ private:
+  static constexpr int aggregate_available = 1;
+  static constexpr int prefix_available    = 2;
+
+  pointer_type aggregate(const Member chunk) const {
+    return reinterpret_cast<pointer_type>(m_values.get()) +
+           2 * chunk * m_value_count;
+  }
+
+  pointer_type inclusive_prefix(const Member chunk) const {
+    return aggregate(chunk) + m_value_count;
+  }
+
+  int wait_for_status(const Member chunk) const {
+    // the first chunk publishes its prefix right away and the others
+    // their aggregate after a single pass over a chunk, so the wait is short
+    int status = m_status[chunk].load(std::memory_order_acquire);
+    while (status == 0) {
+      std::this_thread::yield();
+      status = m_status[chunk].load(std::memory_order_acquire);
+    }
+    return status;
+  }
+
+  const Reducer& m_reducer;
+  const Member m_value_count;
+  const Member m_begin;
+  const Member m_end;
+  Member m_chunk_size;
+  Member m_num_chunks;
+  std::unique_ptr<char[]> m_values;
+  std::unique_ptr<std::atomic<int>[]> m_status;
+  std::atomic<Member> m_next_chunk{0};
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_HOST_LOOK_BACK_SCAN_HPP
@@ -14,6 +14,7 @@
 //
 //@HEADER
 
+#include <algorithm>
 #include <vector>
 
 #include <Kokkos_Core.hpp>
@@ -171,8 +172,189 @@ void test_constructor(std::int32_t nrows) {
   }
 }
 
+// one long row followed by short rows, every third of them empty
+struct SkewedFillFunctor {
+  KOKKOS_INLINE_FUNCTION
+  std::int32_t operator()(std::int32_t row, std::int32_t *fill) const {
+    auto n = (row == 0) ? 1000 : (row % 3 == 0) ? 0 : row % 7 + 1;
+    if (fill) {
+      for (std::int32_t j = 0; j < n; ++j) {
+        fill[j] = j + 1;
+      }
+    }
+    return n;
+  }
+};
+
+template <class CrsType, class ExecSpace>
+struct CrsRowPolicyFunctor {
+  using counts_type = Kokkos::View<std::int32_t *, ExecSpace>;
+  CrsType graph;
+  counts_type row_sums;
+  counts_type row_calls;
+  counts_type entry_visits;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(std::int32_t row, std::int32_t begin,
+                  std::int32_t end) const {
+    // a call never leaves its row
+    if (begin < graph.row_map(row) || end > graph.row_map(row + 1)) return;
+    std::int32_t sum = 0;
+    for (std::int32_t j = begin; j < end; ++j) {
+      sum += graph.entries(j);
+      Kokkos::atomic_inc(&entry_visits(j));
+    }
+    Kokkos::atomic_add(&row_sums(row), sum);
+    Kokkos::atomic_inc(&row_calls(row));
+  }
+};
+
+// Sums up the rows with the merge path iteration and, with row blocks, one
+// call per row.
+template <class ExecSpace>
+void test_row_policy(std::int32_t nrows, std::size_t num_chunks,
+                     bool use_blocks) {
+  using crs_type = Kokkos::Crs<std::int32_t, ExecSpace, void, std::int32_t>;
+  using functor_type = CrsRowPolicyFunctor<crs_type, ExecSpace>;
+  using counts_type  = typename functor_type::counts_type;
+  crs_type graph;
+  Kokkos::count_and_fill_crs(graph, nrows, SkewedFillFunctor());
+  const auto nentries = graph.entries.extent(0);
+  functor_type functor{graph, counts_type("row_sums", nrows),
+                       counts_type("row_calls", nrows),
+                       counts_type("entry_visits", nentries)};
+
+  if (use_blocks) {
+    Kokkos::View<std::int32_t *, ExecSpace> blocks("blocks", 4);
+    auto blocks_h = Kokkos::create_mirror_view(blocks);
+    blocks_h(0)   = 0;
+    blocks_h(1)   = nrows / 3;
+    blocks_h(2)   = nrows / 2;
+    blocks_h(3)   = nrows;
+    Kokkos::deep_copy(blocks, blocks_h);
+    Kokkos::parallel_for("crs_row_blocks",
+                         Kokkos::Experimental::CrsRowPolicy(
+                             ExecSpace(), graph.row_map, blocks),
+                         functor);
+  } else {
+    Kokkos::Experimental::CrsRowPolicy policy(ExecSpace(), graph.row_map);
+    if (num_chunks > 0) policy.set_num_chunks(num_chunks);
+    Kokkos::parallel_for("crs_merge_path", policy, functor);
+  }
+
+  auto row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     graph.row_map);
+  auto row_sums = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      functor.row_sums);
+  auto row_calls = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       functor.row_calls);
+  auto entry_visits = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), functor.entry_visits);
+  for (std::int32_t row = 0; row < nrows; ++row) {
+    auto n = row_map(row + 1) - row_map(row);
+    ASSERT_EQ(row_sums(row), n * (n + 1) / 2) << row;
+    if (use_blocks) {
+      ASSERT_EQ(row_calls(row), 1) << row;
+    } else {
+      ASSERT_GE(row_calls(row), 1) << row;
+    }
+  }
+  for (std::size_t j = 0; j < nentries; ++j) {
+    ASSERT_EQ(entry_visits(j), 1) << j;
+  }
+}
+
+// every row refers to column 0, the others are spread out
+struct SkewedColumnsFunctor {
+  std::int32_t nrows;
+
+  KOKKOS_INLINE_FUNCTION
+  std::int32_t operator()(std::int32_t row, std::int32_t *fill) const {
+    auto n = row % 5 + 1;
+    if (fill) {
+      fill[0] = 0;
+      for (std::int32_t j = 1; j < n; ++j) {
+        fill[j] = (row * 7 + j * j * 13) % nrows;
+      }
+    }
+    return n;
+  }
+};
+
+// only every 100th row has entries, too few for per-thread histograms
+struct SparseColumnsFunctor {
+  std::int32_t nrows;
+
+  KOKKOS_INLINE_FUNCTION
+  std::int32_t operator()(std::int32_t row, std::int32_t *fill) const {
+    if (row % 100 != 0) return 0;
+    if (fill) {
+      fill[0] = (row * 7) % nrows;
+      fill[1] = nrows - 1 - row;
+    }
+    return 2;
+  }
+};
+
+template <class ExecSpace, class Functor = SkewedColumnsFunctor>
+void test_transpose(std::int32_t nrows, bool sort_rows) {
+  using crs_type = Kokkos::Crs<std::int32_t, ExecSpace, void, std::int32_t>;
+  crs_type graph;
+  Kokkos::count_and_fill_crs(graph, nrows, Functor{nrows});
+  crs_type transpose;
+  Kokkos::transpose_crs(transpose, graph, sort_rows);
+  ASSERT_EQ(transpose.numRows(), nrows);
+
+  auto row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     graph.entries);
+  std::vector<std::vector<std::int32_t>> expected(nrows);
+  for (std::int32_t row = 0; row < nrows; ++row) {
+    for (auto j = row_map(row); j < row_map(row + 1); ++j) {
+      expected[entries(j)].push_back(row);
+    }
+  }
+
+  // host execution spaces always produce sorted rows
+  const bool sorted =
+      sort_rows ||
+      Kokkos::SpaceAccessibility<ExecSpace, Kokkos::HostSpace>::accessible;
+  auto t_row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       transpose.row_map);
+  auto t_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       transpose.entries);
+  ASSERT_EQ(t_entries.extent(0), entries.extent(0));
+  for (std::int32_t row = 0; row < nrows; ++row) {
+    std::vector<std::int32_t> actual(t_entries.data() + t_row_map(row),
+                                     t_entries.data() + t_row_map(row + 1));
+    if (!sorted) std::sort(actual.begin(), actual.end());
+    ASSERT_EQ(actual, expected[row]) << row;
+  }
+}
+
 }  // anonymous namespace
 
+TEST(TEST_CATEGORY, crs_transpose) {
+  for (bool sort_rows : {false, true}) {
+    test_transpose<TEST_EXECSPACE>(0, sort_rows);
+    test_transpose<TEST_EXECSPACE>(1, sort_rows);
+    test_transpose<TEST_EXECSPACE>(13, sort_rows);
+    test_transpose<TEST_EXECSPACE>(1000, sort_rows);
+    test_transpose<TEST_EXECSPACE>(100000, sort_rows);
+    test_transpose<TEST_EXECSPACE, SparseColumnsFunctor>(10000, sort_rows);
+  }
+}
+
+TEST(TEST_CATEGORY, crs_row_policy) {
+  for (std::int32_t nrows : {0, 1, 2, 13, 1000}) {
+    for (std::size_t num_chunks : {0, 1, 3, 64, 5000}) {
+      test_row_policy<TEST_EXECSPACE>(nrows, num_chunks, false);
+    }
+    test_row_policy<TEST_EXECSPACE>(nrows, 0, true);
+  }
+}
+
 TEST(TEST_CATEGORY, crs_count_fill) {
   test_count_fill<TEST_EXECSPACE>(0);
   test_count_fill<TEST_EXECSPACE>(1);
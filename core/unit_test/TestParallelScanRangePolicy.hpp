@@ -211,6 +211,94 @@ struct TestParallelScanRangePolicy {
   }
 };  // struct TestParallelScanRangePolicy
 
+// x -> a * x + b with wrap-around arithmetic
+struct AffineMap {
+  unsigned a;
+  unsigned b;
+};
+
+// Scans the affine maps of [0,1,...,N-1] by composition, which is not
+// commutative, so that chunks joined out of order give wrong results.
+struct TestParallelScanNonCommutative {
+  using execution_space = TEST_EXECSPACE;
+  using value_type      = AffineMap;
+
+  Kokkos::View<AffineMap*, execution_space> prefix_results;
+
+  KOKKOS_INLINE_FUNCTION
+  static AffineMap element(const size_t i) {
+    return {2 * unsigned(i % 7) + 1, unsigned(i)};
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i, AffineMap& update, bool final_pass) const {
+    if (final_pass) prefix_results(i) = update;
+    join(update, element(i));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(AffineMap& update) const { update = {1, 0}; }
+
+  // applies update, then input
+  KOKKOS_INLINE_FUNCTION
+  void join(AffineMap& update, const AffineMap& input) const {
+    update = {input.a * update.a, input.a * update.b + input.b};
+  }
+
+  template <typename... Args>
+  void test_scan(const size_t work_size) {
+    prefix_results = decltype(prefix_results)("prefix_results", work_size);
+    AffineMap total{0, 0};
+    Kokkos::parallel_scan(
+        Kokkos::RangePolicy<execution_space, Args...>(0, work_size), *this,
+        total);
+
+    auto const prefix_h = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), prefix_results);
+    AffineMap expected;
+    init(expected);
+    for (size_t i = 0; i < work_size; ++i) {
+      ASSERT_EQ(expected.a, prefix_h(i).a) << "at " << i;
+      ASSERT_EQ(expected.b, prefix_h(i).b) << "at " << i;
+      join(expected, element(i));
+    }
+    ASSERT_EQ(expected.a, total.a);
+    ASSERT_EQ(expected.b, total.b);
+  }
+};
+
+TEST(TEST_CATEGORY, parallel_scan_range_policy_non_commutative) {
+  // The host backends scan ranges of more than 8192 iterations per thread in
+  // chunks of at most 8192 iterations, at least 4 per thread, and join the
+  // chunks by looking back at the preceding ones.  Cover sizes right above
+  // that threshold, ranges whose chunks are all full, and ones that end with
+  // a partial chunk.  Other backends only run the small sizes, the large ones
+  // would not fit in device memory.
+  bool uses_look_back = false;
+#ifdef KOKKOS_ENABLE_OPENMP
+  uses_look_back |= std::is_same_v<TEST_EXECSPACE, Kokkos::OpenMP>;
+#endif
+#ifdef KOKKOS_ENABLE_THREADS
+  uses_look_back |= std::is_same_v<TEST_EXECSPACE, Kokkos::Threads>;
+#endif
+  std::vector<size_t> work_sizes{0, 1, 1001};
+  if (uses_look_back) {
+    const size_t max_chunk_size = 8192;
+    const size_t num_threads    = TEST_EXECSPACE().concurrency();
+    const size_t threshold      = num_threads * max_chunk_size;
+    work_sizes.insert(work_sizes.end(),
+                      {threshold, threshold + 1, 4 * threshold,
+                       4 * threshold + 1, 4 * threshold - 1,
+                       11 * threshold + max_chunk_size / 2});
+  }
+  TestParallelScanNonCommutative f;
+  for (size_t work_size : work_sizes) {
+    f.test_scan<>(work_size);
+    f.test_scan<Kokkos::Schedule<Kokkos::Static>>(work_size);
+    f.test_scan<Kokkos::Schedule<Kokkos::Dynamic>>(work_size);
+  }
+}
+
 TEST(TEST_CATEGORY, parallel_scan_range_policy) {
   {
     TestParallelScanRangePolicy<char> f;
@@ -239,7 +327,8 @@ TEST(TEST_CATEGORY, parallel_scan_range_policy) {
   {
     TestParallelScanRangePolicy<long int> f;
 
-    std::vector<size_t> work_sizes{1000, 10000};
+    // the large size is scanned in chunks on the host backends
+    std::vector<size_t> work_sizes{1000, 10000, 1000003};
     f.test_scan<>(work_sizes);
     f.test_scan<Kokkos::Schedule<Kokkos::Static>>(work_sizes);
     f.test_scan<Kokkos::Schedule<Kokkos::Dynamic>>(work_sizes);